@@ -1,105 +1,251 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
-#include "Unicode.h"
-#include "Utilities.h"
+#include "unicode.h"
 
-#include "windows.h"
-
-#include "stringapiset.h"
-
-#include <cassert>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <limits>
 #include <string>
 
-namespace Microsoft::Common::Unicode {
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define UNICODE_USE_SSE2
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define UNICODE_USE_NEON
+#include <arm_neon.h>
+#endif
 
-// The implementations of the following functions heavily reference the MSDN article at
-// https://docs.microsoft.com/en-us/archive/msdn-magazine/2016/september/c-unicode-encoding-conversions-with-stl-strings-and-win32-apis.
+namespace Microsoft::Common::Unicode {
 
-std::wstring Utf8ToUtf16(const char *utf8, size_t utf8Len) {
-  std::wstring utf16{};
+// The conversions are done in a single pass into a buffer allocated for the longest possible result.
+// Runs of ASCII characters are converted 16 code units at a time with SSE2 or NEON when they are available.
+//
+// Invalid UTF-8 is replaced with one U+FFFD per maximal subpart, as the Unicode Standard recommends in
+// "U+FFFD Substitution of Maximal Subparts" (chapter 3.9). A maximal subpart is the longest prefix of a
+// well-formed sequence, or a single byte if the byte cannot start one. The byte that ends a maximal subpart
+// is converted on its own, so that valid characters are never swallowed by an invalid sequence.
+// An unpaired surrogate in UTF-16 is replaced with U+FFFD.
+
+constexpr uint32_t ReplacementCharacter = 0xFFFD;
+
+// Converts the leading ASCII characters and returns their count.
+static size_t WidenAscii(const uint8_t *utf8, size_t utf8Len, wchar_t *utf16) noexcept {
+  size_t i = 0;
+  if constexpr (sizeof(wchar_t) == sizeof(uint16_t)) {
+#if defined(UNICODE_USE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= utf8Len; i += 16) {
+      __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8 + i));
+      if (_mm_movemask_epi8(chunk) != 0) {
+        break;
+      }
+
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(utf16 + i), _mm_unpacklo_epi8(chunk, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(utf16 + i + 8), _mm_unpackhi_epi8(chunk, zero));
+    }
+#elif defined(UNICODE_USE_NEON)
+    for (; i + 16 <= utf8Len; i += 16) {
+      uint8x16_t chunk = vld1q_u8(utf8 + i);
+      if (vmaxvq_u8(chunk) >= 0x80) {
+        break;
+      }
+
+      vst1q_u16(reinterpret_cast<uint16_t *>(utf16 + i), vmovl_u8(vget_low_u8(chunk)));
+      vst1q_u16(reinterpret_cast<uint16_t *>(utf16 + i + 8), vmovl_u8(vget_high_u8(chunk)));
+    }
+#endif
+  }
 
-  // A small optimization.
-  if (utf8Len == 0) {
-    return utf16;
+  for (; i < utf8Len && utf8[i] < 0x80; ++i) {
+    utf16[i] = static_cast<wchar_t>(utf8[i]);
   }
 
-  // Extra parentheses needed here to prevent expanding max as a
-  // Windows-specific preprocessor macro.
-  if (utf8Len > static_cast<size_t>((std::numeric_limits<int>::max)())) {
-    throw std::overflow_error("Length of input string to Utf8ToUtf16() must fit into an int.");
+  return i;
+}
+
+// Converts the leading ASCII characters and returns their count.
+template <typename TChar>
+static size_t NarrowAscii(const TChar *utf16, size_t utf16Len, char *utf8) noexcept {
+  size_t i = 0;
+  if constexpr (sizeof(TChar) == sizeof(uint16_t)) {
+#if defined(UNICODE_USE_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+    for (; i + 16 <= utf16Len; i += 16) {
+      __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i));
+      __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf16 + i + 8));
+      __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiMask);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF) {
+        break;
+      }
+
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(utf8 + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(UNICODE_USE_NEON)
+    for (; i + 16 <= utf16Len; i += 16) {
+      uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t *>(utf16 + i));
+      uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t *>(utf16 + i + 8));
+      if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80) {
+        break;
+      }
+
+      vst1q_u8(reinterpret_cast<uint8_t *>(utf8 + i), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
   }
 
-  const int utf8Length = static_cast<int>(utf8Len);
-
-  // We do not specify MB_ERR_INVALID_CHARS here, which means that invalid UTF-8
-  // characters are replaced with U+FFFD.
-  constexpr DWORD flags = 0;
-
-  const int utf16Length = ::MultiByteToWideChar(
-      CP_UTF8, // Source string is in UTF-8.
-      flags, // Conversion flags.
-      utf8, // Source UTF-8 string pointer.
-      utf8Length, // Length of the source UTF-8 string, in chars.
-      nullptr, // Do not convert during this step, instead, request the size
-      0 //   of the destination buffer, in wchar_ts, excluding the
-      //   null termination character.
-  );
-
-  if (utf16Length == 0) {
-    throw UnicodeConversionException(
-        "Cannot get result string length when converting from UTF-8 to UTF-16 "
-        "(MultiByteToWideChar failed).",
-        GetLastError());
+  for (; i < utf16Len && static_cast<uint32_t>(utf16[i]) < 0x80; ++i) {
+    utf8[i] = static_cast<char>(utf16[i]);
   }
 
-  // Note that because the length of the input UTF-8 string was explicitly
-  // passed to MultiByteToWideChar (instead of just passing -1 and asking
-  // MultiByteToWideChar to scan the whole input string until a null terminator
-  // is found), MultiByteToWideChar won't add an additional null terminator to
-  // the result string. Therefore, there's no need to invoke
-  // std::wstring::resize with a "utf16Length + 1" value.
-  utf16.resize(utf16Length);
-
-  // Convert from UTF-8 to UTF-16
-  // Note that MultiByteToWideChar converts the UTF-8 BOM into the UTF-16BE BOM.
-  // So we do not have to do anything extra here to ensure correct BOM behavior.
-  int result = ::MultiByteToWideChar(
-      CP_UTF8, // Source string is in UTF-8.
-      flags, // Conversion flags.
-      utf8, // Source UTF-8 string pointer.
-      utf8Length, // Length of source UTF-8 string, in chars.
-      &utf16[0], // Pointer to destination buffer. This is fine because the
-      //   the C++11 standard specifies that the elements of a
-      //   std::basic_string are stored continuously.
-      utf16Length // Size of destination buffer, in wchar_ts.
-  );
-
-  if (result == 0) {
-    throw UnicodeConversionException(
-        "Cannot convert from UTF-8 to UTF-16 (MultiByteToWideChar failed).", GetLastError());
+  return i;
+}
+
+// Returns the length of the UTF-8 sequence that starts with the lead byte, or 0 if it is not a lead byte.
+// C0 and C1 only start overlong encodings, and F5..FF only start code points above U+10FFFF.
+static size_t GetSequenceLength(uint8_t lead) noexcept {
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    return 2;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    return 3;
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    return 4;
   }
 
-  return utf16;
+  return 0;
 }
 
-std::wstring Utf8ToUtf16(const char *utf8) {
-  return Utf8ToUtf16(utf8, strlen(utf8));
+// Checks the second byte of a sequence. Its range depends on the lead byte to exclude overlong encodings,
+// surrogates and code points above U+10FFFF (table 3-7 of the Unicode Standard). The next bytes are 80..BF.
+static bool IsValidSecondByte(uint8_t lead, uint8_t byte) noexcept {
+  switch (lead) {
+    case 0xE0:
+      return byte >= 0xA0 && byte <= 0xBF;
+    case 0xED:
+      return byte >= 0x80 && byte <= 0x9F;
+    case 0xF0:
+      return byte >= 0x90 && byte <= 0xBF;
+    case 0xF4:
+      return byte >= 0x80 && byte <= 0x8F;
+    default:
+      return (byte & 0xC0) == 0x80;
+  }
 }
 
-std::wstring Utf8ToUtf16(const std::string &utf8) {
-  return Utf8ToUtf16(utf8.c_str(), utf8.length());
+// Returns the number of UTF-16 code units written to utf16. It writes at most utf8Len code units.
+static size_t ConvertUtf8ToUtf16(const uint8_t *utf8, size_t utf8Len, wchar_t *utf16) noexcept {
+  size_t in = 0;
+  size_t out = 0;
+  while (in < utf8Len) {
+    uint8_t lead = utf8[in];
+    if (lead < 0x80) {
+      size_t count = WidenAscii(utf8 + in, utf8Len - in, utf16 + out);
+      in += count;
+      out += count;
+      continue;
+    }
+
+    size_t sequenceLength = GetSequenceLength(lead);
+    if (sequenceLength == 0) {
+      // A continuation byte without a lead byte, or a byte that cannot start a well-formed sequence.
+      utf16[out++] = static_cast<wchar_t>(ReplacementCharacter);
+      ++in;
+      continue;
+    }
+
+    uint32_t codePoint = lead & (0x7F >> sequenceLength);
+    size_t i = 1;
+    if (in + 1 < utf8Len && IsValidSecondByte(lead, utf8[in + 1])) {
+      codePoint = (codePoint << 6) | (utf8[in + 1] & 0x3F);
+      for (++i; i < sequenceLength && in + i < utf8Len && (utf8[in + i] & 0xC0) == 0x80; ++i) {
+        codePoint = (codePoint << 6) | (utf8[in + i] & 0x3F);
+      }
+    }
+
+    if (i < sequenceLength) {
+      // The bytes before the first invalid or missing byte are a maximal subpart.
+      utf16[out++] = static_cast<wchar_t>(ReplacementCharacter);
+      in += i;
+      continue;
+    }
+
+    in += sequenceLength;
+    if (codePoint < 0x10000) {
+      utf16[out++] = static_cast<wchar_t>(codePoint);
+    } else {
+      codePoint -= 0x10000;
+      utf16[out++] = static_cast<wchar_t>(0xD800 + (codePoint >> 10));
+      utf16[out++] = static_cast<wchar_t>(0xDC00 + (codePoint & 0x3FF));
+    }
+  }
+
+  return out;
 }
 
-#if _HAS_CXX17
-std::wstring Utf8ToUtf16(const std::string_view &utf8) {
-  return Utf8ToUtf16(utf8.data(), utf8.length());
+// Returns the number of bytes written to utf8. It writes at most MaxUtf8BytesPerCodeUnit<TChar> * utf16Len bytes.
+// Each UTF-16 code unit is converted to at most three bytes. A surrogate pair is converted to four bytes.
+// A 32-bit wchar_t code unit may hold a code point above U+FFFF on its own, which is converted to four bytes.
+template <typename TChar>
+constexpr size_t MaxUtf8BytesPerCodeUnit = sizeof(TChar) == sizeof(uint16_t) ? 3 : 4;
+
+template <typename TChar>
+static size_t ConvertUtf16ToUtf8(const TChar *utf16, size_t utf16Len, char *utf8) noexcept {
+  size_t in = 0;
+  size_t out = 0;
+  while (in < utf16Len) {
+    uint32_t codePoint = static_cast<uint32_t>(utf16[in]);
+    if (codePoint < 0x80) {
+      size_t count = NarrowAscii(utf16 + in, utf16Len - in, utf8 + out);
+      in += count;
+      out += count;
+      continue;
+    }
+
+    ++in;
+    if (codePoint >= 0xD800 && codePoint <= 0xDBFF && in < utf16Len) {
+      uint32_t trail = static_cast<uint32_t>(utf16[in]);
+      if (trail >= 0xDC00 && trail <= 0xDFFF) {
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (trail - 0xDC00);
+        ++in;
+      }
+    }
+
+    if ((codePoint >= 0xD800 && codePoint <= 0xDFFF) || codePoint > 0x10FFFF) {
+      // An unpaired surrogate, or a 32-bit code unit above U+10FFFF. The code unit after it is converted on its own.
+      codePoint = ReplacementCharacter;
+    }
+
+    if (codePoint < 0x800) {
+      utf8[out++] = static_cast<char>(0xC0 | (codePoint >> 6));
+      utf8[out++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+      utf8[out++] = static_cast<char>(0xE0 | (codePoint >> 12));
+      utf8[out++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      utf8[out++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+      utf8[out++] = static_cast<char>(0xF0 | (codePoint >> 18));
+      utf8[out++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+      utf8[out++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      utf8[out++] = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+  }
+
+  return out;
 }
-#endif
 
-std::string Utf16ToUtf8(const wchar_t *utf16, size_t utf16Len) {
+// Releases the unused part of the upper-bound-sized buffer if it is bigger than the result.
+template <typename TString>
+static void TrimResult(TString &result, size_t length) {
+  result.resize(length);
+  if (result.capacity() - length > length) {
+    result.shrink_to_fit();
+  }
+}
+
+template <typename TChar>
+static std::string Utf16ToUtf8Impl(const TChar *utf16, size_t utf16Len) {
   std::string utf8{};
 
   // A small optimization.
@@ -107,71 +253,51 @@ std::string Utf16ToUtf8(const wchar_t *utf16, size_t utf16Len) {
     return utf8;
   }
 
-  // Extra parentheses needed here to prevent expanding max as a
-  // Windows-specific preprocessor macro.
-  if (utf16Len > static_cast<size_t>((std::numeric_limits<int>::max)())) {
-    throw std::overflow_error("Length of input string to Utf16ToUtf8() must fit into an int.");
+  constexpr size_t maxBytesPerCodeUnit = MaxUtf8BytesPerCodeUnit<TChar>;
+  if (utf16Len > utf8.max_size() / maxBytesPerCodeUnit) {
+    throw std::overflow_error("Length of input string to Utf16ToUtf8() is too big.");
   }
 
-  const int utf16Length = static_cast<int>(utf16Len);
-
-  // We do not specify WC_ERR_INVALID_CHARS here, which means that invalid
-  // UTF-16 characters are replaced with U+FFFD.
-  constexpr DWORD flags = 0;
-
-  const int utf8Length = ::WideCharToMultiByte(
-      CP_UTF8, // Destination string is in UTF-8.
-      flags, // Conversion flags.
-      utf16, // Source UTF-16 string pointer.
-      utf16Length, // Length of the source UTF-16 string, in wchar_ts.
-      nullptr, // Do not convert during this step, instead, request the size
-      0, //   of the destination buffer, in chars, excluding the
-      //   null termination character.
-      nullptr, // WideCharToMultiByte requires the last two parameters to be
-      nullptr //   nullptrs when converting to UTF-8.
-  );
-
-  if (utf8Length == 0) {
-    throw UnicodeConversionException(
-        "Cannot get result string length when converting from UTF-16 to UTF-8 "
-        "(WideCharToMultiByte failed).",
-        GetLastError());
-  }
+  utf8.resize(utf16Len * maxBytesPerCodeUnit);
+  TrimResult(utf8, ConvertUtf16ToUtf8(utf16, utf16Len, &utf8[0]));
+  return utf8;
+}
+
+std::wstring Utf8ToUtf16(const char *utf8, size_t utf8Len) {
+  std::wstring utf16{};
 
-  // Note that because the length of the input UTF-16 string was explicitly
-  // passed to WideCharToMultiByte (instead of just passing -1 and asking
-  // WideCharToMultiByte to scan the whole input string until a null terminator
-  // is found), WideCharToMultiByte won't add an additional null terminator to
-  // the result string. Therefore, there's no need to invoke
-  // std::string::resize with a "utf8Length + 1" value.
-  utf8.resize(utf8Length);
-
-  // Convert from UTF-8 to UTF-16
-  // Note that MultiByteToWideChar converts the UTF-8 BOM into the UTF-16BE BOM.
-  // So we do not have to do anything extra here to ensure correct BOM behavior.
-  int result = ::WideCharToMultiByte(
-      CP_UTF8, // Destination string is in UTF-8.
-      flags, // Conversion flags.
-      utf16, // Source UTF-16 string pointer.
-      utf16Length, // Length of the source UTF-16 string, in wchar_ts.
-      &utf8[0], // Pointer to destination buffer. This is fine because the
-      //   the C++11 standard specifies that the elements of a
-      //   std::basic_string are stored continuously.
-      utf8Length, // Size of destination buffer, in chars.
-      nullptr, // WideCharToMultiByte requires the last two parameters to be
-      nullptr //   nullptrs when converting to UTF-8.
-  );
-
-  if (result == 0) {
-    throw UnicodeConversionException(
-        "Cannot convert from UTF-16 to UTF-8 (WideCharToMultiByte failed).", GetLastError());
+  // A small optimization.
+  if (utf8Len == 0) {
+    return utf16;
   }
 
-  return utf8;
+  // Each UTF-8 byte is converted to at most one UTF-16 code unit. A four byte sequence is converted to a
+  // surrogate pair. Note that the UTF-8 BOM is converted into the UTF-16BE BOM as any other character.
+  utf16.resize(utf8Len);
+  TrimResult(utf16, ConvertUtf8ToUtf16(reinterpret_cast<const uint8_t *>(utf8), utf8Len, &utf16[0]));
+  return utf16;
+}
+
+std::wstring Utf8ToUtf16(const char *utf8) {
+  return Utf8ToUtf16(utf8, strlen(utf8));
+}
+
+std::wstring Utf8ToUtf16(const std::string &utf8) {
+  return Utf8ToUtf16(utf8.c_str(), utf8.length());
+}
+
+#if _HAS_CXX17
+std::wstring Utf8ToUtf16(const std::string_view &utf8) {
+  return Utf8ToUtf16(utf8.data(), utf8.length());
+}
+#endif
+
+std::string Utf16ToUtf8(const wchar_t *utf16, size_t utf16Len) {
+  return Utf16ToUtf8Impl(utf16, utf16Len);
 }
 
 std::string Utf16ToUtf8(const char16_t *utf16, size_t utf16Len) {
-  return Utf16ToUtf8(Utilities::CheckedReinterpretCast<const wchar_t *>(utf16), utf16Len);
+  return Utf16ToUtf8Impl(utf16, utf16Len);
 }
 
 std::string Utf16ToUtf8(const wchar_t *utf16) {
@@ -187,7 +313,7 @@ std::string Utf16ToUtf8(const std::wstring &utf16) {
 }
 
 std::string Utf16ToUtf8(const std::u16string &utf16) {
-  return Utf16ToUtf8(Utilities::CheckedReinterpretCast<const wchar_t *>(utf16.c_str()), utf16.length());
+  return Utf16ToUtf8(utf16.c_str(), utf16.length());
 }
 
 #if _HAS_CXX17
@@ -196,7 +322,7 @@ std::string Utf16ToUtf8(const std::wstring_view &utf16) {
 }
 
 std::string Utf16ToUtf8(const std::u16string_view &utf16) {
-  return Utf16ToUtf8(Utilities::CheckedReinterpretCast<const wchar_t *>(utf16.data()), utf16.length());
+  return Utf16ToUtf8(utf16.data(), utf16.length());
 }
 #endif
 
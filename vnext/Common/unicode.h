@@ -13,9 +13,11 @@ namespace Microsoft::Common::Unicode {
 
 // All functions in this header offer the strong exception safety guarantee and
 // may throw the following exceptions:
-//   - std::bad_alloc,
-//   - std::overflow_error, and
-//   - UnicodeConversionException (defined below).
+//   - std::bad_alloc, and
+//   - std::overflow_error.
+//
+// Invalid sequences are replaced with U+FFFD instead of throwing an exception.
+// UnicodeConversionException is no longer thrown by these functions.
 //
 class UnicodeConversionException : public std::runtime_error {
  public:
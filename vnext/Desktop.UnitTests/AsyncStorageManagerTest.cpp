@@ -237,6 +237,78 @@ TEST_CLASS (AsyncStorageManagerTest) {
 
     lock.unlock();
   }
+
+  TEST_METHOD(AsyncStorageManagerTest_WriteBatchCallbacksInOrder) {
+    AsyncStorageManager kvManager(this->m_storageFileName);
+    std::function<void(vector<folly::dynamic>)> callback = storeCallbackArgAndNotify;
+
+    // Clear the storage.
+    std::unique_lock<std::recursive_mutex> lock(m);
+    kvManager.executeKVOperation(
+        AsyncStorageManager::AsyncStorageOperation::clear,
+        FollyDynamicConverter::stringVectorAsRetVal(emptyStringVector),
+        callback);
+    cv.wait(lock);
+
+    Assert::IsTrue(returnedValues[0] == dynamicNULL);
+
+    // Queue a burst of writes. Every callback records its index so that we can
+    // verify that the batched requests still complete in order.
+    const int numOperations = 512;
+    vector<int> completionOrder;
+    for (int i = 0; i < numOperations; i++) {
+      folly::dynamic jsArgs = folly::dynamic::array;
+      if (i % 4 == 3) {
+        vector<string> removeArgs = {SAMPLE_KEY_1 + std::to_string(i - 1)};
+        jsArgs.push_back(FollyDynamicConverter::stringVectorAsRetVal(removeArgs));
+      } else {
+        vector<tuple<string, string>> setArgs = {make_tuple(SAMPLE_KEY_1 + std::to_string(i), SAMPLE_VAL_1)};
+        jsArgs.push_back(FollyDynamicConverter::tupleStringVectorAsRetVal(setArgs));
+      }
+
+      kvManager.executeKVOperation(
+          i % 4 == 3 ? AsyncStorageManager::AsyncStorageOperation::multiRemove
+                     : AsyncStorageManager::AsyncStorageOperation::multiSet,
+          jsArgs,
+          [&completionOrder, i, numOperations](vector<folly::dynamic> args) {
+            std::lock_guard<std::recursive_mutex> lock(m);
+            Assert::IsTrue(args[0] == dynamicNULL);
+            completionOrder.push_back(i);
+            if (i == numOperations - 1)
+              cv.notify_one();
+          });
+    }
+    cv.wait(lock, [&completionOrder, numOperations] { return completionOrder.size() == static_cast<size_t>(numOperations); });
+
+    for (int i = 0; i < numOperations; i++)
+      Assert::AreEqual(i, completionOrder[i]);
+
+    auto metrics = kvManager.getWriteBatchMetrics();
+    Assert::AreEqual(static_cast<uint64_t>(numOperations), metrics.requestCount);
+    Assert::IsTrue(metrics.batchCount >= 1 && metrics.batchCount <= static_cast<uint64_t>(numOperations));
+    Assert::IsTrue(metrics.maxBatchSize >= metrics.lastBatchSize);
+
+    // Every fourth request removed the key written right before it.
+    kvManager.executeKVOperation(
+        AsyncStorageManager::AsyncStorageOperation::getAllKeys,
+        FollyDynamicConverter::stringVectorAsRetVal(emptyStringVector),
+        callback);
+    folly::dynamic jsRetValues = folly::dynamic::array;
+    jsRetValues.push_back(returnedValues[1]);
+    size_t returnedSize = FollyDynamicConverter::jsArgAsStringVector(jsRetValues).size();
+    Assert::AreEqual(static_cast<size_t>(numOperations / 2), returnedSize);
+
+    // Clear the storage.
+    kvManager.executeKVOperation(
+        AsyncStorageManager::AsyncStorageOperation::clear,
+        FollyDynamicConverter::stringVectorAsRetVal(emptyStringVector),
+        callback);
+    cv.wait(lock);
+
+    Assert::IsTrue(returnedValues[0] == dynamicNULL);
+
+    lock.unlock();
+  }
 };
 
 } // namespace Microsoft::React::Test
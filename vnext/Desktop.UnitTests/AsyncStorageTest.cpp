@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
+#include <atomic>
 #include <future>
 #include <map>
 #include <memory>
@@ -9585,6 +9586,44 @@ using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
 namespace Microsoft::React::Test {
 
+// Counts the snapshot file writes of the compaction and fails them on demand.
+class FailingStorageFileIO : public StorageFileIO {
+ public:
+  FailingStorageFileIO(const WCHAR *storageFileName, atomic_bool &failSnapshotWrites, atomic<int> &snapshotWriteCount)
+      : StorageFileIO(storageFileName),
+        m_failSnapshotWrites{failSnapshotWrites},
+        m_snapshotWriteCount{snapshotWriteCount} {}
+
+  void writeSnapshotFile(uint32_t generation, const std::string &fileContent) override {
+    m_snapshotWriteCount++;
+    if (m_failSnapshotWrites)
+      throw std::exception("Injected snapshot file write failure.");
+
+    StorageFileIO::writeSnapshotFile(generation, fileContent);
+  }
+
+ private:
+  atomic_bool &m_failSnapshotWrites;
+  atomic<int> &m_snapshotWriteCount;
+};
+
+// Fails the appends to the storage file on demand.
+class FailingAppendStorageFileIO : public StorageFileIO {
+ public:
+  FailingAppendStorageFileIO(const WCHAR *storageFileName, atomic_bool &failAppends)
+      : StorageFileIO(storageFileName), m_failAppends{failAppends} {}
+
+  void append(const std::string &fileContent) override {
+    if (m_failAppends)
+      throw std::exception("Injected storage file append failure.");
+
+    StorageFileIO::append(fileContent);
+  }
+
+ private:
+  atomic_bool &m_failAppends;
+};
+
 TEST_CLASS (AsyncStorageTest) {
  public:
   const WCHAR *m_storageFileName = L"testdomain";
@@ -9608,6 +9647,21 @@ TEST_CLASS (AsyncStorageTest) {
     DeleteFileW(myAppDataFilePath.c_str());
   }
 
+  // Snapshot files are named <storage file name>.<generation>.kvs and live
+  // next to the storage file.
+  std::wstring findSnapshotFile() {
+    const std::wstring anySnapshotFilePath = StorageFileIO(m_storageFileName).snapshotFilePath(0);
+    const std::wstring folderPath = anySnapshotFilePath.substr(0, anySnapshotFilePath.rfind(L'\\'));
+    const std::wstring pattern = folderPath + L"\\" + m_storageFileName + L".*.kvs";
+
+    WIN32_FIND_DATAW findData;
+    HANDLE findHandle = FindFirstFileW(pattern.c_str(), &findData);
+    Assert::IsTrue(findHandle != INVALID_HANDLE_VALUE, L"No snapshot file was written");
+    FindClose(findHandle);
+
+    return folderPath + L"\\" + findData.cFileName;
+  }
+
  public:
   TEST_METHOD(AsyncStorageTest_BasicRW) {
     auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
@@ -9849,6 +9903,358 @@ TEST_CLASS (AsyncStorageTest) {
 
     kvStorage->clear();
   }
+
+  TEST_METHOD(AsyncStorageTest_RemovePersistance) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    vector<string> removeVector = {"key1", "key4"};
+    vector<string> expectedKeys = {"key0", "key2", "key3", "key5", "key6", "key7", "key8", "key9"};
+
+    kvStorage->multiSet(TestData::BasicRW);
+    kvStorage->multiRemove(removeVector);
+
+    kvStorage = nullptr; // kill object
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName); // should load from file now
+
+    auto allKeys = kvStorage->getAllKeys();
+    Assert::IsTrue(allKeys == expectedKeys, L"Removed keys were loaded from the storage file");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_CompactionPreservesData) {
+    // A low threshold makes the overwrites below trigger several compactions.
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName, 0.1f);
+    kvStorage->clear();
+
+    kvStorage->multiSet(TestData::RandomRW100);
+
+    vector<tuple<string, string>> expected;
+    for (int i = 0; i < 1024; i++) {
+      expected = {make_tuple("key0", "value" + std::to_string(i)), make_tuple("key1", std::to_string(i) + "\n\\")};
+      kvStorage->multiSet(expected);
+      kvStorage->multiRemove({"key2"});
+      kvStorage->multiSet({make_tuple("key2", "value2")});
+    }
+    expected.push_back(make_tuple("key2", "value2"));
+
+    vector<string> keys = {"key0", "key1", "key2"};
+    Assert::IsTrue(kvStorage->multiGet(keys) == expected, L"Read does not match write");
+
+    kvStorage = nullptr; // waits for a pending compaction
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName); // should load from file now
+
+    Assert::IsTrue(kvStorage->multiGet(keys) == expected, L"Read does not match write after compaction");
+    Assert::IsTrue(kvStorage->multiGet(TestKeys::RandomRW100) == TestData::RandomRW100);
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_FailedCompactionBacksOff) {
+    atomic_bool failSnapshotWrites{true};
+    atomic<int> snapshotWriteCount{0};
+    auto kvStorage = make_shared<KeyValueStorage>(
+        make_unique<FailingStorageFileIO>(this->m_storageFileName, failSnapshotWrites, snapshotWriteCount), 0.1f);
+    kvStorage->clear();
+
+    // Every overwrite adds a dead record, so that each write is over the
+    // compaction threshold. With retries after 64, 128 and 256 more records,
+    // the next retry is due only after the last write.
+    for (int i = 0; i < 1024; i++)
+      kvStorage->multiSet({make_tuple("key", to_string(i))});
+
+    kvStorage = nullptr; // waits for a pending compaction
+    Assert::IsTrue(snapshotWriteCount > 0, L"No compaction was attempted");
+    Assert::IsTrue(snapshotWriteCount <= 4, L"A failed compaction was retried without backing off");
+
+    // The storage file is intact, and compaction succeeds once the writes do.
+    failSnapshotWrites = false;
+    const int failedWriteCount = snapshotWriteCount;
+    kvStorage = make_shared<KeyValueStorage>(
+        make_unique<FailingStorageFileIO>(this->m_storageFileName, failSnapshotWrites, snapshotWriteCount), 0.1f);
+    vector<tuple<string, string>> expected = {make_tuple("key", "1023")};
+    Assert::IsTrue(kvStorage->multiGet({"key"}) == expected, L"Read does not match write after failed compactions");
+
+    kvStorage = nullptr; // waits for the compaction of the loaded log
+    Assert::IsTrue(snapshotWriteCount > failedWriteCount, L"Compaction was not retried after loading");
+
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(kvStorage->multiGet({"key"}) == expected, L"Read does not match write after compaction");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_FailedBatchCommitIsRetried) {
+    atomic_bool failAppends{false};
+    auto kvStorage =
+        make_shared<KeyValueStorage>(make_unique<FailingAppendStorageFileIO>(this->m_storageFileName, failAppends));
+    kvStorage->clear();
+    kvStorage->multiSet({make_tuple("removedKey", "removed")});
+
+    failAppends = true;
+    kvStorage->beginBatch();
+    kvStorage->multiSet({make_tuple("failedKey", "failed")});
+    kvStorage->multiRemove({"removedKey"});
+
+    bool threw = false;
+    try {
+      kvStorage->commitBatch();
+    } catch (const std::exception &) {
+      threw = true;
+    }
+    Assert::IsTrue(threw, L"A batch that could not be written was committed");
+
+    // Readers do not see the changes of a batch that is not durable.
+    vector<tuple<string, string>> expected = {make_tuple("removedKey", "removed")};
+    Assert::IsTrue(kvStorage->multiGet({"failedKey", "removedKey", "addedKey"}) == expected);
+
+    // The next batch writes the records of the failed one as well.
+    failAppends = false;
+    kvStorage->beginBatch();
+    kvStorage->multiSet({make_tuple("addedKey", "added")});
+    kvStorage->commitBatch();
+
+    expected = {make_tuple("failedKey", "failed"), make_tuple("addedKey", "added")};
+    Assert::IsTrue(kvStorage->multiGet({"failedKey", "removedKey", "addedKey"}) == expected);
+
+    kvStorage = nullptr;
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(
+        kvStorage->multiGet({"failedKey", "removedKey", "addedKey"}) == expected,
+        L"The records of the failed batch were not written again");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_SnapshotFilePersistance) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    kvStorage->multiSet(TestData::RandomRW1024);
+
+    kvStorage = nullptr; // waits for the compaction into a snapshot file
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(kvStorage->multiGet(TestKeys::RandomRW1024) == TestData::RandomRW1024);
+
+    // Changes on top of the snapshot file: overwrite, remove and add keys.
+    const string &updatedKey = get<0>(TestData::RandomRW1024[0]);
+    const string &removedKey = get<0>(TestData::RandomRW1024[1]);
+    kvStorage->multiSet({make_tuple(updatedKey, "updated"), make_tuple("addedKey", "added")});
+    kvStorage->multiRemove({removedKey});
+
+    kvStorage = nullptr;
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+
+    vector<tuple<string, string>> expected = {make_tuple(updatedKey, "updated"), make_tuple("addedKey", "added")};
+    Assert::IsTrue(kvStorage->multiGet({updatedKey, removedKey, "addedKey"}) == expected);
+    Assert::AreEqual(TestKeys::RandomRW1024.size(), kvStorage->getAllKeys().size());
+
+    kvStorage->clear();
+    Assert::IsTrue(kvStorage->getAllKeys().empty(), L"Clear did not drop the snapshot file");
+
+    kvStorage = nullptr;
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(kvStorage->getAllKeys().empty(), L"Clear did not persist");
+  }
+
+  TEST_METHOD(AsyncStorageTest_IOErrorKeepsStorageFiles) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    kvStorage->multiSet(TestData::RandomRW1024);
+    kvStorage = nullptr; // waits for the compaction into a snapshot file
+
+    // Mapping a snapshot file that is open without sharing fails with a
+    // sharing violation, which must not discard the storage.
+    HANDLE snapshotFile = CreateFileW(
+        findSnapshotFile().c_str(), GENERIC_READ, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    Assert::IsTrue(snapshotFile != INVALID_HANDLE_VALUE);
+
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    for (int i = 0; i < 2; i++) {
+      bool threw = false;
+      try {
+        kvStorage->multiGet(TestKeys::BasicRW);
+      } catch (const std::exception &) {
+        threw = true;
+      }
+      Assert::IsTrue(threw, L"Storage that failed to load was used");
+    }
+
+    kvStorage = nullptr;
+    CloseHandle(snapshotFile);
+
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(
+        kvStorage->multiGet(TestKeys::RandomRW1024) == TestData::RandomRW1024, L"Storage was discarded on an I/O error");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_MigratesTextStorageFile) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+    kvStorage = nullptr;
+
+    // A storage file in the format written before snapshot files existed.
+    {
+      StorageFileIO storageFile(this->m_storageFileName);
+      storageFile.append("$key0\n%value0\n$key1\n%value1\n$key2\n%a\\nb\n$key1\nR\n$key0\n%new value0\n");
+      storageFile.flush();
+    }
+
+    vector<string> keys = {"key0", "key1", "key2"};
+    vector<tuple<string, string>> expected = {make_tuple("key0", "new value0"), make_tuple("key2", "a\nb")};
+
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(kvStorage->multiGet(keys) == expected, L"Text storage file was not loaded");
+
+    kvStorage = nullptr; // waits for the migration
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(kvStorage->multiGet(keys) == expected, L"Migrated storage file was not loaded");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_MergeNestedObjects) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    kvStorage->multiSet({make_tuple("user", R"({"name":"Ann","prefs":{"theme":"dark","font":{"size":12}},"tags":[1,2]})")});
+    kvStorage->multiMerge(
+        {make_tuple("user", R"({"prefs":{"font":{"family":"Segoe"},"lang":"en"},"tags":[3],"age":30})"),
+         make_tuple("newKey", R"( { "a" : [ {"b":1} ] } )")});
+
+    vector<tuple<string, string>> expected = {
+        make_tuple("user", R"({"name":"Ann","prefs":{"theme":"dark","font":{"size":12,"family":"Segoe"},"lang":"en"},"tags":[3],"age":30})"),
+        make_tuple("newKey", R"({"a":[ {"b":1} ]})")};
+    vector<string> keys = {"user", "newKey"};
+    Assert::IsTrue(kvStorage->multiGet(keys) == expected, L"Merge result does not match");
+
+    // Merged values are persisted like any other write.
+    kvStorage = nullptr;
+    kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    Assert::IsTrue(kvStorage->multiGet(keys) == expected, L"Merge result was not persisted");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_MergeReplacesNonObjects) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    kvStorage->multiSet({make_tuple("key", R"({"a":{"b":1},"c":{"d":2},"e":"f"})")});
+
+    // A member that is not an object on both sides is replaced, and a member
+    // name is matched by its decoded value. A key merged twice in one call
+    // merges into the result of the first merge.
+    kvStorage->multiMerge(
+        {make_tuple("key", R"({"a":null,"c":[1],"\u0065":"g"})"), make_tuple("key", R"({"a":{"x":true}})")});
+
+    vector<tuple<string, string>> expected = {make_tuple("key", R"({"a":{"x":true},"c":[1],"e":"g"})")};
+    Assert::IsTrue(kvStorage->multiGet({"key"}) == expected, L"Merge result does not match");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_MergeDuplicateMemberNames) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    // Like JSON.parse, the last value of a member name wins, also when it is
+    // an object nested in an array or in another object.
+    kvStorage->multiSet({make_tuple("key", R"({"a":{"b":1},"a":{"c":2},"d":[{"e":{}}],"f":{"g":{"h":1},"g":5}})")});
+    kvStorage->multiMerge({make_tuple("key", R"({"a":{"x":3},"f":{"g":{"y":4}}})")});
+
+    vector<tuple<string, string>> expected = {
+        make_tuple("key", R"({"a":{"c":2,"x":3},"d":[{"e":{}}],"f":{"g":{"y":4}}})")};
+    Assert::IsTrue(kvStorage->multiGet({"key"}) == expected, L"Merge result does not match");
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_MergeInvalidJson) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    vector<tuple<string, string>> stored = {make_tuple("valid", R"({"a":1})"), make_tuple("notJson", "plain text")};
+    kvStorage->multiSet(stored);
+
+    vector<vector<tuple<string, string>>> invalidMerges = {
+        {make_tuple("valid", R"({"a":)")},
+        {make_tuple("valid", R"([1,2])")},
+        {make_tuple("valid", R"({"a":1} trailing)")},
+        {make_tuple("valid", R"({"a":"\x"})")},
+        {make_tuple("valid", R"({"b":2})"), make_tuple("notJson", R"({"a":1})")},
+        {make_tuple("missing", "")}};
+
+    for (auto const &merge : invalidMerges) {
+      bool threw = false;
+      try {
+        kvStorage->multiMerge(merge);
+      } catch (const std::exception &) {
+        threw = true;
+      }
+      Assert::IsTrue(threw, L"Invalid JSON was merged");
+    }
+
+    // A failed merge does not change any key, not even the valid ones.
+    Assert::IsTrue(kvStorage->multiGet({"valid", "notJson"}) == stored, L"A failed merge changed the table");
+    Assert::AreEqual(stored.size(), kvStorage->getAllKeys().size());
+
+    kvStorage->clear();
+  }
+
+  TEST_METHOD(AsyncStorageTest_ConcurrentReadsSeeConsistentSnapshots) {
+    auto kvStorage = make_shared<KeyValueStorage>(this->m_storageFileName);
+    kvStorage->clear();
+
+    // The writer always sets both keys to the same value in one multiSet, or
+    // removes both in one multiRemove. Readers must never observe a mix.
+    vector<string> keys = {"pairA", "pairB"};
+    kvStorage->multiSet({make_tuple("pairA", "0"), make_tuple("pairB", "0")});
+
+    atomic_bool stop{false};
+    atomic<int> readCount{0};
+    atomic<int> tornReadCount{0};
+
+    auto reader = [&]() {
+      while (!stop) {
+        auto results = kvStorage->multiGet(keys);
+        if (!results.empty() && (results.size() != 2 || get<1>(results[0]) != get<1>(results[1])))
+          tornReadCount++;
+
+        auto allKeys = kvStorage->getAllKeys();
+        if (allKeys.size() % 2 != 0)
+          tornReadCount++;
+
+        readCount++;
+      }
+    };
+
+    vector<future<void>> readers;
+    for (int i = 0; i < 4; i++)
+      readers.push_back(async(launch::async, reader));
+
+    for (int i = 1; i < 2048; i++) {
+      if (i % 16 == 0) {
+        kvStorage->multiRemove(keys);
+      } else {
+        string value = to_string(i);
+        kvStorage->multiSet({make_tuple("pairA", value), make_tuple("pairB", value)});
+      }
+    }
+
+    stop = true;
+    for (auto &r : readers)
+      r.get();
+
+    Assert::IsTrue(readCount > 0);
+    Assert::AreEqual(0, tornReadCount.load(), L"A reader observed a partially applied write");
+
+    kvStorage->clear();
+  }
 };
 
 } // namespace Microsoft::React::Test
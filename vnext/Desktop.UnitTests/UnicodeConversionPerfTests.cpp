@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <CppUnitTest.h>
+#include <windows.h>
+#include <cmath>
+#include <sstream>
+#include <string>
+#include "Unicode.h"
+#include "UnicodeTestStrings.h"
+
+using Microsoft::Common::Unicode::Utf16ToUtf8;
+using Microsoft::Common::Unicode::Utf8ToUtf16;
+using Microsoft::VisualStudio::CppUnitTestFramework::Assert;
+using Microsoft::VisualStudio::CppUnitTestFramework::Logger;
+
+namespace Microsoft::React::Test {
+
+#ifdef PERF_TESTS
+
+// Measures the throughput of Utf8ToUtf16 and Utf16ToUtf8 for payloads of at least 64 KB. The ASCII payload is
+// a batch of bridge messages, which is what the conversions see most of the time. The mixed payload is made of
+// the non-ASCII test strings, with two to four byte sequences.
+TEST_CLASS (UnicodeConversionPerfTests) {
+  static const uint32_t iterations = 2000;
+  static const size_t payloadSize = 64 * 1024;
+
+  static std::string MakeAsciiPayload() {
+    constexpr const char *message = R"([[12,34],[5,0],[[41,"RCTView",{"backgroundColor":4294967295,"flex":1}]],7])";
+    std::string payload;
+    while (payload.size() < payloadSize) {
+      payload += message;
+    }
+
+    return payload;
+  }
+
+  static std::string MakeMixedPayload() {
+    std::string payload;
+    while (payload.size() < payloadSize) {
+      for (const auto &utf8 : g_utf8TestStrings) {
+        payload += utf8;
+      }
+    }
+
+    return payload;
+  }
+
+  static void TimeUtf8ToUtf16(const char *testName, const std::string &utf8) {
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    size_t length = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      length += Utf8ToUtf16(utf8).length();
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    Assert::IsTrue(length > 0);
+    PrintResult(testName, iterations, accu.QuadPart);
+  }
+
+  static void TimeUtf16ToUtf8(const char *testName, const std::wstring &utf16) {
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    size_t length = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      length += Utf16ToUtf8(utf16).length();
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    Assert::IsTrue(length > 0);
+    PrintResult(testName, iterations, accu.QuadPart);
+  }
+
+  TEST_METHOD(TimeUtf8ToUtf16Ascii) {
+    TimeUtf8ToUtf16("TimeUtf8ToUtf16Ascii", MakeAsciiPayload());
+  }
+
+  TEST_METHOD(TimeUtf8ToUtf16Mixed) {
+    TimeUtf8ToUtf16("TimeUtf8ToUtf16Mixed", MakeMixedPayload());
+  }
+
+  TEST_METHOD(TimeUtf16ToUtf8Ascii) {
+    TimeUtf16ToUtf8("TimeUtf16ToUtf8Ascii", Utf8ToUtf16(MakeAsciiPayload()));
+  }
+
+  TEST_METHOD(TimeUtf16ToUtf8Mixed) {
+    TimeUtf16ToUtf8("TimeUtf16ToUtf8Mixed", Utf8ToUtf16(MakeMixedPayload()));
+  }
+
+  static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    Assert::IsTrue(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+       << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+    Logger::WriteMessage(ss.str().c_str());
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::React::Test
@@ -41,14 +41,12 @@ TEST_CLASS (UnicodeConversionTest) {
     Assert::IsTrue(Utf8ToUtf16(invalidUtf8) == L"\xfffd" + Utf8ToUtf16(invalidUtf8 + 1));
 
     // Although ed a3 a9 follows the correct binary format for a three byte
-    // UTF-8 sequence, the Unicode code point it encodes is not valid. While
-    // converting this string, Utf8ToUtf16 will not realize this until it
-    // encounters a9, upon which it will replace ed a3 with U+FFFD. Utf8ToUtf16
-    // will then try to interpret a9 on its own and, realizing that a9 can only
-    // be the third byte unit of a three byte UTF-8 sequence, will replace it
-    // with U+FFFD as well. Hence the result it outputs is U+FFFD U+FFFD.
+    // UTF-8 sequence, it encodes the surrogate U+D8E9, which is not valid.
+    // After ed the second byte must be in 80..9f, so ed is a maximal subpart
+    // on its own. Then a3 and a9 are continuation bytes without a lead byte.
+    // Each of the three is replaced with U+FFFD.
     constexpr const char *const anotherInvalidUtf8 = "\xed\xa3\xa9";
-    Assert::IsTrue(Utf8ToUtf16(anotherInvalidUtf8) == L"\xfffd\xfffd");
+    Assert::IsTrue(Utf8ToUtf16(anotherInvalidUtf8) == L"\xfffd\xfffd\xfffd");
   }
 
   TEST_METHOD(Utf16ToUtf8SimpleTestNoBom) {
@@ -71,6 +69,86 @@ TEST_CLASS (UnicodeConversionTest) {
     Assert::IsTrue(Utf16ToUtf8(invalidUtf16) == "\xef\xbf\xbd\x22");
   }
 
+  TEST_METHOD(Utf8ToUtf16TruncatedSequenceTest) {
+    // e2 82 must be followed by one more continuation byte. The truncated
+    // sequence is replaced with a single U+FFFD.
+    Assert::IsTrue(Utf8ToUtf16("\x61\xe2\x82") == L"\x0061\xfffd");
+    Assert::IsTrue(Utf8ToUtf16("\xe2\x82\x61") == L"\xfffd\x0061");
+
+    Assert::IsTrue(Utf8ToUtf16("\xf0\x9f\x98") == L"\xfffd");
+    Assert::IsTrue(Utf8ToUtf16("\xf0\x9f\x98\x61") == L"\xfffd\x0061");
+  }
+
+  TEST_METHOD(Utf8ToUtf16MaximalSubpartTest) {
+    // Invalid UTF-8 is replaced with one U+FFFD per maximal subpart. These are
+    // the examples of tables 3-8 to 3-11 of the Unicode Standard.
+
+    // c0 and c1 only start overlong encodings, and f5..ff only start code
+    // points above U+10FFFF. Each such byte is replaced on its own.
+    Assert::IsTrue(Utf8ToUtf16("\xc0\x80") == L"\xfffd\xfffd");
+    Assert::IsTrue(Utf8ToUtf16("\xc0\xaf\xe0\x80\xbf\xf0\x81\x82\x41") == std::wstring(8, L'\xfffd') + L"\x0041");
+
+    // ed a0 80 is the surrogate U+D800: ed is not followed by 80..9f.
+    Assert::IsTrue(Utf8ToUtf16("\xed\xa0\x80\xed\xbf\xbf\xed\xaf\x41") == std::wstring(8, L'\xfffd') + L"\x0041");
+
+    // f4 90 80 80 is above U+10FFFF: f4 is not followed by 80..8f.
+    Assert::IsTrue(
+        Utf8ToUtf16("\xf4\x91\x92\x93\xff\x41\x80\xbf\x42") ==
+        L"\xfffd\xfffd\xfffd\xfffd\xfffd\x0041\xfffd\xfffd\x0042");
+    Assert::IsTrue(Utf8ToUtf16("\xf4\x90\x80\x80") == L"\xfffd\xfffd\xfffd\xfffd");
+
+    // A truncated sequence is one maximal subpart.
+    Assert::IsTrue(Utf8ToUtf16("\xe1\x80\xe2\xf0\x91\x92\xf1\xbf\x41") == L"\xfffd\xfffd\xfffd\xfffd\x0041");
+
+    // The code points next to the excluded ranges are valid: U+0080, U+0800,
+    // U+D7FF, U+10000 and U+10FFFF.
+    Assert::IsTrue(
+        Utf8ToUtf16("\xc2\x80\xe0\xa0\x80\xed\x9f\xbf\xf0\x90\x80\x80\xf4\x8f\xbf\xbf") ==
+        L"\x0080\x0800\xd7ff\xd800\xdc00\xdbff\xdfff");
+  }
+
+  TEST_METHOD(Utf16ToUtf8UnpairedSurrogateTest) {
+    Assert::IsTrue(Utf16ToUtf8(u"\x0061\xD801") == "\x61\xef\xbf\xbd");
+    Assert::IsTrue(Utf16ToUtf8(u"\xDC01\xD801\xDC01") == "\xef\xbf\xbd\xf0\x90\x90\x81");
+  }
+
+  TEST_METHOD(Utf16ToUtf8NonBmpTest) {
+    // Each character is four bytes in UTF-8. With a 16-bit wchar_t it is a
+    // surrogate pair, and with a 32-bit wchar_t it is a single code unit that
+    // is converted to more than three bytes.
+    std::wstring utf16;
+    std::string expectedUtf8;
+    for (size_t i = 0; i < 100; ++i) {
+      utf16 += L"\U0001F600";
+      expectedUtf8 += "\xf0\x9f\x98\x80";
+    }
+
+    Assert::IsTrue(Utf16ToUtf8(utf16) == expectedUtf8);
+
+#if WCHAR_MAX > 0xFFFF
+    Assert::IsTrue(Utf16ToUtf8(std::wstring(100, 0x1F600)) == expectedUtf8);
+#endif
+  }
+
+  TEST_METHOD(LongAsciiConversionTest) {
+    // ASCII characters are converted in blocks. Make sure that a non-ASCII
+    // character is found at any position of a block.
+    for (size_t length = 0; length < 70; ++length) {
+      for (size_t position = 0; position <= length; ++position) {
+        std::string utf8(length, 'a');
+        std::wstring expectedUtf16(length, L'a');
+        if (position < length) {
+          utf8.replace(position, 1, "\xc3\xa9");
+          expectedUtf16[position] = L'\x00e9';
+        }
+
+        std::wstring utf16 = Utf8ToUtf16(utf8);
+        Assert::IsTrue(utf16 == expectedUtf16);
+        Assert::IsTrue(Utf16ToUtf8(utf16) == utf8);
+      }
+    }
+  }
+
   TEST_METHOD(SymmetricConversionNoBom) {
     for (size_t i = 0; i < g_utf8TestStrings.size(); ++i) {
       std::wstring utf16 = Utf8ToUtf16(g_utf8TestStrings[i]);
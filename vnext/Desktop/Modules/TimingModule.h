@@ -6,12 +6,11 @@
 #include <InstanceManager.h>
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/MessageQueueThread.h>
+#include <dispatchQueue/dispatchQueue.h>
 
 #include <chrono>
 #include <memory>
-#include <vector>
-
-#include <windows.h>
+#include <unordered_map>
 
 namespace facebook {
 namespace react {
@@ -19,56 +18,25 @@ namespace react {
 using DateTime = std::chrono::time_point<std::chrono::system_clock, std::chrono::milliseconds>;
 using TimeSpan = std::chrono::milliseconds;
 
-// Timer struct which holds timer id, target time, period between target time
-// and scheduling time and whether it needs to be repeated. Example:
-//           std::chrono::time_point targetTime =
-//           std::chrono::system_clock::now()+100ms; Timer timer = {12345,
-//           targetTime, 100ms, false};
+// Timer struct which holds the pending dispatch timer, the period between
+// due times and whether it needs to be repeated.
 struct Timer {
-  uint64_t Id;
-  DateTime DueTime;
+  Mso::DispatchTimer DispatchTimer;
   TimeSpan Period;
   bool Repeat;
 };
 
-// operator for push_heap and pop_heap
-bool operator<(const Timer &leftTimer, const Timer &rightTimer);
-
-// operator for find
-bool operator==(const Timer &leftTimer, const uint64_t id);
-
-// This class is a implementation of max heap to store Timer objects.
-// The front timer has the smallest due time.
-// Example:
-//           TimerQueue tq;
-//           tq.Push(Timer{1234, now()+100ms, 100ms, false});
-//           tq.Push(Timer{1235, now()+20ms, 20ms, false});
-//           tq.Push(Timer{1236, now()+50ms, 50ms, false});
-//           tq.Pop(); //pops timer id: 1235
-//           printf("%u", tq.Front().Id); // print 1236
-class TimerQueue {
- public:
-  void Push(Timer timer);
-  void Pop();
-  Timer &Front();
-  const Timer &Front() const;
-  bool Remove(uint64_t id);
-  bool IsEmpty() const;
-
- private:
-  // This vector is maintained as a max heap, where the front Timer has the
-  // smallest due time.
-  std::vector<Timer> m_timerVector;
-};
-
 // Helper class which implements createTimer, deleteTimer and setSendIdleEvents
-// for actual TimingModule Example:
+// for actual TimingModule. Pending timers wait in the dispatch queue timer
+// wheel, so creating and deleting a timer does not depend on the timer count.
+// Example:
 //           Timing timing;
 //           timing.createTimer(instance, id, duration, jsScheduleTime, repeat);
 //           timing.delete(id);
 class Timing : public std::enable_shared_from_this<Timing> {
  public:
-  Timing(const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread) : m_nativeThread(nativeThread) {}
+  Timing(const std::shared_ptr<facebook::react::MessageQueueThread> &nativeThread) noexcept
+      : m_nativeThread(nativeThread) {}
   ~Timing();
   void createTimer(
       std::weak_ptr<facebook::react::Instance> instance,
@@ -80,18 +48,14 @@ class Timing : public std::enable_shared_from_this<Timing> {
   void setSendIdleEvents(bool sendIdleEvents) noexcept;
 
  private:
-  static VOID CALLBACK
-  ThreadpoolTimerCallback(PTP_CALLBACK_INSTANCE Instance, PVOID Parameter, PTP_TIMER Timer) noexcept;
-  void OnTimerRaised() noexcept;
+  Mso::DispatchTimer ScheduleTimer(uint64_t id, TimeSpan delay) noexcept;
+  void OnTimerDue(uint64_t id) noexcept;
+  void CallReadyTimers() noexcept;
   void SetInstance(std::weak_ptr<facebook::react::Instance> instance) noexcept;
-  void SetKernelTimer(DateTime dueTime) noexcept;
-  void InitializeKernelTimer() noexcept;
-  void TimersChanged() noexcept;
-  void StopKernelTimer() noexcept;
-  bool KernelTimerIsAboutToFire() noexcept;
-  TimerQueue m_timerQueue;
-  PTP_TIMER m_threadpoolTimer = NULL;
-  DateTime m_dueTime;
+
+  // Timers are only accessed from the native thread.
+  std::unordered_map<uint64_t, Timer> m_timers;
+  folly::dynamic m_readyTimers = folly::dynamic::array();
 
   std::weak_ptr<facebook::react::Instance> m_wkInstance;
   std::weak_ptr<facebook::react::MessageQueueThread> m_nativeThread;
@@ -6,6 +6,7 @@
 #include "ViewManager.h"
 
 #include <glog/logging.h>
+#include <stdexcept>
 
 namespace facebook {
 namespace react {
@@ -17,7 +18,7 @@ void ShadowNodeDeleter::operator()(ShadowNode *node) {
 
 void ShadowNodeRegistry::addRootView(std::unique_ptr<ShadowNode, ShadowNodeDeleter> &&root, int64_t rootViewTag) {
   m_roots.insert(rootViewTag);
-  m_allNodes[rootViewTag] = std::move(root);
+  m_allNodes.InsertOrAssign(rootViewTag, std::move(root));
 }
 
 ShadowNode &ShadowNodeRegistry::getRoot(int64_t rootViewTag) {
@@ -31,20 +32,25 @@ void ShadowNodeRegistry::removeRootView(int64_t rootViewTag) {
 }
 
 void ShadowNodeRegistry::addNode(std::unique_ptr<ShadowNode, ShadowNodeDeleter> &&node, int64_t tag) {
-  m_allNodes[tag] = std::move(node);
+  m_allNodes.InsertOrAssign(tag, std::move(node));
 }
 
 ShadowNode *ShadowNodeRegistry::findNode(int64_t tag) {
-  auto iter = m_allNodes.find(tag);
-  return (iter != m_allNodes.end()) ? iter->second.get() : nullptr;
+  auto node = m_allNodes.Find(tag);
+  return node ? node->get() : nullptr;
 }
 
 ShadowNode &ShadowNodeRegistry::getNode(int64_t tag) {
-  return *m_allNodes.at(tag);
+  auto node = m_allNodes.Find(tag);
+  if (!node) {
+    throw std::out_of_range("ShadowNodeRegistry::getNode: unknown tag");
+  }
+
+  return **node;
 }
 
 void ShadowNodeRegistry::removeNode(int64_t tag) {
-  m_allNodes.erase(tag);
+  m_allNodes.Erase(tag);
 }
 
 void ShadowNodeRegistry::removeAllRootViews(const std::function<void(int64_t rootViewTag)> &fn) {
@@ -69,9 +75,7 @@ ShadowNode *ShadowNodeRegistry::getParentRootShadowNode(int64_t nodeTag) {
 }
 
 void ShadowNodeRegistry::ForAllNodes(const Mso::FunctorRef<void(int64_t, shadow_ptr const &) noexcept> &fnDo) noexcept {
-  for (auto &kvp : m_allNodes) {
-    fnDo(kvp.first, kvp.second);
-  }
+  m_allNodes.ForEach([&fnDo](int64_t tag, const shadow_ptr &node) noexcept { fnDo(tag, node); });
 }
 
 } // namespace react
@@ -3,8 +3,8 @@
 
 #pragma once
 #include <ShadowNode.h>
+#include <Utils/DenseTagMap.h>
 #include <functional/functorref.h>
-#include <map>
 
 namespace facebook {
 namespace react {
@@ -37,7 +37,7 @@ struct ShadowNodeRegistry {
 
  private:
   std::unordered_set<int64_t> m_roots;
-  std::map<int64_t, std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
+  Microsoft::ReactNative::DenseTagMap<std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
 };
 
 } // namespace react
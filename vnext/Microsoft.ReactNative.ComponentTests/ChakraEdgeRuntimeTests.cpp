@@ -1,9 +1,11 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT license.
 
+#include <JSI/ChakraRuntime.h>
 #include <JSI/ChakraRuntimeArgs.h>
 #include <JSI/ChakraRuntimeFactory.h>
 #include <gtest/gtest.h>
+#include <string>
 #include "jsi/test/testlib.h"
 
 using namespace Microsoft::JSI;
@@ -18,3 +20,83 @@ std::vector<RuntimeFactory> runtimeGenerators() {
 }
 
 } // namespace facebook::jsi
+
+namespace {
+
+using facebook::jsi::PropNameID;
+
+// The property id cache is an implementation detail of ChakraRuntime that is not visible through the JSI.
+ChakraRuntime &AsChakraRuntime(facebook::jsi::Runtime &runtime) {
+  auto chakraRuntime = dynamic_cast<ChakraRuntime *>(&runtime);
+  EXPECT_NE(nullptr, chakraRuntime);
+  return *chakraRuntime;
+}
+
+TEST(ChakraRuntimeTest, PropertyIdCacheHitsAndMisses) {
+  ChakraRuntimeArgs args{};
+  auto runtime = makeChakraRuntime(std::move(args));
+  auto const &stats = AsChakraRuntime(*runtime).GetPropertyIdCacheStats();
+  auto const initialStats = stats;
+
+  // The first lookup creates the property id, and the next ones find it in the front cache.
+  auto foo = PropNameID::forAscii(*runtime, "cacheTestFoo");
+  EXPECT_EQ(initialStats.Misses + 1, stats.Misses);
+  EXPECT_TRUE(PropNameID::compare(*runtime, foo, PropNameID::forAscii(*runtime, "cacheTestFoo")));
+  EXPECT_TRUE(PropNameID::compare(*runtime, foo, PropNameID::forUtf8(*runtime, std::string{"cacheTestFoo"})));
+  EXPECT_EQ(initialStats.FrontCacheHits + 2, stats.FrontCacheHits);
+  EXPECT_EQ(initialStats.TableHits, stats.TableHits);
+  EXPECT_EQ(initialStats.Misses + 1, stats.Misses);
+
+  // The front cache has fewer entries than the names below. The lookups that are not in the front cache
+  // any more are found in the table, and no property id is created again.
+  constexpr size_t nameCount = 200;
+  for (size_t i = 0; i < nameCount; ++i) {
+    PropNameID::forAscii(*runtime, "cacheTest" + std::to_string(i));
+  }
+
+  auto const afterFirstPass = stats;
+  EXPECT_EQ(initialStats.Misses + 1 + nameCount, afterFirstPass.Misses);
+  for (size_t i = 0; i < nameCount; ++i) {
+    auto name = "cacheTest" + std::to_string(i);
+    EXPECT_EQ(name, PropNameID::forAscii(*runtime, name).utf8(*runtime));
+  }
+
+  EXPECT_EQ(afterFirstPass.Misses, stats.Misses);
+  EXPECT_EQ(
+      nameCount,
+      (stats.FrontCacheHits - afterFirstPass.FrontCacheHits) + (stats.TableHits - afterFirstPass.TableHits));
+  EXPECT_LT(afterFirstPass.TableHits, stats.TableHits);
+}
+
+TEST(ChakraRuntimeTest, PropertyIdCacheIsLimited) {
+  ChakraRuntimeArgs args{};
+  auto runtime = makeChakraRuntime(std::move(args));
+  auto const &stats = AsChakraRuntime(*runtime).GetPropertyIdCacheStats();
+
+  // The table keeps at most 4096 property ids. Creating that many new names fills it up.
+  for (size_t i = 0; i < 4096; ++i) {
+    PropNameID::forAscii(*runtime, "capTest" + std::to_string(i));
+  }
+
+  // The names that do not fit into the table are not cached, but they still resolve.
+  auto const beforeStats = stats;
+  auto uncached = PropNameID::forAscii(*runtime, "capTestUncached");
+  auto uncachedAgain = PropNameID::forUtf8(*runtime, std::string{"capTestUncached"});
+  EXPECT_EQ(beforeStats.Misses + 2, stats.Misses);
+  EXPECT_EQ(beforeStats.FrontCacheHits, stats.FrontCacheHits);
+  EXPECT_EQ(beforeStats.TableHits, stats.TableHits);
+
+  EXPECT_EQ("capTestUncached", uncached.utf8(*runtime));
+  EXPECT_TRUE(PropNameID::compare(*runtime, uncached, uncachedAgain));
+
+  facebook::jsi::Object object{*runtime};
+  object.setProperty(*runtime, uncached, 42);
+  EXPECT_EQ(42, object.getProperty(*runtime, uncachedAgain).getNumber());
+  EXPECT_EQ(42, object.getProperty(*runtime, "capTestUncached").getNumber());
+
+  // The cached names are still found.
+  PropNameID::forAscii(*runtime, "capTest0");
+  EXPECT_EQ(beforeStats.Misses + 2, stats.Misses);
+}
+
+} // namespace
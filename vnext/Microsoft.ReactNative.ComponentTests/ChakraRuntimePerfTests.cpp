@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/ChakraRuntime.h>
+#include <JSI/ChakraRuntimeArgs.h>
+#include <JSI/ChakraRuntimeFactory.h>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Microsoft::JSI {
+
+#ifdef PERF_TESTS
+
+// Measures PropNameID::forAscii for each path of the ChakraRuntime property id cache: a hit in the front cache,
+// a hit in the intern table, and a miss that creates the property id with JsCreatePropertyId as it was done
+// before the cache existed. The cache counters are printed to show that each test takes the expected path.
+TEST_CLASS (ChakraRuntimePerfTests) {
+  static const uint32_t iterations = 1000000;
+
+  static std::vector<std::string> MakeNames(const char *prefix, size_t count) {
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+      names.push_back(prefix + std::to_string(i));
+    }
+
+    return names;
+  }
+
+  static ChakraRuntime &AsChakraRuntime(facebook::jsi::Runtime &runtime) {
+    auto chakraRuntime = dynamic_cast<ChakraRuntime *>(&runtime);
+    TestCheck(chakraRuntime != nullptr);
+    return *chakraRuntime;
+  }
+
+  static void TimeLookups(
+      const char *testName, facebook::jsi::Runtime &runtime, const std::vector<std::string> &names) {
+    auto const &stats = AsChakraRuntime(runtime).GetPropertyIdCacheStats();
+    auto const initialStats = stats;
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      facebook::jsi::PropNameID::forAscii(runtime, names[i % names.size()]);
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    PrintResult(testName, iterations, accu.QuadPart);
+    std::cout << testName << ": frontCacheHits=" << stats.FrontCacheHits - initialStats.FrontCacheHits
+              << "; tableHits=" << stats.TableHits - initialStats.TableHits
+              << "; misses=" << stats.Misses - initialStats.Misses << std::endl;
+  }
+
+  // A few names that are used all the time, such as the names of the bridge and TurboModule methods.
+  TEST_METHOD(TimePropertyIdFrontCacheHits) {
+    auto runtime = makeChakraRuntime(ChakraRuntimeArgs{});
+    TimeLookups("TimePropertyIdFrontCacheHits", *runtime, MakeNames("hot", 8));
+  }
+
+  // More names than the front cache has entries, so that most of the lookups go to the intern table.
+  TEST_METHOD(TimePropertyIdTableHits) {
+    auto runtime = makeChakraRuntime(ChakraRuntimeArgs{});
+    TimeLookups("TimePropertyIdTableHits", *runtime, MakeNames("warm", 1000));
+  }
+
+  // The intern table is full, so that every lookup creates the property id.
+  TEST_METHOD(TimePropertyIdMisses) {
+    auto runtime = makeChakraRuntime(ChakraRuntimeArgs{});
+    for (const auto &name : MakeNames("fill", 4096)) {
+      facebook::jsi::PropNameID::forAscii(*runtime, name);
+    }
+
+    TimeLookups("TimePropertyIdMisses", *runtime, MakeNames("cold", 8));
+  }
+
+  static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    TestCheck(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+       << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+    std::cout << ss.str() << std::endl;
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::JSI
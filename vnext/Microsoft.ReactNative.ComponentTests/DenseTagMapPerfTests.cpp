@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/DenseTagMap.h>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+
+namespace Microsoft::ReactNative {
+
+#ifdef PERF_TESTS
+
+// Compares DenseTagMap with the std::map that ShadowNodeRegistry and NativeUIManager::m_tagsToYogaNodes used
+// before. Each iteration replays a storm of 50k views: createView adds a node, manageChildren finds the parent
+// and the child, updateView finds the node again, a layout pass visits every node and removeRootView erases them.
+TEST_CLASS (DenseTagMapPerfTests) {
+  static const uint32_t iterations = 20;
+  static const int64_t nodeCount = 50000;
+
+  // React allocates the tags of views in steps of two.
+  static int64_t TagAt(int64_t index) noexcept {
+    return index * 2 + 2;
+  }
+
+  TEST_METHOD(TimeStdMapStorm) {
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile int64_t sink = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      std::map<int64_t, std::unique_ptr<int64_t>> map;
+      for (int64_t index = 0; index < nodeCount; ++index) {
+        const int64_t tag = TagAt(index);
+        map.emplace(tag, std::make_unique<int64_t>(tag));
+        sink = sink + *map.find(TagAt(index / 2))->second + *map.find(tag)->second;
+        sink = sink + *map.find(tag)->second;
+      }
+
+      for (auto &entry : map) {
+        sink = sink + *entry.second;
+      }
+
+      for (int64_t index = 0; index < nodeCount; ++index) {
+        map.erase(TagAt(index));
+      }
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    PrintResult("TimeStdMapStorm", iterations, accu.QuadPart);
+  }
+
+  TEST_METHOD(TimeDenseTagMapStorm) {
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile int64_t sink = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      DenseTagMap<std::unique_ptr<int64_t>> map;
+      for (int64_t index = 0; index < nodeCount; ++index) {
+        const int64_t tag = TagAt(index);
+        map.Emplace(tag, std::make_unique<int64_t>(tag));
+        sink = sink + **map.Find(TagAt(index / 2)) + **map.Find(tag);
+        sink = sink + **map.Find(tag);
+      }
+
+      map.ForEach([&sink](int64_t /*tag*/, std::unique_ptr<int64_t> &value) { sink = sink + *value; });
+
+      for (int64_t index = 0; index < nodeCount; ++index) {
+        map.Erase(TagAt(index));
+      }
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    PrintResult("TimeDenseTagMapStorm", iterations, accu.QuadPart);
+  }
+
+  static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    TestCheck(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+       << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+    std::cout << ss.str() << std::endl;
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/DenseTagMap.h>
+#include <string>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+static std::vector<int64_t> GetTags(DenseTagMap<std::string> &map) {
+  std::vector<int64_t> tags;
+  map.ForEach([&tags](int64_t tag, std::string & /*value*/) { tags.push_back(tag); });
+  return tags;
+}
+
+TEST_CLASS (DenseTagMapTest) {
+  TEST_METHOD(TestEmplaceFindErase) {
+    DenseTagMap<std::string> map;
+    TestCheck(map.Emplace(1, "one").second);
+    TestCheck(!map.Emplace(1, "uno").second);
+    TestCheckEqual("one", *map.Find(1));
+    TestCheckEqual("uno", map.InsertOrAssign(1, "uno"));
+    TestCheckEqual(1u, map.Size());
+
+    TestCheck(map.Find(2) == nullptr);
+    TestCheck(!map.Erase(2));
+    TestCheck(map.Erase(1));
+    TestCheck(map.Find(1) == nullptr);
+    TestCheckEqual(0u, map.Size());
+  }
+
+  TEST_METHOD(TestPageBoundary) {
+    // Pages have 1024 slots.
+    DenseTagMap<std::string> map;
+    map.Emplace(1023, "last");
+    map.Emplace(1024, "first");
+    map.Emplace(2047, "next");
+    TestCheckEqual("last", *map.Find(1023));
+    TestCheckEqual("first", *map.Find(1024));
+    TestCheck(map.Find(1025) == nullptr);
+    TestCheck(map.Find(2048) == nullptr);
+    TestCheck(map.Find(1 << 20) == nullptr);
+
+    // Releasing the page of 1023 must not affect the next page.
+    TestCheck(map.Erase(1023));
+    TestCheck(map.Find(1023) == nullptr);
+    TestCheckEqual("first", *map.Find(1024));
+
+    // The released page is allocated again.
+    map.Emplace(0, "zero");
+    TestCheckEqual("zero", *map.Find(0));
+    TestCheck((GetTags(map) == std::vector<int64_t>{0, 1024, 2047}));
+  }
+
+  TEST_METHOD(TestSparseTags) {
+    // Tags below 0 and from 2^26 are stored in the fallback map.
+    constexpr int64_t maxDenseTag = int64_t{1} << 26;
+    DenseTagMap<std::string> map;
+    map.Emplace(maxDenseTag, "sparse");
+    map.Emplace(maxDenseTag - 1, "dense");
+    map.Emplace(int64_t{1} << 40, "large");
+    map.Emplace(-5, "negative");
+    map.Emplace(7, "small");
+    TestCheckEqual(5u, map.Size());
+
+    TestCheckEqual("sparse", *map.Find(maxDenseTag));
+    TestCheckEqual("dense", *map.Find(maxDenseTag - 1));
+    TestCheckEqual("large", *map.Find(int64_t{1} << 40));
+    TestCheckEqual("negative", *map.Find(-5));
+    TestCheck(map.Find(maxDenseTag + 1) == nullptr);
+    TestCheck(map.Find(-4) == nullptr);
+
+    // The values are visited in ascending tag order, the same way as std::map.
+    TestCheck((GetTags(map) == std::vector<int64_t>{-5, 7, maxDenseTag - 1, maxDenseTag, int64_t{1} << 40}));
+
+    TestCheck(map.Erase(maxDenseTag));
+    TestCheck(!map.Erase(maxDenseTag));
+    TestCheck(map.Find(maxDenseTag) == nullptr);
+    TestCheckEqual(4u, map.Size());
+  }
+
+  TEST_METHOD(TestEraseDuringIteration) {
+    constexpr int64_t maxDenseTag = int64_t{1} << 26;
+    DenseTagMap<std::string> map;
+    std::vector<int64_t> tags{-2, -1, 1, 2, 1500, maxDenseTag, maxDenseTag + 1};
+    for (int64_t tag : tags) {
+      map.Emplace(tag, std::to_string(tag));
+    }
+
+    // Erase the current value and the next one. Erasing 1 and 2 empties their page while it is visited.
+    std::vector<int64_t> visited;
+    map.ForEach([&](int64_t tag, std::string &value) {
+      TestCheckEqual(std::to_string(tag), value);
+      visited.push_back(tag);
+      map.Erase(tag);
+      map.Erase(tag + 1);
+    });
+
+    TestCheck((visited == std::vector<int64_t>{-2, 1, 1500, maxDenseTag}));
+    TestCheckEqual(0u, map.Size());
+    TestCheck(GetTags(map).empty());
+
+    // The map is usable after the emptied pages were released.
+    map.Emplace(2, "two");
+    TestCheckEqual("two", *map.Find(2));
+    TestCheck((GetTags(map) == std::vector<int64_t>{2}));
+  }
+
+  TEST_METHOD(TestEraseOthersDuringIteration) {
+    DenseTagMap<std::string> map;
+    for (int64_t tag = 0; tag < 4; ++tag) {
+      map.Emplace(tag, std::to_string(tag));
+    }
+
+    std::vector<int64_t> visited;
+    map.ForEach([&](int64_t tag, std::string & /*value*/) {
+      visited.push_back(tag);
+      if (tag == 1) {
+        map.Erase(0);
+        map.Erase(3);
+      }
+    });
+
+    TestCheck((visited == std::vector<int64_t>{0, 1, 2}));
+    TestCheck((GetTags(map) == std::vector<int64_t>{1, 2}));
+  }
+};
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/PerfectHashMap.h>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+#ifdef PERF_TESTS
+
+static constexpr PerfectHashMapEntry<int> StyleProps[] = {
+    {"flexDirection", 0},
+    {"justifyContent", 1},
+    {"flexWrap", 2},
+    {"alignItems", 3},
+    {"alignSelf", 4},
+    {"alignContent", 5},
+    {"flex", 6},
+    {"flexGrow", 7},
+    {"flexShrink", 8},
+    {"flexBasis", 9},
+    {"position", 10},
+    {"overflow", 11},
+    {"display", 12},
+    {"direction", 13},
+    {"aspectRatio", 14},
+    {"left", 15},
+    {"top", 16},
+    {"right", 17},
+    {"bottom", 18},
+    {"end", 19},
+    {"start", 20},
+    {"width", 21},
+    {"minWidth", 22},
+    {"maxWidth", 23},
+    {"height", 24},
+    {"minHeight", 25},
+    {"maxHeight", 26},
+    {"margin", 27},
+    {"marginLeft", 28},
+    {"marginStart", 29},
+    {"marginTop", 30},
+    {"marginRight", 31},
+    {"marginEnd", 32},
+    {"marginBottom", 33},
+    {"marginHorizontal", 34},
+    {"marginVertical", 35},
+    {"padding", 36},
+    {"paddingLeft", 37},
+    {"paddingStart", 38},
+    {"paddingTop", 39},
+    {"paddingRight", 40},
+    {"paddingEnd", 41},
+    {"paddingBottom", 42},
+    {"paddingHorizontal", 43},
+    {"paddingVertical", 44},
+    {"borderWidth", 45},
+    {"borderLeftWidth", 46},
+    {"borderStartWidth", 47},
+    {"borderTopWidth", 48},
+    {"borderRightWidth", 49},
+    {"borderEndWidth", 50},
+    {"borderBottomWidth", 51},
+};
+
+// Seed 9 is the seed of the StyleYogaPropSetters table in NativeUIManager.cpp.
+static constexpr auto StylePropMap = MakePerfectHashMap<int, /*Seed:*/ 9>(StyleProps);
+
+// Compares the two ways NativeUIManager::StyleYogaNode has dispatched the keys of an updateView style payload:
+// comparing the key with every Yoga style prop name in turn, as the former if-else chain did, and one lookup in
+// a PerfectHashMap, as the StyleYogaPropSetters table does. The entries have the same names and order.
+TEST_CLASS (PerfectHashMapPerfTests) {
+  static const uint32_t iterations = 1000000;
+
+  // Keys of a typical View style payload, including props that are not Yoga style props.
+  static std::vector<std::string> MakeStylePayloadKeys() noexcept {
+    return {
+        "flexDirection",
+        "alignItems",
+        "justifyContent",
+        "width",
+        "height",
+        "marginTop",
+        "paddingHorizontal",
+        "borderWidth",
+        "borderBottomWidth",
+        "position",
+        "top",
+        "left",
+        "flex",
+        "backgroundColor",
+        "opacity",
+        "borderRadius"};
+  }
+
+  static int FindWithComparisons(const std::string &key) noexcept {
+    for (const auto &entry : StyleProps) {
+      if (key == entry.key) {
+        return entry.value;
+      }
+    }
+
+    return -1;
+  }
+
+  static int FindWithPerfectHash(const std::string &key) noexcept {
+    auto value = StylePropMap.Find(key);
+    return value ? *value : -1;
+  }
+
+  template <typename TFind>
+  static LONGLONG TimeDispatch(TFind && find) noexcept {
+    auto keys = MakeStylePayloadKeys();
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile int sink = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      for (const auto &key : keys) {
+        sink = sink + find(key);
+      }
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    return accu.QuadPart;
+  }
+
+  TEST_METHOD(TimeStylePropDispatchWithComparisons) {
+    auto accu = TimeDispatch([](const std::string &key) noexcept { return FindWithComparisons(key); });
+    PrintResult("TimeStylePropDispatchWithComparisons", iterations, accu);
+  }
+
+  TEST_METHOD(TimeStylePropDispatchWithPerfectHash) {
+    auto accu = TimeDispatch([](const std::string &key) noexcept { return FindWithPerfectHash(key); });
+    PrintResult("TimeStylePropDispatchWithPerfectHash", iterations, accu);
+  }
+
+  static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    TestCheck(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+       << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+    std::cout << ss.str() << std::endl;
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Utils/PerfectHashMap.h>
+
+namespace Microsoft::ReactNative {
+
+static constexpr PerfectHashMapEntry<int> TestEntries[] = {
+    {"margin", 0},
+    {"marginLeft", 1},
+    {"marginStart", 2},
+    {"marginTop", 3},
+    {"marginRight", 4},
+    {"marginEnd", 5},
+    {"marginBottom", 6},
+    {"marginHorizontal", 7},
+    {"marginVertical", 8},
+    {"padding", 9},
+    {"paddingLeft", 10},
+    {"paddingStart", 11},
+    {"paddingTop", 12},
+    {"paddingRight", 13},
+    {"paddingEnd", 14},
+    {"paddingBottom", 15},
+    {"", 16},
+};
+
+static constexpr auto TestMap = MakePerfectHashMap<int, /*Seed:*/ 2>(TestEntries);
+
+// The lookups are usable in constant expressions.
+static_assert(*TestMap.Find("paddingTop") == 12);
+static_assert(TestMap.Find("paddingtop") == nullptr);
+
+TEST_CLASS (PerfectHashMapTest) {
+  TEST_METHOD(TestFindsEveryKey) {
+    for (const auto &entry : TestEntries) {
+      auto value = TestMap.Find(entry.key);
+      TestCheck(value != nullptr);
+      TestCheckEqual(entry.value, *value);
+    }
+  }
+
+  TEST_METHOD(TestRejectsNonKeys) {
+    TestCheck(TestMap.Find("border") == nullptr);
+    TestCheck(TestMap.Find("marginleft") == nullptr);
+    TestCheck(TestMap.Find("paddingVerticalX") == nullptr);
+    TestCheck(TestMap.Find("paddin") == nullptr);
+    TestCheck(TestMap.Find(std::string_view{"marginBottom"}.substr(0, 7)) == nullptr);
+  }
+
+  TEST_METHOD(TestSingleEntry) {
+    static constexpr auto map = MakePerfectHashMap<int>({{"flex", 1}});
+    TestCheckEqual(1, *map.Find("flex"));
+    TestCheck(map.Find("none") == nullptr);
+    TestCheck(map.Find("") == nullptr);
+  }
+};
+
+} // namespace Microsoft::ReactNative
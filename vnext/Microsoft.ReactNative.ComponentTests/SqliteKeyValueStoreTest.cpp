@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <AsyncStorage/SqliteKeyValueStore.h>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+// Returns the path of an empty database file in the temp folder.
+static std::string MakeDbPath(const char *name) {
+  auto path = std::filesystem::temp_directory_path() / (std::string("SqliteKeyValueStoreTest_") + name + ".db");
+  std::filesystem::remove(path);
+  return path.string();
+}
+
+static std::vector<std::string> GetKeys(const std::vector<std::pair<std::string, std::string>> &keyValuePairs) {
+  std::vector<std::string> keys;
+  for (const auto &kvp : keyValuePairs) {
+    keys.push_back(kvp.first);
+  }
+
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+TEST_CLASS (SqliteKeyValueStoreTest) {
+  TEST_METHOD(TestStatementsAreReusedAfterReset) {
+    SqliteKeyValueStore store(MakeDbPath("Reuse").c_str());
+    store.multiSet({{"a", "1"}, {"b", "2"}, {"c", "3"}, {"d", "4"}});
+
+    // Three and four keys both use the statement with four variables.
+    TestCheckEqual((std::vector<std::string>{"a", "b", "c"}), GetKeys(store.multiGet({"a", "b", "c"})));
+    const auto statementCount = store.cachedStatementCount();
+    TestCheckEqual((std::vector<std::string>{"a", "b", "c", "d"}), GetKeys(store.multiGet({"a", "b", "c", "d"})));
+    TestCheckEqual(statementCount, store.cachedStatementCount());
+
+    // The fourth variable must not keep the binding of the previous call.
+    TestCheckEqual((std::vector<std::string>{"a", "b", "c"}), GetKeys(store.multiGet({"a", "b", "c"})));
+    TestCheckEqual(statementCount, store.cachedStatementCount());
+
+    store.multiSet({{"a", "5"}});
+    store.multiRemove({"b", "c", "d"});
+    store.multiSet({{"e", "6"}});
+    store.multiRemove({"e"});
+    auto result = store.multiGet({"a", "b", "c", "d", "e"});
+    TestCheckEqual(1u, result.size());
+    TestCheckEqual("a", result[0].first);
+    TestCheckEqual("5", result[0].second);
+  }
+
+  TEST_METHOD(TestStatementsAreReusedAfterError) {
+    SqliteKeyValueStore store(MakeDbPath("Error").c_str());
+
+    // There is no savepoint to release.
+    TestCheckException(std::runtime_error, store.releaseSavepoint());
+
+    store.beginTransaction();
+    store.beginSavepoint();
+    store.multiSet({{"a", "1"}});
+    TestCheckNoThrow(store.releaseSavepoint());
+    store.commitTransaction();
+
+    TestCheckEqual((std::vector<std::string>{"a"}), store.getAllKeys());
+    const auto statementCount = store.cachedStatementCount();
+    TestCheckException(std::runtime_error, store.releaseSavepoint());
+    TestCheckEqual(statementCount, store.cachedStatementCount());
+    TestCheckEqual((std::vector<std::string>{"a"}), store.getAllKeys());
+  }
+
+  TEST_METHOD(TestStatementsAreFinalizedOnClose) {
+    const auto dbPath = MakeDbPath("Close");
+    {
+      SqliteKeyValueStore store(dbPath.c_str());
+      store.multiSet({{"a", "1"}, {"b", "2"}});
+      store.multiGet({"a", "b"});
+      store.multiRemove({"b"});
+      store.getAllKeys();
+      TestCheck(store.cachedStatementCount() > 0);
+
+      // Closing the connection fails if a statement is not finalized.
+      TestCheckNoThrow(store.close());
+      TestCheckEqual(0u, store.cachedStatementCount());
+      TestCheckNoThrow(store.close());
+    }
+
+    {
+      SqliteKeyValueStore store(dbPath.c_str());
+      TestCheckEqual((std::vector<std::string>{"a"}), store.getAllKeys());
+    }
+
+    // The file can only be removed once the connection is closed.
+    TestCheck(std::filesystem::remove(dbPath));
+  }
+};
+
+} // namespace facebook::react
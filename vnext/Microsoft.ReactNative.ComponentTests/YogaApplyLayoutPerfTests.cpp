@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <yoga/yoga.h>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+#ifdef PERF_TESTS
+
+// Compares the two ways to find the Yoga nodes with new layout after a layout pass that changed one leaf:
+// checking every node, as NativeUIManager::DoLayout did, and descending from the root only into the subtrees
+// with new layout, as NativeUIManager::ApplyLayout does.
+TEST_CLASS (YogaApplyLayoutPerfTests) {
+  static const uint32_t iterations = 1000;
+  static const uint32_t fanOut = 10;
+  static const uint32_t depth = 4;
+
+  struct SyntheticTree {
+    SyntheticTree() noexcept : config{YGConfigNew()}, root{AddNode(nullptr)} {
+      AddChildren(root, depth);
+    }
+
+    ~SyntheticTree() noexcept {
+      YGNodeFreeRecursive(root);
+      YGConfigFree(config);
+    }
+
+    YGNodeRef AddNode(YGNodeRef parent) noexcept {
+      YGNodeRef node = YGNodeNewWithConfig(config);
+      if (parent) {
+        YGNodeStyleSetHeight(node, 10);
+        YGNodeInsertChild(parent, node, YGNodeGetChildCount(parent));
+      }
+
+      nodes.push_back(node);
+      return node;
+    }
+
+    void AddChildren(YGNodeRef parent, uint32_t levels) noexcept {
+      if (levels == 0)
+        return;
+
+      for (uint32_t i = 0; i < fanOut; ++i) {
+        AddChildren(AddNode(parent), levels - 1);
+      }
+    }
+
+    YGConfigRef config;
+    std::vector<YGNodeRef> nodes;
+    YGNodeRef root;
+  };
+
+  static float ApplyLayoutToAllNodes(SyntheticTree & tree) noexcept {
+    float sum = 0;
+    for (YGNodeRef node : tree.nodes) {
+      if (YGNodeGetHasNewLayout(node)) {
+        YGNodeSetHasNewLayout(node, false);
+        sum += YGNodeLayoutGetTop(node) + YGNodeLayoutGetWidth(node);
+      }
+    }
+
+    return sum;
+  }
+
+  static float ApplyLayoutToChangedSubtrees(YGNodeRef node) noexcept {
+    if (!YGNodeGetHasNewLayout(node))
+      return 0;
+    YGNodeSetHasNewLayout(node, false);
+
+    float sum = YGNodeLayoutGetTop(node) + YGNodeLayoutGetWidth(node);
+    const uint32_t childCount = YGNodeGetChildCount(node);
+    for (uint32_t i = 0; i < childCount; ++i) {
+      sum += ApplyLayoutToChangedSubtrees(YGNodeGetChild(node, i));
+    }
+
+    return sum;
+  }
+
+  template <typename TApplyLayout>
+  static LONGLONG TimeApplyLayout(TApplyLayout && applyLayout) noexcept {
+    SyntheticTree tree;
+    YGNodeCalculateLayout(tree.root, 1000, YGUndefined, YGDirectionLTR);
+    applyLayout(tree);
+
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile float sink = 0;
+    for (uint32_t i = 0; i < iterations; ++i) {
+      // Only the layout of the last leaf and its ancestors changes.
+      YGNodeStyleSetWidth(tree.nodes.back(), static_cast<float>(i % 2 + 1));
+      YGNodeCalculateLayout(tree.root, 1000, YGUndefined, YGDirectionLTR);
+
+      QueryPerformanceCounter(&a);
+      sink = sink + applyLayout(tree);
+      QueryPerformanceCounter(&b);
+      accu.QuadPart += b.QuadPart - a.QuadPart;
+    }
+
+    return accu.QuadPart;
+  }
+
+  TEST_METHOD(TimeApplyLayoutToAllNodes) {
+    auto accu = TimeApplyLayout([](SyntheticTree &tree) noexcept { return ApplyLayoutToAllNodes(tree); });
+    PrintResult("TimeApplyLayoutToAllNodes", iterations, accu);
+  }
+
+  TEST_METHOD(TimeApplyLayoutToChangedSubtrees) {
+    auto accu =
+        TimeApplyLayout([](SyntheticTree &tree) noexcept { return ApplyLayoutToChangedSubtrees(tree.root); });
+    PrintResult("TimeApplyLayoutToChangedSubtrees", iterations, accu);
+  }
+
+  static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    TestCheck(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+       << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+    std::cout << ss.str() << std::endl;
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace Microsoft::ReactNative
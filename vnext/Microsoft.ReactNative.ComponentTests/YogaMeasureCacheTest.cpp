@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Views/YogaMeasureCache.h>
+#include <cmath>
+
+namespace Microsoft::ReactNative {
+
+static YogaMeasureCacheKey MakeTestKey(uint64_t contentHash, float rasterizationScale = 1.0f, float width = 100.0f) {
+  return MakeYogaMeasureCacheKey(
+      contentHash, /*styleHash:*/ 42, rasterizationScale, width, YGMeasureModeAtMost, NAN, YGMeasureModeUndefined);
+}
+
+TEST_CLASS (YogaMeasureCacheTest) {
+  TEST_METHOD(TestFindReturnsInsertedSize) {
+    YogaMeasureCache cache{4};
+    cache.Insert(MakeTestKey(1), YGSize{10, 20});
+
+    auto size = cache.Find(MakeTestKey(1));
+    TestCheck(size.has_value());
+    TestCheckEqual(10.0f, size->width);
+    TestCheckEqual(20.0f, size->height);
+    TestCheck(!cache.Find(MakeTestKey(2)).has_value());
+
+    auto counters = cache.GetCounters();
+    TestCheckEqual(1u, counters.Hits);
+    TestCheckEqual(1u, counters.Misses);
+  }
+
+  TEST_METHOD(TestUndefinedSizeIsIgnored) {
+    // Yoga passes NaN for undefined sizes. They must not prevent cache hits.
+    YogaMeasureCache cache{4};
+    cache.Insert(MakeYogaMeasureCacheKey(1, 2, 1.0f, NAN, YGMeasureModeUndefined, NAN, YGMeasureModeUndefined), {1, 2});
+    auto otherKey = MakeYogaMeasureCacheKey(1, 2, 1.0f, 5, YGMeasureModeUndefined, NAN, YGMeasureModeUndefined);
+    TestCheck(cache.Find(otherKey).has_value());
+  }
+
+  TEST_METHOD(TestKeyIncludesConstraintsAndScale) {
+    YogaMeasureCache cache{4};
+    cache.Insert(MakeTestKey(1), YGSize{10, 20});
+
+    TestCheck(!cache.Find(MakeTestKey(1, /*rasterizationScale:*/ 1.5f)).has_value());
+    TestCheck(!cache.Find(MakeTestKey(1, 1.0f, /*width:*/ 50.0f)).has_value());
+    auto exactlyKey = MakeYogaMeasureCacheKey(1, 42, 1.0f, 100.0f, YGMeasureModeExactly, NAN, YGMeasureModeUndefined);
+    TestCheck(!cache.Find(exactlyKey).has_value());
+    TestCheck(cache.Find(MakeTestKey(1)).has_value());
+  }
+
+  TEST_METHOD(TestEvictsLeastRecentlyUsed) {
+    YogaMeasureCache cache{3};
+    cache.Insert(MakeTestKey(1), YGSize{1, 1});
+    cache.Insert(MakeTestKey(2), YGSize{2, 2});
+    cache.Insert(MakeTestKey(3), YGSize{3, 3});
+
+    // Finding the oldest entry makes it the most recently used one.
+    TestCheck(cache.Find(MakeTestKey(1)).has_value());
+    cache.Insert(MakeTestKey(4), YGSize{4, 4});
+
+    TestCheck(cache.Find(MakeTestKey(1)).has_value());
+    TestCheck(!cache.Find(MakeTestKey(2)).has_value());
+    TestCheck(cache.Find(MakeTestKey(3)).has_value());
+    TestCheck(cache.Find(MakeTestKey(4)).has_value());
+  }
+
+  TEST_METHOD(TestInsertReplacesSizeAndRefreshesEntry) {
+    YogaMeasureCache cache{2};
+    cache.Insert(MakeTestKey(1), YGSize{1, 1});
+    cache.Insert(MakeTestKey(2), YGSize{2, 2});
+    cache.Insert(MakeTestKey(1), YGSize{5, 5});
+    cache.Insert(MakeTestKey(3), YGSize{3, 3});
+
+    auto size = cache.Find(MakeTestKey(1));
+    TestCheck(size.has_value());
+    TestCheckEqual(5.0f, size->width);
+    TestCheck(!cache.Find(MakeTestKey(2)).has_value());
+  }
+
+  TEST_METHOD(TestClearRemovesAllEntries) {
+    YogaMeasureCache cache{4};
+    cache.Insert(MakeTestKey(1), YGSize{1, 1});
+    cache.Insert(MakeTestKey(2), YGSize{2, 2});
+    cache.Clear();
+
+    TestCheck(!cache.Find(MakeTestKey(1)).has_value());
+    TestCheck(!cache.Find(MakeTestKey(2)).has_value());
+
+    // The cache is still usable after it was cleared.
+    cache.Insert(MakeTestKey(1), YGSize{1, 1});
+    TestCheck(cache.Find(MakeTestKey(1)).has_value());
+  }
+
+  TEST_METHOD(TestZeroCapacityCachesNothing) {
+    YogaMeasureCache cache{0};
+    cache.Insert(MakeTestKey(1), YGSize{1, 1});
+    TestCheck(!cache.Find(MakeTestKey(1)).has_value());
+  }
+};
+
+} // namespace Microsoft::ReactNative
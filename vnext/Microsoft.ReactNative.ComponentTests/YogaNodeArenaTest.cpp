@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <Modules/YogaNodeArena.h>
+#include <yoga/event/event.h>
+#include <unordered_set>
+#include <vector>
+
+using namespace facebook::yoga;
+
+namespace Microsoft::ReactNative {
+
+TEST_CLASS (YogaNodeArenaTest) {
+  TEST_METHOD(TestFreedSlotIsReused) {
+    YGConfigRef config = YGConfigNew();
+    {
+      YogaNodeArena arena;
+      YGNodeRef first = arena.NewNode(config);
+      YGNodeRef second = arena.NewNode(config);
+      TestCheck(first != second);
+      TestCheck(first->getConfig() == config);
+
+      YGNodeStyleSetFlexGrow(first, 2);
+      arena.FreeNode(first);
+
+      // The freed slot is used first, and the new node does not keep the old style.
+      YGNodeRef third = arena.NewNode(config);
+      TestCheck(third == first);
+      TestCheckEqual(0.0f, YGNodeStyleGetFlexGrow(third));
+
+      arena.FreeNode(second);
+      arena.FreeNode(third);
+    }
+    YGConfigFree(config);
+  }
+
+  TEST_METHOD(TestFreeDisconnectsOwnerAndChildren) {
+    YGConfigRef config = YGConfigNew();
+    {
+      YogaNodeArena arena;
+      YGNodeRef parent = arena.NewNode(config);
+      YGNodeRef firstChild = arena.NewNode(config);
+      YGNodeRef secondChild = arena.NewNode(config);
+      YGNodeInsertChild(parent, firstChild, 0);
+      YGNodeInsertChild(parent, secondChild, 1);
+
+      arena.FreeNode(firstChild);
+      TestCheckEqual(1u, YGNodeGetChildCount(parent));
+      TestCheck(YGNodeGetChild(parent, 0) == secondChild);
+
+      arena.FreeNode(parent);
+      TestCheck(YGNodeGetOwner(secondChild) == nullptr);
+
+      arena.FreeNode(secondChild);
+    }
+    YGConfigFree(config);
+  }
+
+  TEST_METHOD(TestReusesAllSlotsAfterReset) {
+    // Free all nodes of more than one slab and allocate them again: no new slab is needed.
+    constexpr size_t NodeCount = 300;
+    YGConfigRef config = YGConfigNew();
+    {
+      YogaNodeArena arena;
+      std::vector<YGNodeRef> nodes;
+      std::unordered_set<YGNodeRef> slots;
+      for (size_t i = 0; i < NodeCount; ++i) {
+        nodes.push_back(arena.NewNode(config));
+        slots.insert(nodes.back());
+      }
+
+      TestCheckEqual(NodeCount, slots.size());
+      for (YGNodeRef node : nodes) {
+        arena.FreeNode(node);
+      }
+
+      nodes.clear();
+      for (size_t i = 0; i < NodeCount; ++i) {
+        nodes.push_back(arena.NewNode(config));
+        TestCheck(slots.count(nodes.back()) == 1);
+        TestCheck(YGNodeGetOwner(nodes.back()) == nullptr);
+        TestCheckEqual(0u, YGNodeGetChildCount(nodes.back()));
+      }
+
+      for (YGNodeRef node : nodes) {
+        arena.FreeNode(node);
+      }
+    }
+    YGConfigFree(config);
+  }
+
+  TEST_METHOD(TestPublishesAllocationEvents) {
+    size_t allocationCount = 0;
+    size_t deallocationCount = 0;
+    Event::subscribe([&](const YGNode &, Event::Type type, Event::Data) {
+      if (type == Event::NodeAllocation) {
+        ++allocationCount;
+      } else if (type == Event::NodeDeallocation) {
+        ++deallocationCount;
+      }
+    });
+
+    YGConfigRef config = YGConfigNew();
+    {
+      YogaNodeArena arena;
+      YGNodeRef first = arena.NewNode(config);
+      YGNodeRef second = arena.NewNode(config);
+      TestCheckEqual(2u, allocationCount);
+      TestCheckEqual(0u, deallocationCount);
+
+      arena.FreeNode(first);
+      arena.FreeNode(second);
+      TestCheckEqual(2u, allocationCount);
+      TestCheckEqual(2u, deallocationCount);
+    }
+    YGConfigFree(config);
+    Event::reset();
+  }
+};
+
+} // namespace Microsoft::ReactNative
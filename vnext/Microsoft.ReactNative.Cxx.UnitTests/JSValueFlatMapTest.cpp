@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "JSValue.h"
+#include "JSValueFlatMap.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+using JSValueTestFlatMap = JSValueFlatMap<std::string, JSValue>;
+
+TEST_CLASS (JSValueFlatMapTest) {
+  TEST_METHOD(TestTryEmplaceKeepsKeysSorted) {
+    JSValueTestFlatMap map;
+    TestCheck(map.try_emplace("width", 10).second);
+    TestCheck(map.try_emplace("height", 20).second);
+    TestCheck(map.try_emplace("style", "bold").second);
+    TestCheck(!map.try_emplace("width", 30).second);
+
+    TestCheckEqual(3u, map.size());
+    auto it = map.begin();
+    TestCheckEqual("height", (it++)->first);
+    TestCheckEqual("style", (it++)->first);
+    TestCheckEqual("width", (it++)->first);
+    TestCheck(it == map.end());
+    TestCheckEqual(10, map.at("width").AsInt32());
+  }
+
+  TEST_METHOD(TestFind) {
+    JSValueTestFlatMap map;
+    // Use enough keys to switch from the linear search to the binary search.
+    for (int i = 0; i < 20; ++i) {
+      map.try_emplace("key" + std::to_string(i), i);
+    }
+
+    for (int i = 0; i < 20; ++i) {
+      std::string key = "key" + std::to_string(i);
+      auto it = map.find(std::string_view{key});
+      TestCheck(it != map.end());
+      TestCheckEqual(i, it->second.AsInt32());
+      TestCheckEqual(1u, map.count(key));
+    }
+
+    TestCheck(map.find("key") == map.end());
+    TestCheck(map.find("key99") == map.end());
+    TestCheckEqual(0u, map.count("key99"));
+  }
+
+  TEST_METHOD(TestInsertRangeKeepsFirstDuplicate) {
+    JSValueTestFlatMap map;
+    map.try_emplace("b", 1);
+
+    std::vector<std::pair<std::string, JSValue>> items;
+    items.emplace_back("c", 2);
+    items.emplace_back("a", 3);
+    items.emplace_back("b", 4);
+    items.emplace_back("a", 5);
+    map.insert(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+
+    TestCheckEqual(3u, map.size());
+    TestCheckEqual(3, map.at("a").AsInt32());
+    TestCheckEqual(1, map.at("b").AsInt32());
+    TestCheckEqual(2, map.at("c").AsInt32());
+    TestCheckEqual("a", map.begin()->first);
+  }
+
+  TEST_METHOD(TestEmplaceHint) {
+    JSValueTestFlatMap map;
+    map.emplace_hint(map.end(), "a", 1);
+    map.emplace_hint(map.end(), "c", 3);
+    // The wrong hint is ignored.
+    map.emplace_hint(map.end(), "b", 2);
+    map.emplace_hint(map.begin(), "b", 4);
+
+    TestCheckEqual(3u, map.size());
+    auto it = map.begin();
+    TestCheckEqual("a", (it++)->first);
+    TestCheckEqual("b", it->first);
+    TestCheckEqual(2, (it++)->second.AsInt32());
+    TestCheckEqual("c", (it++)->first);
+  }
+
+  TEST_METHOD(TestInsertOrAssignAndErase) {
+    JSValueTestFlatMap map;
+    TestCheck(map.insert_or_assign("x", 1).second);
+    TestCheck(!map.insert_or_assign("x", 2).second);
+    TestCheckEqual(2, map.at("x").AsInt32());
+
+    map.try_emplace("y", 3);
+    TestCheckEqual(1u, map.erase("x"));
+    TestCheckEqual(0u, map.erase("x"));
+    TestCheckEqual(1u, map.size());
+    map.erase(map.begin());
+    TestCheck(map.empty());
+  }
+
+  TEST_METHOD(TestTreeWriterBuildsNestedValues) {
+    IJSValueWriter writer = MakeJSValueTreeWriter();
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"style");
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"width");
+    writer.WriteInt64(10);
+    writer.WritePropertyName(L"height");
+    writer.WriteInt64(20);
+    writer.WriteObjectEnd();
+    writer.WritePropertyName(L"items");
+    writer.WriteArrayBegin();
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"id");
+    writer.WriteInt64(1);
+    writer.WriteObjectEnd();
+    writer.WriteObjectBegin();
+    writer.WritePropertyName(L"id");
+    writer.WriteInt64(2);
+    writer.WritePropertyName(L"id");
+    writer.WriteInt64(3);
+    writer.WriteObjectEnd();
+    writer.WriteArrayEnd();
+    writer.WriteObjectEnd();
+
+    JSValue value = TakeJSValue(writer);
+    TestCheck(value.Equals(JSValueObject{
+        {"style", JSValueObject{{"width", 10}, {"height", 20}}},
+        {"items", JSValueArray{JSValueObject{{"id", 1}}, JSValueObject{{"id", 2}}}}}));
+  }
+};
+
+} // namespace winrt::Microsoft::ReactNative
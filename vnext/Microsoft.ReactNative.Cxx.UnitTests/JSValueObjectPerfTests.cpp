@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "JSValue.h"
+#include "JSValueFlatMap.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+#ifdef PERF_TESTS
+
+using JSValuePerfFlatMap = JSValueFlatMap<std::string, JSValue>;
+
+// Compares JSValueObject, which is based on std::map, with JSValueFlatMap for the small objects that the
+// view managers receive as props: building the object, reading every prop by name and copying the object.
+TEST_CLASS (JSValueObjectPerfTests) {
+  static const uint32_t iterations = 200000;
+
+  // Keys of a typical View props payload.
+  static std::vector<std::string> MakePropKeys() noexcept {
+    return {
+        "accessibilityLabel",
+        "backgroundColor",
+        "borderRadius",
+        "borderWidth",
+        "flexDirection",
+        "height",
+        "nativeID",
+        "opacity",
+        "overflow",
+        "pointerEvents",
+        "testID",
+        "width"};
+  }
+
+  template <class TMap>
+  static TMap BuildProps(const std::vector<std::string> &keys) noexcept {
+    TMap props;
+    int64_t value = 0;
+    for (const auto &key : keys) {
+      props.try_emplace(key, ++value);
+    }
+
+    return props;
+  }
+
+  template <class TMap>
+  static TMap CopyProps(const TMap &props) noexcept {
+    TMap copy;
+    for (const auto &prop : props) {
+      copy.try_emplace(prop.first, prop.second.Copy());
+    }
+
+    return copy;
+  }
+
+  template <class TMap>
+  static void TimeBuild(const char *testName) noexcept {
+    auto keys = MakePropKeys();
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile size_t sink = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      sink = sink + BuildProps<TMap>(keys).size();
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    PrintResult(testName, iterations, accu.QuadPart);
+  }
+
+  template <class TMap>
+  static void TimeRead(const char *testName) noexcept {
+    auto keys = MakePropKeys();
+    auto props = BuildProps<TMap>(keys);
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile int64_t sink = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      for (const auto &key : keys) {
+        auto it = props.find(key);
+        sink = sink + it->second.AsInt64();
+      }
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    PrintResult(testName, iterations, accu.QuadPart);
+  }
+
+  template <class TMap>
+  static void TimeCopy(const char *testName) noexcept {
+    auto props = BuildProps<TMap>(MakePropKeys());
+    LARGE_INTEGER accu{0}, a{0}, b{0};
+    volatile size_t sink = 0;
+
+    QueryPerformanceCounter(&a);
+
+    for (uint32_t i = 0; i < iterations; ++i) {
+      sink = sink + CopyProps(props).size();
+    }
+
+    QueryPerformanceCounter(&b);
+    accu.QuadPart = b.QuadPart - a.QuadPart;
+
+    PrintResult(testName, iterations, accu.QuadPart);
+  }
+
+  TEST_METHOD(TimeJSValueObjectBuild) {
+    TimeBuild<JSValueObject>("TimeJSValueObjectBuild");
+  }
+
+  TEST_METHOD(TimeJSValueFlatMapBuild) {
+    TimeBuild<JSValuePerfFlatMap>("TimeJSValueFlatMapBuild");
+  }
+
+  TEST_METHOD(TimeJSValueObjectRead) {
+    TimeRead<JSValueObject>("TimeJSValueObjectRead");
+  }
+
+  TEST_METHOD(TimeJSValueFlatMapRead) {
+    TimeRead<JSValuePerfFlatMap>("TimeJSValueFlatMapRead");
+  }
+
+  TEST_METHOD(TimeJSValueObjectCopy) {
+    TimeCopy<JSValueObject>("TimeJSValueObjectCopy");
+  }
+
+  TEST_METHOD(TimeJSValueFlatMapCopy) {
+    TimeCopy<JSValuePerfFlatMap>("TimeJSValueFlatMapCopy");
+  }
+
+  static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+    LARGE_INTEGER freq{0};
+    TestCheck(QueryPerformanceFrequency(&freq));
+    std::stringstream ss;
+
+    double time = static_cast<double>(accu) / freq.QuadPart;
+    ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+       << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+    std::cout << ss.str() << std::endl;
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace winrt::Microsoft::ReactNative
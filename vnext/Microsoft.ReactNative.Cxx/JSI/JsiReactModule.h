@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSI_JSIREACTMODULE
+#define MICROSOFT_REACTNATIVE_JSI_JSIREACTMODULE
+
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include "../NativeModules.h"
+#include "JsiAbiApi.h"
+#include "JsiApiContext.h"
+#include "JsiValueCodec.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+using JsiMethod =
+    std::function<facebook::jsi::Value(facebook::jsi::Runtime &, facebook::jsi::Value const *, size_t)>;
+
+template <class TResult, class... TArgs>
+struct JsiMethodInfoBase {
+  using ArgTuple = std::tuple<RemoveConstRef<TArgs>...>;
+
+  // Reads arguments with JsiValueCodec, calls the method, and returns its result as a JSI value.
+  template <class TCall>
+  static JsiMethod MakeMethod(TCall &&call) noexcept {
+    return [call = std::forward<TCall>(call)](
+               facebook::jsi::Runtime &runtime, facebook::jsi::Value const *args, size_t count) mutable {
+      ArgTuple typedArgs{};
+      ReadJsiArgs(runtime, args, count, /*out*/ typedArgs);
+      if constexpr (IsVoidResultCheck<TResult>()) {
+        std::apply(call, std::move(typedArgs));
+        return facebook::jsi::Value::undefined();
+      } else {
+        return JsiValueCodec<TResult>::Write(runtime, std::apply(call, std::move(typedArgs)));
+      }
+    };
+  }
+};
+
+template <class TMethod>
+struct JsiMethodInfo;
+
+// Instance method
+template <class TModule, class TResult, class... TArgs>
+struct JsiMethodInfo<TResult (TModule::*)(TArgs...) noexcept> : JsiMethodInfoBase<TResult, TArgs...> {
+  using MethodType = TResult (TModule::*)(TArgs...) noexcept;
+
+  static JsiMethod GetMethod(void *module, MethodType method) noexcept {
+    return JsiMethodInfoBase<TResult, TArgs...>::MakeMethod(
+        [module = static_cast<TModule *>(module), method](auto &&... args) noexcept {
+          return (module->*method)(std::forward<decltype(args)>(args)...);
+        });
+  }
+};
+
+// Static method
+template <class TResult, class... TArgs>
+struct JsiMethodInfo<TResult (*)(TArgs...) noexcept> : JsiMethodInfoBase<TResult, TArgs...> {
+  using MethodType = TResult (*)(TArgs...) noexcept;
+
+  static JsiMethod GetMethod(void * /*module*/, MethodType method) noexcept {
+    return JsiMethodInfoBase<TResult, TArgs...>::MakeMethod([method](auto &&... args) noexcept {
+      return (*method)(std::forward<decltype(args)>(args)...);
+    });
+  }
+};
+
+// Exposes the module methods that can be called with JSI values directly.
+// It returns undefined for other members, so that the TurboModule creates them from the IReactModuleBuilder.
+struct JsiReactModuleHostObject : facebook::jsi::HostObject {
+  JsiReactModuleHostObject(
+      winrt::Windows::Foundation::IInspectable const &module,
+      std::unordered_map<std::string, JsiMethod> &&methods) noexcept
+      : m_module{module}, m_methods{std::move(methods)} {}
+
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, facebook::jsi::PropNameID const &propName) override {
+    auto key = propName.utf8(runtime);
+    auto it = m_methods.find(key);
+    if (it == m_methods.end()) {
+      return facebook::jsi::Value::undefined();
+    }
+
+    // The functions and struct property names are cached only for the first runtime that accesses the module.
+    if (m_functionsRuntime == nullptr) {
+      m_functionsRuntime = &runtime;
+      m_propNameCache = std::make_shared<JsiPropNameCache>(runtime);
+    }
+
+    bool isFunctionsRuntime = m_functionsRuntime == &runtime;
+    if (isFunctionsRuntime) {
+      auto functionIt = m_functions.find(key);
+      if (functionIt != m_functions.end()) {
+        return {runtime, functionIt->second};
+      }
+    }
+
+    auto function = facebook::jsi::Function::createFromHostFunction(
+        runtime,
+        propName,
+        0,
+        [method = it->second,
+         weakPropNameCache = isFunctionsRuntime ? std::weak_ptr{m_propNameCache} : std::weak_ptr<JsiPropNameCache>{}](
+            facebook::jsi::Runtime &rt,
+            facebook::jsi::Value const & /*thisVal*/,
+            facebook::jsi::Value const *args,
+            size_t count) {
+          // The function may outlive the module and its cache.
+          auto propNameCache = weakPropNameCache.lock();
+          JsiPropNameCacheScope propNameCacheScope{propNameCache.get()};
+          return method(rt, args, count);
+        });
+    facebook::jsi::Value result{runtime, function};
+    if (isFunctionsRuntime) {
+      m_functions.emplace(std::move(key), std::move(function));
+    }
+
+    return result;
+  }
+
+  std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &runtime) override {
+    std::vector<facebook::jsi::PropNameID> result;
+    result.reserve(m_methods.size());
+    for (auto const &entry : m_methods) {
+      result.push_back(facebook::jsi::PropNameID::forUtf8(runtime, entry.first));
+    }
+
+    return result;
+  }
+
+ private:
+  winrt::Windows::Foundation::IInspectable m_module;
+  std::unordered_map<std::string, JsiMethod> m_methods;
+  facebook::jsi::Runtime *m_functionsRuntime{nullptr};
+  std::unordered_map<std::string, facebook::jsi::Function> m_functions;
+  std::shared_ptr<JsiPropNameCache> m_propNameCache;
+};
+
+// Collects the module methods that can be called with JSI values directly: the synchronous methods and
+// the asynchronous methods without callbacks and promises.
+template <class TModule>
+struct JsiReactModuleBuilder {
+  JsiReactModuleBuilder(TModule *module) noexcept : m_module{module} {}
+
+  template <int I>
+  void RegisterModule(
+      std::wstring_view /*moduleName*/,
+      std::wstring_view /*eventEmitterName*/,
+      ReactAttributeId<I>) noexcept {
+    ReactMemberInfoIterator<TModule>{}.template ForEachMember<I + 1>(*this);
+  }
+
+  template <class TMember, class TAttribute, int I>
+  void Visit(
+      [[maybe_unused]] TMember member,
+      ReactAttributeId<I> /*attributeId*/,
+      [[maybe_unused]] TAttribute attributeInfo) noexcept {
+    if constexpr (std::is_same_v<TAttribute, ReactAsyncMethodAttribute>) {
+      if constexpr (ModuleMethodInfo<TMember>::GetMethodReturnType() == MethodReturnType::Void) {
+        m_methods.emplace(
+            winrt::to_string(attributeInfo.JSMemberName), JsiMethodInfo<TMember>::GetMethod(m_module, member));
+      }
+    } else if constexpr (std::is_same_v<TAttribute, ReactSyncMethodAttribute>) {
+      m_methods.emplace(
+          winrt::to_string(attributeInfo.JSMemberName), JsiMethodInfo<TMember>::GetMethod(m_module, member));
+    }
+  }
+
+  // Returns the module itself if there are no JSI methods.
+  winrt::Windows::Foundation::IInspectable MakeModuleObject(
+      winrt::Windows::Foundation::IInspectable const &module) noexcept {
+    if (m_methods.empty()) {
+      return module;
+    }
+
+    return winrt::make<JsiHostObjectWrapper>(
+        std::make_shared<JsiReactModuleHostObject>(module, std::move(m_methods)));
+  }
+
+ private:
+  void *m_module;
+  std::unordered_map<std::string, JsiMethod> m_methods;
+};
+
+// Checks if the TModule uses REACT_MODULE. Modules with a custom GetReactModuleInfo accept only ReactModuleBuilder.
+template <class TModule, class = void>
+struct IsJsiReactModuleInfoSupported : std::false_type {};
+template <class TModule>
+struct IsJsiReactModuleInfoSupported<
+    TModule,
+    std::void_t<decltype(GetReactModuleInfo(
+        static_cast<TModule *>(nullptr),
+        std::declval<JsiReactModuleBuilder<TModule> &>()))>> : std::true_type {};
+
+// Create a TurboModule provider for TModule type that satisfies the TModuleSpec.
+// Unlike MakeTurboModuleProvider, the TModule methods without callbacks and promises read their arguments
+// directly from JSI values. Other members use IJSValueReader and IJSValueWriter.
+// It also uses IJSValueReader and IJSValueWriter for all members if TModule does not use REACT_MODULE.
+template <class TModule, class TModuleSpec>
+inline ReactModuleProvider MakeJsiTurboModuleProvider() noexcept {
+  TModuleSpec::template ValidateModule<TModule>();
+  return [](IReactModuleBuilder const &moduleBuilder) noexcept {
+    auto [moduleWrapper, module] = ReactModuleTraits<TModule>::Factory();
+    ReactModuleBuilder builder{module, moduleBuilder};
+    GetReactModuleInfo(module, builder);
+    builder.CompleteRegistration();
+
+    if constexpr (IsJsiReactModuleInfoSupported<TModule>::value) {
+      // The JSI host object needs the JSI runtime created for this DLL.
+      // We expect the initializer to be called immediately for TurboModules.
+      moduleBuilder.AddInitializer([](IReactContext const &context) noexcept {
+        if (context.JSRuntime()) {
+          GetOrCreateContextRuntime(ReactContext{context});
+        }
+      });
+
+      JsiReactModuleBuilder<TModule> jsiBuilder{module};
+      GetReactModuleInfo(module, jsiBuilder);
+      return jsiBuilder.MakeModuleObject(moduleWrapper);
+    } else {
+      return moduleWrapper;
+    }
+  };
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSI_JSIREACTMODULE
@@ -0,0 +1,573 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSI_JSIVALUECODEC
+#define MICROSOFT_REACTNATIVE_JSI_JSIVALUECODEC
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+#include "../JSValueReader.h"
+#include "../JSValueWriter.h"
+#include "jsi/jsi.h"
+
+namespace winrt::Microsoft::ReactNative {
+
+// JsiValueCodec<T> converts values between facebook::jsi::Value and C++ type T without IJSValueReader and
+// IJSValueWriter. It is specialized for the primitive types, strings, std::optional, std::vector, std::map with
+// std::string keys, JSValue, and REACT_STRUCT types. The values are converted the same way as ReadValue and WriteValue
+// do it. Other types are converted through JSValue using their ReadValue and WriteValue functions.
+// Specialize JsiValueCodec for a custom type to avoid the intermediate JSValue.
+template <class T, class = void>
+struct JsiValueCodec;
+
+// Property names may have non-ASCII characters, while the jsi::Object::setProperty(const char *) expects ASCII.
+inline void SetJsiProperty(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Object &object,
+    std::string const &name,
+    facebook::jsi::Value &&value) {
+  object.setProperty(runtime, facebook::jsi::PropNameID::forUtf8(runtime, name), std::move(value));
+}
+
+template <>
+struct JsiValueCodec<JSValue> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, JSValue &value) {
+    value = ToJSValue(runtime, jsiValue);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, JSValue const &value) {
+    switch (value.Type()) {
+      case JSValueType::Object: {
+        facebook::jsi::Object result{runtime};
+        for (auto const &property : value.AsObject()) {
+          SetJsiProperty(runtime, result, property.first, Write(runtime, property.second));
+        }
+        return facebook::jsi::Value(std::move(result));
+      }
+      case JSValueType::Array: {
+        auto const &array = value.AsArray();
+        facebook::jsi::Array result{runtime, array.size()};
+        for (size_t i = 0; i < array.size(); ++i) {
+          result.setValueAtIndex(runtime, i, Write(runtime, array[i]));
+        }
+        return facebook::jsi::Value(std::move(result));
+      }
+      case JSValueType::String:
+        return facebook::jsi::String::createFromUtf8(runtime, *value.TryGetString());
+      case JSValueType::Boolean:
+        return facebook::jsi::Value(*value.TryGetBoolean());
+      case JSValueType::Int64:
+        return facebook::jsi::Value(static_cast<double>(*value.TryGetInt64()));
+      case JSValueType::Double:
+        return facebook::jsi::Value(*value.TryGetDouble());
+      default:
+        return facebook::jsi::Value::null();
+    }
+  }
+
+  static JSValue ToJSValue(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue) {
+    if (jsiValue.isBool()) {
+      return JSValue{jsiValue.getBool()};
+    } else if (jsiValue.isNumber()) {
+      // JSI does not distinguish integers and doubles. Like JsiReader, we treat numbers without a fraction as Int64.
+      double number = jsiValue.getNumber();
+      if (std::floor(number) == number && std::abs(number) < 9223372036854775808.0) {
+        return JSValue{static_cast<int64_t>(number)};
+      }
+
+      return JSValue{number};
+    } else if (jsiValue.isString()) {
+      return JSValue{jsiValue.getString(runtime).utf8(runtime)};
+    } else if (jsiValue.isObject()) {
+      auto object = jsiValue.getObject(runtime);
+      if (object.isArray(runtime)) {
+        return JSValue{ToJSValueArray(runtime, object.getArray(runtime))};
+      }
+
+      return JSValue{ToJSValueObject(runtime, object)};
+    }
+
+    return JSValue{nullptr};
+  }
+
+  static JSValueObject ToJSValueObject(facebook::jsi::Runtime &runtime, facebook::jsi::Object const &object) {
+    JSValueObject result;
+    auto propertyNames = object.getPropertyNames(runtime);
+    size_t propertyCount = propertyNames.size(runtime);
+    for (size_t i = 0; i < propertyCount; ++i) {
+      auto propertyName = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
+      result.emplace(propertyName.utf8(runtime), ToJSValue(runtime, object.getProperty(runtime, propertyName)));
+    }
+
+    return result;
+  }
+
+  static JSValueArray ToJSValueArray(facebook::jsi::Runtime &runtime, facebook::jsi::Array const &array) {
+    JSValueArray result;
+    size_t size = array.size(runtime);
+    result.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      result.push_back(ToJSValue(runtime, array.getValueAtIndex(runtime, i)));
+    }
+
+    return result;
+  }
+};
+
+// The default codec for types that have ReadValue and WriteValue functions.
+template <class T, class>
+struct JsiValueCodec {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, T &value) {
+    ReadValue(JsiValueCodec<JSValue>::ToJSValue(runtime, jsiValue), /*out*/ value);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, T const &value) {
+    return JsiValueCodec<JSValue>::Write(runtime, JSValue::From(value));
+  }
+};
+
+template <>
+struct JsiValueCodec<JSValueObject> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, JSValueObject &value) {
+    if (jsiValue.isObject()) {
+      auto object = jsiValue.getObject(runtime);
+      if (!object.isArray(runtime)) {
+        value = JsiValueCodec<JSValue>::ToJSValueObject(runtime, object);
+      }
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, JSValueObject const &value) {
+    facebook::jsi::Object result{runtime};
+    for (auto const &property : value) {
+      SetJsiProperty(runtime, result, property.first, JsiValueCodec<JSValue>::Write(runtime, property.second));
+    }
+
+    return facebook::jsi::Value(std::move(result));
+  }
+};
+
+template <>
+struct JsiValueCodec<JSValueArray> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, JSValueArray &value) {
+    if (jsiValue.isObject()) {
+      auto object = jsiValue.getObject(runtime);
+      if (object.isArray(runtime)) {
+        value = JsiValueCodec<JSValue>::ToJSValueArray(runtime, object.getArray(runtime));
+      }
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, JSValueArray const &value) {
+    facebook::jsi::Array result{runtime, value.size()};
+    for (size_t i = 0; i < value.size(); ++i) {
+      result.setValueAtIndex(runtime, i, JsiValueCodec<JSValue>::Write(runtime, value[i]));
+    }
+
+    return facebook::jsi::Value(std::move(result));
+  }
+};
+
+template <>
+struct JsiValueCodec<bool> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, bool &value) {
+    if (jsiValue.isBool()) {
+      value = jsiValue.getBool();
+    } else if (jsiValue.isNumber()) {
+      value = jsiValue.getNumber() != 0;
+    } else if (jsiValue.isString()) {
+      value = !jsiValue.getString(runtime).utf8(runtime).empty();
+    } else {
+      value = false;
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime & /*runtime*/, bool value) {
+    return facebook::jsi::Value(value);
+  }
+};
+
+template <class T>
+struct JsiValueCodec<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, T &value) {
+    int64_t result{0};
+    if (jsiValue.isNumber()) {
+      result = static_cast<int64_t>(jsiValue.getNumber());
+    } else if (jsiValue.isBool()) {
+      result = jsiValue.getBool() ? 1 : 0;
+    } else if (jsiValue.isString()) {
+      std::string str = jsiValue.getString(runtime).utf8(runtime);
+      char *end = nullptr;
+      auto iValue = std::strtoll(str.c_str(), &end, 10 /*base*/);
+      result = end == str.c_str() + str.size() ? iValue : 0;
+    }
+
+    value = static_cast<T>(result);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime & /*runtime*/, T value) {
+    return facebook::jsi::Value(static_cast<double>(value));
+  }
+};
+
+template <class T>
+struct JsiValueCodec<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, T &value) {
+    double result{0};
+    if (jsiValue.isNumber()) {
+      result = jsiValue.getNumber();
+    } else if (jsiValue.isBool()) {
+      result = jsiValue.getBool() ? 1 : 0;
+    } else if (jsiValue.isString()) {
+      std::string str = jsiValue.getString(runtime).utf8(runtime);
+      char *end = nullptr;
+      auto dValue = std::strtod(str.c_str(), &end);
+      result = end == str.c_str() + str.size() ? dValue : 0;
+    }
+
+    value = static_cast<T>(result);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime & /*runtime*/, T value) {
+    return facebook::jsi::Value(static_cast<double>(value));
+  }
+};
+
+template <class T>
+struct JsiValueCodec<T, std::enable_if_t<std::is_enum_v<T>>> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, T &value) {
+    int32_t intValue;
+    JsiValueCodec<int32_t>::Read(runtime, jsiValue, intValue);
+    value = static_cast<T>(intValue);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime & /*runtime*/, T value) {
+    return facebook::jsi::Value(static_cast<double>(static_cast<int32_t>(value)));
+  }
+};
+
+template <>
+struct JsiValueCodec<std::string> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, std::string &value) {
+    if (jsiValue.isString()) {
+      value = jsiValue.getString(runtime).utf8(runtime);
+    } else if (jsiValue.isBool()) {
+      value = jsiValue.getBool() ? "true" : "false";
+    } else if (jsiValue.isNumber()) {
+      value = NumberToString(jsiValue.getNumber());
+    } else {
+      value = "";
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, std::string const &value) {
+    return facebook::jsi::String::createFromUtf8(runtime, value);
+  }
+
+  // Formats numbers the same way as ReadValue(IJSValueReader const &, std::string &).
+  static std::string NumberToString(double number) {
+    if (std::floor(number) == number && std::abs(number) < 9223372036854775808.0) {
+      return std::to_string(static_cast<int64_t>(number));
+    }
+
+    std::string result = std::to_string(number);
+    result.erase(result.find_last_not_of('0') + 1, std::string::npos);
+    result.erase(result.find_last_not_of('.') + 1, std::string::npos);
+    return result;
+  }
+};
+
+template <>
+struct JsiValueCodec<std::wstring> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, std::wstring &value) {
+    std::string str;
+    JsiValueCodec<std::string>::Read(runtime, jsiValue, str);
+    value = winrt::to_hstring(str);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, std::wstring const &value) {
+    return facebook::jsi::String::createFromUtf8(runtime, winrt::to_string(value));
+  }
+};
+
+template <>
+struct JsiValueCodec<winrt::hstring> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, winrt::hstring &value) {
+    std::string str;
+    JsiValueCodec<std::string>::Read(runtime, jsiValue, str);
+    value = winrt::to_hstring(str);
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, winrt::hstring const &value) {
+    return facebook::jsi::String::createFromUtf8(runtime, winrt::to_string(value));
+  }
+};
+
+template <class T>
+struct JsiValueCodec<std::optional<T>> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, std::optional<T> &value) {
+    if (!jsiValue.isNull() && !jsiValue.isUndefined()) {
+      value.emplace();
+      JsiValueCodec<T>::Read(runtime, jsiValue, *value);
+    } else {
+      value = std::nullopt;
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, std::optional<T> const &value) {
+    return value ? JsiValueCodec<T>::Write(runtime, *value) : facebook::jsi::Value::null();
+  }
+};
+
+template <class T, class TAlloc>
+struct JsiValueCodec<std::vector<T, TAlloc>> {
+  static void
+  Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, std::vector<T, TAlloc> &value) {
+    if (jsiValue.isObject()) {
+      auto object = jsiValue.getObject(runtime);
+      if (object.isArray(runtime)) {
+        auto array = object.getArray(runtime);
+        size_t size = array.size(runtime);
+        value.reserve(value.size() + size);
+        for (size_t i = 0; i < size; ++i) {
+          T item{};
+          JsiValueCodec<T>::Read(runtime, array.getValueAtIndex(runtime, i), item);
+          value.push_back(std::move(item));
+        }
+      }
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, std::vector<T, TAlloc> const &value) {
+    facebook::jsi::Array result{runtime, value.size()};
+    for (size_t i = 0; i < value.size(); ++i) {
+      result.setValueAtIndex(runtime, i, JsiValueCodec<T>::Write(runtime, value[i]));
+    }
+
+    return facebook::jsi::Value(std::move(result));
+  }
+};
+
+template <class T, class TCompare, class TAlloc>
+struct JsiValueCodec<std::map<std::string, T, TCompare, TAlloc>> {
+  static void Read(
+      facebook::jsi::Runtime &runtime,
+      facebook::jsi::Value const &jsiValue,
+      std::map<std::string, T, TCompare, TAlloc> &value) {
+    if (jsiValue.isObject()) {
+      auto object = jsiValue.getObject(runtime);
+      if (!object.isArray(runtime)) {
+        auto propertyNames = object.getPropertyNames(runtime);
+        size_t propertyCount = propertyNames.size(runtime);
+        for (size_t i = 0; i < propertyCount; ++i) {
+          auto propertyName = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
+          T item{};
+          JsiValueCodec<T>::Read(runtime, object.getProperty(runtime, propertyName), item);
+          value.emplace(propertyName.utf8(runtime), std::move(item));
+        }
+      }
+    }
+  }
+
+  static facebook::jsi::Value Write(
+      facebook::jsi::Runtime &runtime,
+      std::map<std::string, T, TCompare, TAlloc> const &value) {
+    facebook::jsi::Object result{runtime};
+    for (auto const &property : value) {
+      SetJsiProperty(runtime, result, property.first, JsiValueCodec<T>::Write(runtime, property.second));
+    }
+
+    return facebook::jsi::Value(std::move(result));
+  }
+};
+
+// Caches the property names of REACT_STRUCT fields for one JSI runtime.
+// The PropNameIDs belong to the runtime, so the cache must be destroyed before the runtime.
+// JsiStructInfo uses the cache of the current JsiPropNameCacheScope if the scope is created for the same runtime.
+struct JsiPropNameCache {
+  explicit JsiPropNameCache(facebook::jsi::Runtime &runtime) noexcept : m_runtime{runtime} {}
+
+  JsiPropNameCache(JsiPropNameCache const &) = delete;
+  JsiPropNameCache &operator=(JsiPropNameCache const &) = delete;
+
+  // Returns the cache of the current JsiPropNameCacheScope, or nullptr if it is created for another runtime.
+  static JsiPropNameCache *GetCurrent(facebook::jsi::Runtime &runtime) noexcept {
+    JsiPropNameCache *current = Current();
+    return current && &current->m_runtime == &runtime ? current : nullptr;
+  }
+
+  // Returns the PropNameIDs for the Name of the fields. The fields address is the cache key.
+  template <class TFieldInfo>
+  std::vector<facebook::jsi::PropNameID> const &GetPropNames(std::vector<TFieldInfo> const &fields) {
+    auto it = m_propNames.find(&fields);
+    if (it == m_propNames.end()) {
+      std::vector<facebook::jsi::PropNameID> propNames;
+      propNames.reserve(fields.size());
+      for (auto const &field : fields) {
+        propNames.push_back(facebook::jsi::PropNameID::forUtf8(m_runtime, field.Name));
+      }
+
+      it = m_propNames.emplace(&fields, std::move(propNames)).first;
+    }
+
+    return it->second;
+  }
+
+ private:
+  friend struct JsiPropNameCacheScope;
+
+  static JsiPropNameCache *&Current() noexcept {
+    static thread_local JsiPropNameCache *current{nullptr};
+    return current;
+  }
+
+  facebook::jsi::Runtime &m_runtime;
+  std::unordered_map<void const *, std::vector<facebook::jsi::PropNameID>> m_propNames;
+};
+
+// Makes the cache current for the JsiValueCodec calls in the current thread.
+struct JsiPropNameCacheScope {
+  explicit JsiPropNameCacheScope(JsiPropNameCache *cache) noexcept : m_previous{JsiPropNameCache::Current()} {
+    JsiPropNameCache::Current() = cache;
+  }
+
+  ~JsiPropNameCacheScope() noexcept {
+    JsiPropNameCache::Current() = m_previous;
+  }
+
+  JsiPropNameCacheScope(JsiPropNameCacheScope const &) = delete;
+  JsiPropNameCacheScope &operator=(JsiPropNameCacheScope const &) = delete;
+
+ private:
+  JsiPropNameCache *m_previous;
+};
+
+// Fields of a REACT_STRUCT type collected by CollectStructFieldInfo.
+// The field names are converted to UTF-8 only once per type, and to PropNameIDs once per JsiPropNameCache.
+template <class T>
+struct JsiStructInfo {
+  struct FieldInfo {
+    std::string Name;
+    std::function<void(facebook::jsi::Runtime &, facebook::jsi::Object const &, facebook::jsi::PropNameID const &, T &)>
+        ReadField;
+    std::function<void(facebook::jsi::Runtime &, facebook::jsi::Object &, facebook::jsi::PropNameID const &, T const &)>
+        WriteField;
+  };
+
+  static std::vector<FieldInfo> const &Fields() noexcept {
+    static std::vector<FieldInfo> const fields = [] {
+      JsiStructInfo structInfo;
+      CollectStructFieldInfo(static_cast<T *>(nullptr), structInfo);
+
+      // Keep the same property order as the StructInfo<T>::FieldMap.
+      std::sort(structInfo.m_fields.begin(), structInfo.m_fields.end(), [](auto const &left, auto const &right) {
+        return left.Name < right.Name;
+      });
+      return std::move(structInfo.m_fields);
+    }();
+    return fields;
+  }
+
+  // Calls func(FieldInfo const &field, facebook::jsi::PropNameID const &propName) for each field.
+  template <class TFunc>
+  static void ForEachField(facebook::jsi::Runtime &runtime, TFunc &&func) {
+    auto const &fields = Fields();
+    if (auto cache = JsiPropNameCache::GetCurrent(runtime)) {
+      auto const &propNames = cache->GetPropNames(fields);
+      for (size_t i = 0; i < fields.size(); ++i) {
+        func(fields[i], propNames[i]);
+      }
+    } else {
+      for (auto const &field : fields) {
+        func(field, facebook::jsi::PropNameID::forUtf8(runtime, field.Name));
+      }
+    }
+  }
+
+  // Called by the REACT_FIELD registration.
+  template <class TOwner, class TValue>
+  void emplace(std::wstring_view fieldName, TValue TOwner::*fieldPtr) noexcept {
+    auto readField = [fieldPtr](
+                         facebook::jsi::Runtime &runtime,
+                         facebook::jsi::Object const &object,
+                         facebook::jsi::PropNameID const &propName,
+                         T &value) {
+      // Missing properties keep the default field values.
+      auto property = object.getProperty(runtime, propName);
+      if (!property.isUndefined()) {
+        JsiValueCodec<TValue>::Read(runtime, property, value.*fieldPtr);
+      }
+    };
+    auto writeField = [fieldPtr](
+                          facebook::jsi::Runtime &runtime,
+                          facebook::jsi::Object &object,
+                          facebook::jsi::PropNameID const &propName,
+                          T const &value) {
+      object.setProperty(runtime, propName, JsiValueCodec<TValue>::Write(runtime, value.*fieldPtr));
+    };
+    m_fields.push_back(FieldInfo{winrt::to_string(fieldName), std::move(readField), std::move(writeField)});
+  }
+
+ private:
+  std::vector<FieldInfo> m_fields;
+};
+
+template <class T>
+struct JsiValueCodec<
+    T,
+    std::void_t<decltype(CollectStructFieldInfo(static_cast<T *>(nullptr), std::declval<JsiStructInfo<T> &>()))>> {
+  static void Read(facebook::jsi::Runtime &runtime, facebook::jsi::Value const &jsiValue, T &value) {
+    if (jsiValue.isObject()) {
+      auto object = jsiValue.getObject(runtime);
+      if (!object.isArray(runtime)) {
+        JsiStructInfo<T>::ForEachField(runtime, [&](auto const &field, facebook::jsi::PropNameID const &propName) {
+          field.ReadField(runtime, object, propName, value);
+        });
+      }
+    }
+  }
+
+  static facebook::jsi::Value Write(facebook::jsi::Runtime &runtime, T const &value) {
+    facebook::jsi::Object result{runtime};
+    JsiStructInfo<T>::ForEachField(runtime, [&](auto const &field, facebook::jsi::PropNameID const &propName) {
+      field.WriteField(runtime, result, propName, value);
+    });
+
+    return facebook::jsi::Value(std::move(result));
+  }
+};
+
+template <class TTuple, size_t... I>
+inline void ReadJsiArgs(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const *args,
+    size_t count,
+    /*out*/ TTuple &values,
+    std::index_sequence<I...>) {
+  // Missing arguments keep their default values.
+  ((I < count ? JsiValueCodec<std::tuple_element_t<I, TTuple>>::Read(runtime, args[I], std::get<I>(values)) : void()),
+   ...);
+}
+
+// Reads JSI arguments into a tuple of values.
+template <class... TArgs>
+inline void ReadJsiArgs(
+    facebook::jsi::Runtime &runtime,
+    facebook::jsi::Value const *args,
+    size_t count,
+    /*out*/ std::tuple<TArgs...> &values) {
+  ReadJsiArgs(runtime, args, count, values, std::make_index_sequence<sizeof...(TArgs)>{});
+}
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSI_JSIVALUECODEC
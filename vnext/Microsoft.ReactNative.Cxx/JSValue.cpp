@@ -255,8 +255,9 @@ JSValueObject::JSValueObject(std::map<std::string, JSValue, std::less<>> &&other
 
 JSValueObject JSValueObject::Copy() const noexcept {
   JSValueObject object;
+  // The properties are already sorted: the end() hint avoids the key search.
   for (auto const &property : *this) {
-    object.try_emplace(property.first, property.second.Copy());
+    object.emplace_hint(object.end(), property.first, property.second.Copy());
   }
 
   return object;
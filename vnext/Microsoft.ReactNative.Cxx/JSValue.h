@@ -574,10 +574,8 @@ inline bool operator!=(JSValueObject const &left, JSValueObject const &right) no
 
 template <class TMoveInputIterator, std::enable_if_t<!std::is_integral_v<TMoveInputIterator>, int>>
 JSValueArray::JSValueArray(TMoveInputIterator first, TMoveInputIterator last) noexcept {
-  auto it = first;
-  while (it != last) {
-    push_back(*it++);
-  }
+  // The vector allocates memory once for the forward iterators.
+  assign(first, last);
 }
 
 // Deprecated
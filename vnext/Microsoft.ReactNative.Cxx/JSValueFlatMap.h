@@ -0,0 +1,331 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// IMPORTANT: Before updating this file
+// please read react-native-windows repo:
+// vnext/Microsoft.ReactNative.Cxx/README.md
+
+#pragma once
+#ifndef MICROSOFT_REACTNATIVE_JSVALUEFLATMAP
+#define MICROSOFT_REACTNATIVE_JSVALUEFLATMAP
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace winrt::Microsoft::ReactNative {
+
+//! JSValueFlatMap is an ordered map that keeps its key-value pairs in a sorted std::vector.
+//! It has the std::map interface used by JSValueObject, but it is a separate type: JSValueObject is always
+//! based on std::map, so its layout does not depend on build settings.
+//! All key-value pairs are stored in one memory block. Short keys are stored inline by std::string.
+//! Unlike std::map, the keys are not const, and the insert and erase operations invalidate iterators and
+//! references to the existing key-value pairs.
+//! The lookup methods accept any key type that can be compared with TKey using TCompare.
+template <class TKey, class TValue, class TCompare = std::less<>>
+class JSValueFlatMap {
+ public:
+  using key_type = TKey;
+  using mapped_type = TValue;
+  using value_type = std::pair<TKey, TValue>;
+  using key_compare = TCompare;
+  using container_type = std::vector<value_type>;
+  using size_type = typename container_type::size_type;
+  using difference_type = typename container_type::difference_type;
+  using reference = value_type &;
+  using const_reference = value_type const &;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+  using reverse_iterator = typename container_type::reverse_iterator;
+  using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+  JSValueFlatMap() = default;
+
+  iterator begin() noexcept {
+    return m_items.begin();
+  }
+
+  const_iterator begin() const noexcept {
+    return m_items.begin();
+  }
+
+  const_iterator cbegin() const noexcept {
+    return m_items.cbegin();
+  }
+
+  iterator end() noexcept {
+    return m_items.end();
+  }
+
+  const_iterator end() const noexcept {
+    return m_items.end();
+  }
+
+  const_iterator cend() const noexcept {
+    return m_items.cend();
+  }
+
+  reverse_iterator rbegin() noexcept {
+    return m_items.rbegin();
+  }
+
+  const_reverse_iterator rbegin() const noexcept {
+    return m_items.rbegin();
+  }
+
+  reverse_iterator rend() noexcept {
+    return m_items.rend();
+  }
+
+  const_reverse_iterator rend() const noexcept {
+    return m_items.rend();
+  }
+
+  bool empty() const noexcept {
+    return m_items.empty();
+  }
+
+  size_type size() const noexcept {
+    return m_items.size();
+  }
+
+  size_type max_size() const noexcept {
+    return m_items.max_size();
+  }
+
+  size_type capacity() const noexcept {
+    return m_items.capacity();
+  }
+
+  void reserve(size_type count) {
+    m_items.reserve(count);
+  }
+
+  void shrink_to_fit() {
+    m_items.shrink_to_fit();
+  }
+
+  void clear() noexcept {
+    m_items.clear();
+  }
+
+  key_compare key_comp() const {
+    return m_compare;
+  }
+
+  template <class TLookupKey>
+  iterator lower_bound(TLookupKey const &key) {
+    return m_items.begin() + LowerBoundIndex(key);
+  }
+
+  template <class TLookupKey>
+  const_iterator lower_bound(TLookupKey const &key) const {
+    return m_items.begin() + LowerBoundIndex(key);
+  }
+
+  template <class TLookupKey>
+  iterator upper_bound(TLookupKey const &key) {
+    auto it = lower_bound(key);
+    return (it != m_items.end() && !m_compare(key, it->first)) ? it + 1 : it;
+  }
+
+  template <class TLookupKey>
+  const_iterator upper_bound(TLookupKey const &key) const {
+    auto it = lower_bound(key);
+    return (it != m_items.end() && !m_compare(key, it->first)) ? it + 1 : it;
+  }
+
+  template <class TLookupKey>
+  std::pair<iterator, iterator> equal_range(TLookupKey const &key) {
+    auto it = lower_bound(key);
+    return {it, (it != m_items.end() && !m_compare(key, it->first)) ? it + 1 : it};
+  }
+
+  template <class TLookupKey>
+  std::pair<const_iterator, const_iterator> equal_range(TLookupKey const &key) const {
+    auto it = lower_bound(key);
+    return {it, (it != m_items.end() && !m_compare(key, it->first)) ? it + 1 : it};
+  }
+
+  template <class TLookupKey>
+  iterator find(TLookupKey const &key) {
+    auto it = lower_bound(key);
+    return (it != m_items.end() && !m_compare(key, it->first)) ? it : m_items.end();
+  }
+
+  template <class TLookupKey>
+  const_iterator find(TLookupKey const &key) const {
+    auto it = lower_bound(key);
+    return (it != m_items.end() && !m_compare(key, it->first)) ? it : m_items.end();
+  }
+
+  template <class TLookupKey>
+  size_type count(TLookupKey const &key) const {
+    return find(key) != m_items.end() ? 1 : 0;
+  }
+
+  template <class TLookupKey>
+  mapped_type &at(TLookupKey const &key) {
+    auto it = find(key);
+    if (it == m_items.end()) {
+      throw std::out_of_range("JSValueFlatMap key not found");
+    }
+
+    return it->second;
+  }
+
+  template <class TLookupKey>
+  mapped_type const &at(TLookupKey const &key) const {
+    auto it = find(key);
+    if (it == m_items.end()) {
+      throw std::out_of_range("JSValueFlatMap key not found");
+    }
+
+    return it->second;
+  }
+
+  template <class TLookupKey, class... TArgs>
+  std::pair<iterator, bool> try_emplace(TLookupKey &&key, TArgs &&... args) {
+    auto it = lower_bound(key);
+    if (it != m_items.end() && !m_compare(key, it->first)) {
+      return {it, false};
+    }
+
+    it = m_items.emplace(
+        it,
+        std::piecewise_construct,
+        std::forward_as_tuple(std::forward<TLookupKey>(key)),
+        std::forward_as_tuple(std::forward<TArgs>(args)...));
+    return {it, true};
+  }
+
+  template <class TLookupKey, class TMapped>
+  std::pair<iterator, bool> insert_or_assign(TLookupKey &&key, TMapped &&value) {
+    auto result = try_emplace(std::forward<TLookupKey>(key), std::forward<TMapped>(value));
+    if (!result.second) {
+      result.first->second = std::forward<TMapped>(value);
+    }
+
+    return result;
+  }
+
+  template <class... TArgs>
+  std::pair<iterator, bool> emplace(TArgs &&... args) {
+    value_type item(std::forward<TArgs>(args)...);
+    return try_emplace(std::move(item.first), std::move(item.second));
+  }
+
+  //! Inserts the key-value pair at the hint position if it keeps the keys sorted.
+  template <class... TArgs>
+  iterator emplace_hint(const_iterator hint, TArgs &&... args) {
+    value_type item(std::forward<TArgs>(args)...);
+    bool isAfterPrevious = hint == m_items.begin() || m_compare(std::prev(hint)->first, item.first);
+    bool isBeforeNext = hint == m_items.end() || m_compare(item.first, hint->first);
+    if (isAfterPrevious && isBeforeNext) {
+      return m_items.insert(hint, std::move(item));
+    }
+
+    return try_emplace(std::move(item.first), std::move(item.second)).first;
+  }
+
+  std::pair<iterator, bool> insert(value_type &&item) {
+    return try_emplace(std::move(item.first), std::move(item.second));
+  }
+
+  std::pair<iterator, bool> insert(value_type const &item) {
+    return try_emplace(item.first, item.second);
+  }
+
+  //! Inserts all key-value pairs with one sort of the new items.
+  //! The same way as std::map, the first key-value pair wins if there are duplicate keys.
+  template <class TInputIterator>
+  void insert(TInputIterator first, TInputIterator last) {
+    size_type oldSize = m_items.size();
+    for (; first != last; ++first) {
+      m_items.emplace_back(*first);
+    }
+
+    auto newItemsBegin = m_items.begin() + oldSize;
+    auto isLess = [this](value_type const &left, value_type const &right) {
+      return m_compare(left.first, right.first);
+    };
+    std::stable_sort(newItemsBegin, m_items.end(), isLess);
+    std::inplace_merge(m_items.begin(), newItemsBegin, m_items.end(), isLess);
+    m_items.erase(
+        std::unique(
+            m_items.begin(),
+            m_items.end(),
+            [this](value_type const &left, value_type const &right) {
+              return !m_compare(left.first, right.first);
+            }),
+        m_items.end());
+  }
+
+  iterator erase(iterator pos) {
+    return m_items.erase(pos);
+  }
+
+  iterator erase(const_iterator pos) {
+    return m_items.erase(pos);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    return m_items.erase(first, last);
+  }
+
+  template <class TLookupKey>
+  size_type erase(TLookupKey const &key) {
+    auto it = find(key);
+    if (it == m_items.end()) {
+      return 0;
+    }
+
+    m_items.erase(it);
+    return 1;
+  }
+
+  void swap(JSValueFlatMap &other) noexcept {
+    m_items.swap(other.m_items);
+    std::swap(m_compare, other.m_compare);
+  }
+
+ private:
+  // Small objects are searched linearly: it is faster than the binary search for a few short keys.
+  static constexpr size_type LinearSearchMaxSize = 8;
+
+  template <class TLookupKey>
+  size_type LowerBoundIndex(TLookupKey const &key) const {
+    size_type first = 0;
+    size_type count = m_items.size();
+    if (count <= LinearSearchMaxSize) {
+      while (first < count && m_compare(m_items[first].first, key)) {
+        ++first;
+      }
+
+      return first;
+    }
+
+    while (count > 0) {
+      size_type step = count / 2;
+      if (m_compare(m_items[first + step].first, key)) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+
+    return first;
+  }
+
+ private:
+  container_type m_items;
+  TCompare m_compare;
+};
+
+} // namespace winrt::Microsoft::ReactNative
+
+#endif // MICROSOFT_REACTNATIVE_JSVALUEFLATMAP
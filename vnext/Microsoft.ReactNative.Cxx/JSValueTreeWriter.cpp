@@ -15,7 +15,7 @@ namespace winrt::Microsoft::ReactNative {
 //===========================================================================
 
 JSValueTreeWriter::JSValueTreeWriter() noexcept {
-  m_containerStack.push(ContainerInfo{ContainerType::None});
+  PushContainer(ContainerType::None);
 }
 
 JSValue JSValueTreeWriter::TakeValue() noexcept {
@@ -43,46 +43,64 @@ void JSValueTreeWriter::WriteString(const hstring &value) noexcept {
 }
 
 void JSValueTreeWriter::WriteObjectBegin() noexcept {
-  m_containerStack.push(ContainerInfo{ContainerType::Object});
+  PushContainer(ContainerType::Object);
 }
 
 void JSValueTreeWriter::WritePropertyName(const winrt::hstring &name) noexcept {
-  auto &top = m_containerStack.top();
+  auto &top = TopContainer();
   VerifyElseCrash(top.Type == ContainerType::Object);
   top.PropertyName = to_string(name);
 }
 
 void JSValueTreeWriter::WriteObjectEnd() noexcept {
-  auto &top = m_containerStack.top();
+  auto &top = TopContainer();
   VerifyElseCrash(top.Type == ContainerType::Object);
-  JSValue value{std::move(top.Object)};
-  m_containerStack.pop();
+  JSValue value{JSValueObject(
+      std::make_move_iterator(top.Properties.begin()), std::make_move_iterator(top.Properties.end()))};
+  top.Properties.clear();
+  --m_containerCount;
   WriteValue(std::move(value));
 }
 
 void JSValueTreeWriter::WriteArrayBegin() noexcept {
-  m_containerStack.push(ContainerInfo{ContainerType::Array});
+  PushContainer(ContainerType::Array);
 }
 
 void JSValueTreeWriter::WriteArrayEnd() noexcept {
-  auto &top = m_containerStack.top();
+  auto &top = TopContainer();
   VerifyElseCrash(top.Type == ContainerType::Array);
-  JSValue value{std::move(top.Array)};
-  m_containerStack.pop();
+  JSValue value{
+      JSValueArray(std::make_move_iterator(top.Items.begin()), std::make_move_iterator(top.Items.end()))};
+  top.Items.clear();
+  --m_containerCount;
   WriteValue(std::move(value));
 }
 
+void JSValueTreeWriter::PushContainer(ContainerType type) noexcept {
+  if (m_containerCount < m_containerStack.size()) {
+    m_containerStack[m_containerCount].Type = type;
+  } else {
+    m_containerStack.emplace_back(type);
+  }
+
+  ++m_containerCount;
+}
+
+JSValueTreeWriter::ContainerInfo &JSValueTreeWriter::TopContainer() noexcept {
+  return m_containerStack[m_containerCount - 1];
+}
+
 void JSValueTreeWriter::WriteValue(JSValue &&value) noexcept {
-  auto &top = m_containerStack.top();
+  auto &top = TopContainer();
   switch (top.Type) {
     case ContainerType::None:
       m_resultValue = std::move(value);
       break;
     case ContainerType::Object:
-      top.Object.emplace(std::move(top.PropertyName), std::move(value));
+      top.Properties.emplace_back(std::move(top.PropertyName), std::move(value));
       break;
     case ContainerType::Array:
-      top.Array.push_back(std::move(value));
+      top.Items.push_back(std::move(value));
       break;
   }
 }
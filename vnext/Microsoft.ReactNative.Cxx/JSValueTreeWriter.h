@@ -8,12 +8,14 @@
 #ifndef MICROSOFT_REACTNATIVE_JSVALUETREEWRITER
 #define MICROSOFT_REACTNATIVE_JSVALUETREEWRITER
 
-#include <stack>
+#include <vector>
 #include "JSValue.h"
 
 namespace winrt::Microsoft::ReactNative {
 
 // Writes to a tree of JSValue objects.
+// Object properties and array items are collected in buffers that are reused for all containers at the same depth.
+// Each completed object and array is then created with a single memory allocation.
 struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
   JSValueTreeWriter() noexcept;
   JSValue TakeValue() noexcept;
@@ -37,16 +39,20 @@ struct JSValueTreeWriter : implements<JSValueTreeWriter, IJSValueWriter> {
     ContainerInfo(ContainerType type) noexcept : Type{std::move(type)} {}
 
     ContainerType Type{ContainerType::None};
-    JSValueObject Object;
-    JSValueArray Array;
+    std::vector<std::pair<std::string, JSValue>> Properties;
+    std::vector<JSValue> Items;
     std::string PropertyName;
   };
 
  private:
+  void PushContainer(ContainerType type) noexcept;
+  ContainerInfo &TopContainer() noexcept;
   void WriteValue(JSValue &&value) noexcept;
 
  private:
-  std::stack<ContainerInfo> m_containerStack;
+  // Containers above m_containerCount are kept to reuse their buffers.
+  std::vector<ContainerInfo> m_containerStack;
+  size_t m_containerCount{0};
   JSValue m_resultValue;
 };
 
@@ -23,16 +23,20 @@
 
 #define INTERNAL_REACT_STRUCT(structType)                                                  \
   struct structType;                                                                       \
+  template <class TFieldMap>                                                               \
+  inline void CollectStructFieldInfo(structType *, TFieldMap &fieldMap) noexcept {         \
+    winrt::Microsoft::ReactNative::CollectStructFields<structType, __COUNTER__>(fieldMap); \
+  }                                                                                        \
   inline winrt::Microsoft::ReactNative::FieldMap GetStructInfo(structType *) noexcept {    \
     winrt::Microsoft::ReactNative::FieldMap fieldMap{};                                    \
-    winrt::Microsoft::ReactNative::CollectStructFields<structType, __COUNTER__>(fieldMap); \
+    CollectStructFieldInfo(static_cast<structType *>(nullptr), fieldMap);                  \
     return fieldMap;                                                                       \
   }
 
 #define INTERNAL_REACT_FIELD_2_ARGS(field, fieldName)                      \
-  template <class TClass>                                                  \
+  template <class TClass, class TFieldMap>                                 \
   static void RegisterField(                                               \
-      winrt::Microsoft::ReactNative::FieldMap &fieldMap,                   \
+      TFieldMap &fieldMap,                                                 \
       winrt::Microsoft::ReactNative::ReactFieldId<__COUNTER__>) noexcept { \
     fieldMap.emplace(fieldName, &TClass::field);                           \
   }
@@ -48,6 +52,8 @@
 // REACT_STRUCT annotates a C++ struct that then can be serialized and deserialized with IJSValueReader and
 // IJSValueWriter. With the help of REACT_FIELD it generates FieldMap associated with the struct which then used by
 // ReactValue and ReactWrite methods. Cannot be nested inside REACT_MODULE.
+// The fields can also be collected into other field maps with the CollectStructFieldInfo function. The field map
+// must have an emplace(fieldName, fieldPtr) method.
 #define REACT_STRUCT(structType) INTERNAL_REACT_STRUCT(structType)
 
 // REACT_FIELD(field, [opt] fieldName)
@@ -122,14 +128,14 @@ template <class T>
 template <int I>
 using ReactFieldId = std::integral_constant<int, I>;
 
-template <class TClass, int I>
-auto HasRegisterField(FieldMap &fieldMap, ReactFieldId<I> id)
+template <class TClass, class TFieldMap, int I>
+auto HasRegisterField(TFieldMap &fieldMap, ReactFieldId<I> id)
     -> decltype(TClass::template RegisterField<TClass>(fieldMap, id), std::true_type{});
 template <class TClass>
 auto HasRegisterField(...) -> std::false_type;
 
-template <class TClass, int I>
-void CollectStructFields(FieldMap &fieldMap) noexcept {
+template <class TClass, int I, class TFieldMap>
+void CollectStructFields(TFieldMap &fieldMap) noexcept {
   if constexpr (decltype(HasRegisterField<TClass>(fieldMap, ReactFieldId<I + 1>{}))::value) {
     TClass::template RegisterField<TClass>(fieldMap, ReactFieldId<I + 1>{});
     CollectStructFields<TClass, I + 1>(fieldMap);
@@ -0,0 +1,82 @@
+import * as TurboModuleRegistry from '../Libraries/TurboModule/TurboModuleRegistry';
+const codecTurboModule = TurboModuleRegistry.getEnforcing('JsiCodecTurboModule');
+
+// The results of each group of calls are logged as one action and verified against the test action sequence.
+
+function isEqual(x, y) {
+  if (typeof x !== 'object' || x === null || typeof y !== 'object' || y === null) {
+    return Object.is(x, y);
+  }
+
+  const xKeys = Object.keys(x);
+  const yKeys = Object.keys(y);
+  return (Array.isArray(x) === Array.isArray(y))
+    && (xKeys.length === yKeys.length)
+    && xKeys.every(key => isEqual(x[key], y[key]));
+}
+
+// Each case is an [argument, expected result] pair.
+function logRoundTrip(actionName, cases) {
+  const echo = codecTurboModule[actionName];
+  codecTurboModule.logAction(actionName, cases.every(([arg, expected]) => isEqual(echo(arg), expected)));
+}
+
+// The check methods compare the value read by JsiValueCodec with ReadValue applied to the same argument.
+function logReadValueMatch(actionName, args) {
+  const check = codecTurboModule[actionName];
+  codecTurboModule.logAction(actionName, args.every(arg => check(arg, arg)));
+}
+
+const point = { x: 1, y: 2.5, label: 'p', tags: ['a', 'b'], note: 'n' };
+
+logRoundTrip('echoBool', [[true, true], [false, false]]);
+logRoundTrip('echoInt', [[0, 0], [42, 42], [-7, -7], [2147483647, 2147483647]]);
+logRoundTrip('echoInt64', [[2 ** 53, 2 ** 53], [-(2 ** 40), -(2 ** 40)]]);
+logRoundTrip('echoDouble', [[0.5, 0.5], [-1e300, -1e300], [Number.NaN, Number.NaN], [Infinity, Infinity]]);
+logRoundTrip('echoString', [['', ''], ['Hello', 'Hello'], ['Привет 😀', 'Привет 😀']]);
+logRoundTrip('echoWString', [['', ''], ['Hello', 'Hello'], ['Привет 😀', 'Привет 😀']]);
+logRoundTrip('echoEnum', [[1, 1], [2, 2]]);
+logRoundTrip('echoOptional', [['a', 'a'], [null, null], [undefined, null]]);
+logRoundTrip('echoVector', [[[], []], [[1, 2, 3], [1, 2, 3]]]);
+logRoundTrip('echoMap', [[{}, {}], [{ a: 1.5, b: -2 }, { a: 1.5, b: -2 }]]);
+logRoundTrip('echoJSValue', [
+  [null, null],
+  [undefined, null],
+  [true, true],
+  [42, 42],
+  [1.5, 1.5],
+  ['s', 's'],
+  [[1, 'a', [true]], [1, 'a', [true]]],
+  [{ x: { y: [1, 2] }, z: null }, { x: { y: [1, 2] }, z: null }],
+]);
+// The struct is converted several times to use the cached property names.
+logRoundTrip('echoPoint', [
+  [point, point],
+  [point, point],
+  [{ x: 1, y: 2, label: 'q', tags: [] }, { x: 1, y: 2, label: 'q', tags: [], note: null }],
+  [{ x: 3, y: 4, label: 'r', tags: ['c'], note: null, extra: 5 }, { x: 3, y: 4, label: 'r', tags: ['c'], note: null }],
+]);
+
+logReadValueMatch('checkBool', [0, 1, 2.5, '', 'false', null, undefined, {}, []]);
+logReadValueMatch('checkInt', [true, false, 3.7, -3.7, '12', '12abc', ' 7', '', null, {}, [1]]);
+logReadValueMatch('checkDouble', [true, 7, '1.5', '1e3', 'x', '', null, []]);
+logReadValueMatch('checkString', [true, false, 5, -5, 2.5, 0.1, 1e21, null, {}, []]);
+logReadValueMatch('checkOptional', [null, undefined, 5, '5', true]);
+logReadValueMatch('checkVector', [[1, '2', true], [], 'abc', { 0: 1 }, null]);
+logReadValueMatch('checkMap', [{ a: 1, b: '2', c: true }, [], 'x', null]);
+logReadValueMatch('checkPoint', [
+  point,
+  { x: '5', y: '1.5', label: 7, tags: 'no', note: 3 },
+  { x: 1 },
+  { tags: [1, 'b'] },
+  [],
+  'x',
+  null,
+]);
+
+// The TurboModule lists and creates the members that the JSI host object does not have from the module builder.
+const propertyNames = Object.getOwnPropertyNames(codecTurboModule);
+codecTurboModule.logAction('propertyNames',
+  ['logAction', 'addWithCallback', 'echoInt', 'checkPoint'].every(name => propertyNames.includes(name)));
+codecTurboModule.logAction('constants', codecTurboModule.getConstants().answer === 42);
+codecTurboModule.addWithCallback(2, 3, result => codecTurboModule.logAction('addWithCallback', result));
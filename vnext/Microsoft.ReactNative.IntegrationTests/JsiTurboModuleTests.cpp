@@ -17,10 +17,15 @@
 // See the details for the MySimpleTurboModulePackageProvider below.
 
 #include "pch.h"
+#include <JSI/JsiReactModule.h>
+#include <NativeModules.h>
 #include <ReactCommon/TurboModule.h>
 #include <ReactCommon/TurboModuleUtils.h>
 #include <TurboModuleProvider.h> // It is RNW specific
 #include <limits>
+#include <map>
+#include <optional>
+#include <vector>
 #include "TestEventService.h"
 #include "TestReactNativeHostHolder.h"
 
@@ -280,6 +285,222 @@ struct MySimpleTurboModulePackageProvider
   }
 };
 
+// The JsiCodecTurboModule is registered with MakeJsiTurboModuleProvider.
+// Its synchronous methods and the callback-free asynchronous methods use JsiValueCodec for their arguments and
+// results. The methods with callbacks and the constants are created from the IReactModuleBuilder.
+
+enum class CodecColor { Red = 1, Green = 2 };
+
+REACT_STRUCT(CodecPoint)
+struct CodecPoint {
+  REACT_FIELD(X, L"x")
+  int X{0};
+
+  REACT_FIELD(Y, L"y")
+  double Y{0};
+
+  REACT_FIELD(Label, L"label")
+  std::string Label;
+
+  REACT_FIELD(Tags, L"tags")
+  std::vector<std::string> Tags;
+
+  REACT_FIELD(Note, L"note")
+  std::optional<std::string> Note;
+
+  bool operator==(CodecPoint const &other) const noexcept {
+    return X == other.X && Y == other.Y && Label == other.Label && Tags == other.Tags && Note == other.Note;
+  }
+};
+
+// Checks that JsiValueCodec has read the value the same way as ReadValue reads it from the raw JSValue.
+template <class T>
+static bool IsReadLikeReadValue(JSValue const &raw, T const &value) noexcept {
+  T expected{};
+  ReadValue(MakeJSValueTreeReader(raw), /*out*/ expected);
+  return expected == value;
+}
+
+REACT_MODULE(JsiCodecTurboModule)
+struct JsiCodecTurboModule {
+  REACT_CONSTANT(m_answer, L"answer")
+  const int m_answer{42};
+
+  REACT_METHOD(LogAction, L"logAction")
+  void LogAction(std::string actionName, JSValue value) noexcept {
+    TestEventService::LogEvent(actionName, std::move(value));
+  }
+
+  REACT_METHOD(AddWithCallback, L"addWithCallback")
+  void AddWithCallback(int x, int y, std::function<void(int)> const &callback) noexcept {
+    callback(x + y);
+  }
+
+  REACT_SYNC_METHOD(EchoBool, L"echoBool")
+  bool EchoBool(bool value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoInt, L"echoInt")
+  int EchoInt(int value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoInt64, L"echoInt64")
+  int64_t EchoInt64(int64_t value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoDouble, L"echoDouble")
+  double EchoDouble(double value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoString, L"echoString")
+  std::string EchoString(std::string value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoWString, L"echoWString")
+  std::wstring EchoWString(std::wstring value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoEnum, L"echoEnum")
+  CodecColor EchoEnum(CodecColor value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoOptional, L"echoOptional")
+  std::optional<std::string> EchoOptional(std::optional<std::string> value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoVector, L"echoVector")
+  std::vector<int> EchoVector(std::vector<int> value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoMap, L"echoMap")
+  std::map<std::string, double> EchoMap(std::map<std::string, double> value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(EchoJSValue, L"echoJSValue")
+  JSValue EchoJSValue(JSValue const &value) noexcept {
+    return value.Copy();
+  }
+
+  REACT_SYNC_METHOD(EchoPoint, L"echoPoint")
+  CodecPoint EchoPoint(CodecPoint value) noexcept {
+    return value;
+  }
+
+  REACT_SYNC_METHOD(CheckBool, L"checkBool")
+  bool CheckBool(JSValue const &raw, bool value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckInt, L"checkInt")
+  bool CheckInt(JSValue const &raw, int value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckDouble, L"checkDouble")
+  bool CheckDouble(JSValue const &raw, double value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckString, L"checkString")
+  bool CheckString(JSValue const &raw, std::string const &value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckOptional, L"checkOptional")
+  bool CheckOptional(JSValue const &raw, std::optional<int> const &value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckVector, L"checkVector")
+  bool CheckVector(JSValue const &raw, std::vector<int> const &value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckMap, L"checkMap")
+  bool CheckMap(JSValue const &raw, std::map<std::string, int> const &value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+
+  REACT_SYNC_METHOD(CheckPoint, L"checkPoint")
+  bool CheckPoint(JSValue const &raw, CodecPoint const &value) noexcept {
+    return IsReadLikeReadValue(raw, value);
+  }
+};
+
+struct JsiCodecTurboModuleSpec : TurboModuleSpec {
+  static constexpr auto methods = std::tuple{
+      Method<void(std::string, JSValue) noexcept>{0, L"logAction"},
+      Method<void(int, int, std::function<void(int)> const &) noexcept>{1, L"addWithCallback"},
+      SyncMethod<bool(bool) noexcept>{2, L"echoBool"},
+      SyncMethod<int(int) noexcept>{3, L"echoInt"},
+      SyncMethod<int64_t(int64_t) noexcept>{4, L"echoInt64"},
+      SyncMethod<double(double) noexcept>{5, L"echoDouble"},
+      SyncMethod<std::string(std::string) noexcept>{6, L"echoString"},
+      SyncMethod<std::wstring(std::wstring) noexcept>{7, L"echoWString"},
+      SyncMethod<CodecColor(CodecColor) noexcept>{8, L"echoEnum"},
+      SyncMethod<std::optional<std::string>(std::optional<std::string>) noexcept>{9, L"echoOptional"},
+      SyncMethod<std::vector<int>(std::vector<int>) noexcept>{10, L"echoVector"},
+      SyncMethod<std::map<std::string, double>(std::map<std::string, double>) noexcept>{11, L"echoMap"},
+      SyncMethod<JSValue(JSValue const &) noexcept>{12, L"echoJSValue"},
+      SyncMethod<CodecPoint(CodecPoint) noexcept>{13, L"echoPoint"},
+      SyncMethod<bool(JSValue const &, bool) noexcept>{14, L"checkBool"},
+      SyncMethod<bool(JSValue const &, int) noexcept>{15, L"checkInt"},
+      SyncMethod<bool(JSValue const &, double) noexcept>{16, L"checkDouble"},
+      SyncMethod<bool(JSValue const &, std::string const &) noexcept>{17, L"checkString"},
+      SyncMethod<bool(JSValue const &, std::optional<int> const &) noexcept>{18, L"checkOptional"},
+      SyncMethod<bool(JSValue const &, std::vector<int> const &) noexcept>{19, L"checkVector"},
+      SyncMethod<bool(JSValue const &, std::map<std::string, int> const &) noexcept>{20, L"checkMap"},
+      SyncMethod<bool(JSValue const &, CodecPoint const &) noexcept>{21, L"checkPoint"},
+  };
+
+  template <class TModule>
+  static constexpr void ValidateModule() noexcept {
+    constexpr auto methodCheckResults = CheckMethods<TModule, JsiCodecTurboModuleSpec>();
+
+    REACT_SHOW_METHOD_SPEC_ERRORS(0, "logAction", "Unexpected logAction signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(1, "addWithCallback", "Unexpected addWithCallback signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(2, "echoBool", "Unexpected echoBool signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(3, "echoInt", "Unexpected echoInt signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(4, "echoInt64", "Unexpected echoInt64 signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(5, "echoDouble", "Unexpected echoDouble signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(6, "echoString", "Unexpected echoString signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(7, "echoWString", "Unexpected echoWString signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(8, "echoEnum", "Unexpected echoEnum signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(9, "echoOptional", "Unexpected echoOptional signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(10, "echoVector", "Unexpected echoVector signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(11, "echoMap", "Unexpected echoMap signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(12, "echoJSValue", "Unexpected echoJSValue signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(13, "echoPoint", "Unexpected echoPoint signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(14, "checkBool", "Unexpected checkBool signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(15, "checkInt", "Unexpected checkInt signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(16, "checkDouble", "Unexpected checkDouble signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(17, "checkString", "Unexpected checkString signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(18, "checkOptional", "Unexpected checkOptional signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(19, "checkVector", "Unexpected checkVector signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(20, "checkMap", "Unexpected checkMap signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(21, "checkPoint", "Unexpected checkPoint signature");
+  }
+};
+
+struct JsiCodecTurboModulePackageProvider
+    : winrt::implements<JsiCodecTurboModulePackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    auto experimental = packageBuilder.as<IReactPackageBuilderExperimental>();
+    experimental.AddTurboModule(
+        L"JsiCodecTurboModule", MakeJsiTurboModuleProvider<JsiCodecTurboModule, JsiCodecTurboModuleSpec>());
+  }
+};
+
 } // namespace
 
 TEST_CLASS (JsiTurboModuleTests) {
@@ -321,6 +542,41 @@ TEST_CLASS (JsiTurboModuleTests) {
          TestEvent{"getValueWithPromise result resolve", "result!"},
          TestEvent{"getValueWithPromise result reject", "intentional promise rejection"}});
   }
+
+  TEST_METHOD(ExecuteJsiCodecTurboModule) {
+    TestEventService::Initialize();
+
+    auto reactNativeHost =
+        TestReactNativeHostHolder(L"JsiCodecTurboModuleTests", [](ReactNativeHost const &host) noexcept {
+          host.PackageProviders().Append(winrt::make<JsiCodecTurboModulePackageProvider>());
+        });
+
+    TestEventService::ObserveEvents({
+        TestEvent{"echoBool", true},
+        TestEvent{"echoInt", true},
+        TestEvent{"echoInt64", true},
+        TestEvent{"echoDouble", true},
+        TestEvent{"echoString", true},
+        TestEvent{"echoWString", true},
+        TestEvent{"echoEnum", true},
+        TestEvent{"echoOptional", true},
+        TestEvent{"echoVector", true},
+        TestEvent{"echoMap", true},
+        TestEvent{"echoJSValue", true},
+        TestEvent{"echoPoint", true},
+        TestEvent{"checkBool", true},
+        TestEvent{"checkInt", true},
+        TestEvent{"checkDouble", true},
+        TestEvent{"checkString", true},
+        TestEvent{"checkOptional", true},
+        TestEvent{"checkVector", true},
+        TestEvent{"checkMap", true},
+        TestEvent{"checkPoint", true},
+        TestEvent{"propertyNames", true},
+        TestEvent{"constants", true},
+        TestEvent{"addWithCallback", 5},
+    });
+  }
 };
 
 } // namespace ReactNativeIntegrationTests
@@ -0,0 +1,186 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include <JSI/JsiReactModule.h>
+#include <NativeModules.h>
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "TestEventService.h"
+#include "TestReactNativeHostHolder.h"
+
+using namespace winrt;
+using namespace Microsoft::ReactNative;
+
+namespace ReactNativeIntegrationTests {
+
+#ifdef PERF_TESTS
+
+// Use anonymous namespace to avoid any linking conflicts
+namespace {
+
+static void PrintResult(const char *testName, uint32_t iterations, LONGLONG accu) {
+  LARGE_INTEGER freq{0};
+  TestCheck(QueryPerformanceFrequency(&freq));
+  std::stringstream ss;
+
+  double time = static_cast<double>(accu) / freq.QuadPart;
+  ss << testName << ": its=" << iterations << "; accu=" << accu << "; freq=" << freq.QuadPart << "; tt=" << time
+     << " s; tc=" << time / iterations * std::pow(10, 9) << " ns";
+  std::cout << ss.str() << std::endl;
+}
+
+// The struct has 20 fields to compare JsiValueCodec with IJSValueReader and IJSValueWriter.
+REACT_STRUCT(PerfStruct)
+struct PerfStruct {
+  REACT_FIELD(Id, L"id")
+  int Id{0};
+
+  REACT_FIELD(Name, L"name")
+  std::string Name;
+
+  REACT_FIELD(X, L"x")
+  double X{0};
+
+  REACT_FIELD(Y, L"y")
+  double Y{0};
+
+  REACT_FIELD(Width, L"width")
+  double Width{0};
+
+  REACT_FIELD(Height, L"height")
+  double Height{0};
+
+  REACT_FIELD(IsVisible, L"isVisible")
+  bool IsVisible{false};
+
+  REACT_FIELD(IsEnabled, L"isEnabled")
+  bool IsEnabled{false};
+
+  REACT_FIELD(Title, L"title")
+  std::string Title;
+
+  REACT_FIELD(Subtitle, L"subtitle")
+  std::string Subtitle;
+
+  REACT_FIELD(Count, L"count")
+  int Count{0};
+
+  REACT_FIELD(Scale, L"scale")
+  double Scale{0};
+
+  REACT_FIELD(Opacity, L"opacity")
+  double Opacity{0};
+
+  REACT_FIELD(Color, L"color")
+  std::string Color;
+
+  REACT_FIELD(Tag, L"tag")
+  int64_t Tag{0};
+
+  REACT_FIELD(IsSelected, L"isSelected")
+  bool IsSelected{false};
+
+  REACT_FIELD(Note, L"note")
+  std::optional<std::string> Note;
+
+  REACT_FIELD(Rotation, L"rotation")
+  double Rotation{0};
+
+  REACT_FIELD(Order, L"order")
+  int Order{0};
+
+  REACT_FIELD(Tags, L"tags")
+  std::vector<std::string> Tags;
+};
+
+// The JavaScript benchmarks call the synchronous startTimer and stopTimer methods around their loops.
+REACT_MODULE(PerfTurboModule)
+struct PerfTurboModule {
+  REACT_METHOD(LogAction, L"logAction")
+  void LogAction(std::string actionName, JSValue value) noexcept {
+    TestEventService::LogEvent(actionName, std::move(value));
+  }
+
+  REACT_SYNC_METHOD(StartTimer, L"startTimer")
+  bool StartTimer() noexcept {
+    QueryPerformanceCounter(&m_startTime);
+    return true;
+  }
+
+  REACT_SYNC_METHOD(StopTimer, L"stopTimer")
+  bool StopTimer(std::string testName, uint32_t iterations) noexcept {
+    LARGE_INTEGER stopTime{0};
+    QueryPerformanceCounter(&stopTime);
+    PrintResult(testName.c_str(), iterations, stopTime.QuadPart - m_startTime.QuadPart);
+    return true;
+  }
+
+  REACT_SYNC_METHOD(Noop, L"noop")
+  int Noop() noexcept {
+    return 0;
+  }
+
+  REACT_SYNC_METHOD(EchoStruct, L"echoStruct")
+  PerfStruct EchoStruct(PerfStruct value) noexcept {
+    return value;
+  }
+
+ private:
+  LARGE_INTEGER m_startTime{0};
+};
+
+struct PerfTurboModuleSpec : TurboModuleSpec {
+  static constexpr auto methods = std::tuple{
+      Method<void(std::string, JSValue) noexcept>{0, L"logAction"},
+      SyncMethod<bool() noexcept>{1, L"startTimer"},
+      SyncMethod<bool(std::string, uint32_t) noexcept>{2, L"stopTimer"},
+      SyncMethod<int() noexcept>{3, L"noop"},
+      SyncMethod<PerfStruct(PerfStruct) noexcept>{4, L"echoStruct"},
+  };
+
+  template <class TModule>
+  static constexpr void ValidateModule() noexcept {
+    constexpr auto methodCheckResults = CheckMethods<TModule, PerfTurboModuleSpec>();
+
+    REACT_SHOW_METHOD_SPEC_ERRORS(0, "logAction", "Unexpected logAction signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(1, "startTimer", "Unexpected startTimer signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(2, "stopTimer", "Unexpected stopTimer signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(3, "noop", "Unexpected noop signature");
+    REACT_SHOW_METHOD_SPEC_ERRORS(4, "echoStruct", "Unexpected echoStruct signature");
+  }
+};
+
+struct PerfTurboModulePackageProvider : winrt::implements<PerfTurboModulePackageProvider, IReactPackageProvider> {
+  void CreatePackage(IReactPackageBuilder const &packageBuilder) noexcept {
+    auto experimental = packageBuilder.as<IReactPackageBuilderExperimental>();
+    experimental.AddTurboModule(L"PerfTurboModule", MakeTurboModuleProvider<PerfTurboModule, PerfTurboModuleSpec>());
+    experimental.AddTurboModule(
+        L"PerfCodecTurboModule", MakeJsiTurboModuleProvider<PerfTurboModule, PerfTurboModuleSpec>());
+  }
+};
+
+} // namespace
+
+TEST_CLASS (TurboModulePerfTests) {
+  // Compares 1M calls that read the member from the module each time with 1M calls of a saved member.
+  // The difference is the cost of TurboModuleImpl::get with the cached host functions.
+  // Then compares passing a struct with 20 fields through the module builder and through JsiValueCodec.
+  TEST_METHOD(TimeTurboModuleCalls) {
+    TestEventService::Initialize();
+
+    auto reactNativeHost = TestReactNativeHostHolder(L"TurboModulePerfTests", [](ReactNativeHost const &host) noexcept {
+      host.PackageProviders().Append(winrt::make<PerfTurboModulePackageProvider>());
+    });
+
+    TestEventService::ObserveEvents({TestEvent{"done", true}});
+  }
+};
+
+#endif // PERF_TESTS
+
+} // namespace ReactNativeIntegrationTests
@@ -0,0 +1,44 @@
+import * as TurboModuleRegistry from '../Libraries/TurboModule/TurboModuleRegistry';
+const perfTurboModule = TurboModuleRegistry.getEnforcing('PerfTurboModule');
+const perfCodecTurboModule = TurboModuleRegistry.getEnforcing('PerfCodecTurboModule');
+
+// Each benchmark is timed by the native startTimer and stopTimer methods.
+const iterations = 1000000;
+
+// Every call reads the member from the module, so it includes the TurboModuleImpl::get cost.
+perfTurboModule.startTimer();
+for (let i = 0; i < iterations; ++i) {
+  perfTurboModule.noop();
+}
+perfTurboModule.stopTimer('TimeCallModuleMember', iterations);
+
+// The member is read once, so the calls do not include the TurboModuleImpl::get cost.
+const noop = perfTurboModule.noop;
+perfTurboModule.startTimer();
+for (let i = 0; i < iterations; ++i) {
+  noop();
+}
+perfTurboModule.stopTimer('TimeCallSavedMember', iterations);
+
+// The same module is registered with the module builder and with JsiValueCodec.
+const structIterations = 100000;
+const perfStruct = {
+  id: 1, name: 'item', x: 10.5, y: 20.5, width: 100, height: 50,
+  isVisible: true, isEnabled: false, title: 'Title', subtitle: 'Subtitle',
+  count: 7, scale: 1.5, opacity: 0.75, color: '#ff0000', tag: 123456789,
+  isSelected: true, note: null, rotation: 90, order: 3, tags: ['a', 'b', 'c'],
+};
+
+function timeEchoStruct(module, testName) {
+  const echoStruct = module.echoStruct;
+  module.startTimer();
+  for (let i = 0; i < structIterations; ++i) {
+    echoStruct(perfStruct);
+  }
+  module.stopTimer(testName, structIterations);
+}
+
+timeEchoStruct(perfTurboModule, 'TimeEchoStructWithModuleBuilder');
+timeEchoStruct(perfCodecTurboModule, 'TimeEchoStructWithJsiValueCodec');
+
+perfTurboModule.logAction('done', true);
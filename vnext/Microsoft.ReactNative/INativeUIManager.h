@@ -43,7 +43,8 @@ struct INativeUIManager {
   virtual void setHost(INativeUIManagerHost *host) = 0;
   virtual INativeUIManagerHost *getHost() = 0;
   virtual void AddRootView(ShadowNode &shadowNode, facebook::react::IReactRootView *pReactRootView) = 0;
-  virtual void CreateView(ShadowNode &shadowNode, winrt::Microsoft::ReactNative::JSValueObject &props) = 0;
+  virtual void
+  CreateView(ShadowNode &shadowNode, int64_t rootTag, winrt::Microsoft::ReactNative::JSValueObject &props) = 0;
   virtual void AddView(ShadowNode &parentShadowNode, ShadowNode &childShadowNode, uint64_t index) = 0;
   virtual void RemoveView(ShadowNode &shadowNode, bool removeChildren = true) = 0;
   virtual void ReplaceView(ShadowNode &shadowNode) = 0;
@@ -6,6 +6,7 @@
 #include <UI.Xaml.Controls.h>
 #include <UI.Xaml.Input.h>
 #include <UI.Xaml.Media.h>
+#include <Utils/PerfectHashMap.h>
 #include <Views/ShadowNodeBase.h>
 #include "Modules/I18nManagerModule.h"
 #include "NativeUIManager.h"
@@ -16,6 +17,10 @@
 #include "ReactRootViewTagGenerator.h"
 #include "Unicode.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 namespace winrt {
 using namespace Windows::Foundation;
 using namespace Windows::UI;
@@ -26,11 +31,6 @@ using namespace xaml::Media;
 
 namespace Microsoft::ReactNative {
 
-static YogaNodePtr make_yoga_node(YGConfigRef config) {
-  YogaNodePtr result(YGNodeNewWithConfig(config));
-  return result;
-}
-
 #if defined(_DEBUG)
 static int YogaLog(
     const YGConfigRef /*config*/,
@@ -60,11 +60,148 @@ static int YogaLog(
 }
 #endif
 
+namespace {
+
+// Root view size and its Yoga node to lay out.
+struct RootLayout {
+  YGNodeRef node;
+  float width;
+  float height;
+};
+
+void CalculateRootLayout(const RootLayout &rootLayout) {
+  // We must always run layout in LTR mode, which might seem unintuitive.
+  // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
+  // which will inherit down the XAML tree, allowing all native controls to pick it up.
+  YGNodeCalculateLayout(rootLayout.node, rootLayout.width, rootLayout.height, YGDirectionLTR);
+}
+
+YGSize CallYogaMeasureFunc(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  YogaContext *context = reinterpret_cast<YogaContext *>(YGNodeGetContext(node));
+  return context->measureFunc(node, width, widthMode, height, heightMode);
+}
+
+// Lays out independent root views on the concurrent queue.
+// The XAML elements can only be measured on the UI thread. The layout threads pass their measure requests
+// to the UI thread, and the UI thread runs them while it waits for the layout to complete.
+class ParallelRootLayout {
+ public:
+  static ParallelRootLayout *Current() noexcept {
+    return s_currentTls;
+  }
+
+  // Runs on the UI thread and returns when all roots are laid out.
+  void Run(const std::vector<RootLayout> &rootLayouts) {
+    m_pendingLayoutCount = rootLayouts.size();
+    for (const RootLayout &rootLayout : rootLayouts) {
+      Mso::DispatchQueue::ConcurrentQueue().Post(Mso::MakeDispatchTask(
+          [this, rootLayout]() noexcept {
+            s_currentTls = this;
+            CalculateRootLayout(rootLayout);
+            s_currentTls = nullptr;
+
+            // Notify under the lock because the UI thread destroys this object as soon as the count is zero.
+            std::lock_guard<std::mutex> lock{m_mutex};
+            --m_pendingLayoutCount;
+            m_condition.notify_all();
+          },
+          [this, rootLayout]() noexcept {
+            // The queue cancels the task when it is shut down. The UI thread lays out the root instead.
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_cancelledLayouts.push_back(rootLayout);
+            --m_pendingLayoutCount;
+            m_condition.notify_all();
+          }));
+    }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    for (;;) {
+      m_condition.wait(lock, [this]() { return !m_measureRequests.empty() || m_pendingLayoutCount == 0; });
+      if (m_measureRequests.empty()) {
+        break;
+      }
+
+      MeasureRequest &request = *m_measureRequests.front();
+      m_measureRequests.pop_front();
+      lock.unlock();
+      request.result =
+          CallYogaMeasureFunc(request.node, request.width, request.widthMode, request.height, request.heightMode);
+      lock.lock();
+      request.isDone = true;
+      m_condition.notify_all();
+    }
+
+    lock.unlock();
+    for (const RootLayout &rootLayout : m_cancelledLayouts) {
+      CalculateRootLayout(rootLayout);
+    }
+  }
+
+  // Runs on a layout thread and blocks until the UI thread measures the node.
+  YGSize Measure(YGNodeRef node, float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode) {
+    MeasureRequest request{node, width, widthMode, height, heightMode};
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_measureRequests.push_back(&request);
+    m_condition.notify_all();
+    m_condition.wait(lock, [&request]() { return request.isDone; });
+    return request.result;
+  }
+
+ private:
+  struct MeasureRequest {
+    YGNodeRef node;
+    float width;
+    YGMeasureMode widthMode;
+    float height;
+    YGMeasureMode heightMode;
+    YGSize result{};
+    bool isDone{false};
+  };
+
+  static thread_local ParallelRootLayout *s_currentTls;
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<MeasureRequest *> m_measureRequests;
+  std::vector<RootLayout> m_cancelledLayouts;
+  size_t m_pendingLayoutCount{0};
+};
+
+thread_local ParallelRootLayout *ParallelRootLayout::s_currentTls{nullptr};
+
+// Measure function of all self measured Yoga nodes. It calls the view manager's measure function on the UI thread.
+YGSize MeasureYogaNode(YGNodeRef node, float width, YGMeasureMode widthMode, float height, YGMeasureMode heightMode) {
+  if (ParallelRootLayout *parallelLayout = ParallelRootLayout::Current()) {
+    return parallelLayout->Measure(node, width, widthMode, height, heightMode);
+  }
+
+  return CallYogaMeasureFunc(node, width, widthMode, height, heightMode);
+}
+
+} // namespace
+
 YGNodeRef NativeUIManager::GetYogaNode(int64_t tag) const {
-  auto iter = m_tagsToYogaNodes.find(tag);
-  if (iter == m_tagsToYogaNodes.end())
+  auto yogaNode = m_tagsToYogaNodes.Find(tag);
+  if (yogaNode == nullptr)
     return nullptr;
-  return iter->second.get();
+  return yogaNode->get();
+}
+
+YogaNodePtr NativeUIManager::MakeYogaNode(int64_t rootTag) {
+  if (m_useYogaNodeArena) {
+    auto iter = m_rootTagsToYogaNodeArenas.find(rootTag);
+    if (iter != m_rootTagsToYogaNodeArenas.end()) {
+      const auto &arena = iter->second;
+      return YogaNodePtr(arena->NewNode(m_yogaConfig), YogaNodeDeleter{arena});
+    }
+  }
+
+  return YogaNodePtr(YGNodeNewWithConfig(m_yogaConfig));
 }
 
 void NativeUIManager::DirtyYogaNode(int64_t tag) {
@@ -134,6 +271,9 @@ NativeUIManager::NativeUIManager(winrt::Microsoft::ReactNative::ReactContext con
   m_yogaConfig = YGConfigNew();
   if (React::implementation::QuirkSettings::GetMatchAndroidAndIOSStretchBehavior(m_context.Properties()))
     YGConfigSetUseLegacyStretchBehaviour(m_yogaConfig, true);
+  m_useYogaNodeArena = React::implementation::QuirkSettings::GetUseYogaNodeArena(m_context.Properties());
+  m_useParallelRootLayout = React::implementation::QuirkSettings::GetUseParallelRootLayout(m_context.Properties());
+  m_useMeasureCache = React::implementation::QuirkSettings::GetUseYogaMeasureCache(m_context.Properties());
 
 #if defined(_DEBUG)
   YGConfigSetLogger(m_yogaConfig, &YogaLog);
@@ -225,7 +365,11 @@ void NativeUIManager::AddRootView(ShadowNode &shadowNode, facebook::react::IReac
   view.as<xaml::FrameworkElement>().FlowDirection(
       I18nManager::IsRTL(m_context.Properties()) ? xaml::FlowDirection::RightToLeft : xaml::FlowDirection::LeftToRight);
 
-  m_tagsToYogaNodes.emplace(shadowNode.m_tag, make_yoga_node(m_yogaConfig));
+  if (m_useYogaNodeArena) {
+    m_rootTagsToYogaNodeArenas.emplace(shadowNode.m_tag, std::make_shared<YogaNodeArena>());
+  }
+
+  m_tagsToYogaNodes.Emplace(shadowNode.m_tag, MakeYogaNode(shadowNode.m_tag));
 
   auto element = view.as<xaml::FrameworkElement>();
   element.Tag(winrt::PropertyValue::CreateInt64(shadowNode.m_tag));
@@ -238,6 +382,9 @@ void NativeUIManager::AddRootView(ShadowNode &shadowNode, facebook::react::IReac
 void NativeUIManager::removeRootView(Microsoft::ReactNative::ShadowNode &shadow) {
   m_tagsToXamlReactControl.erase(shadow.m_tag);
   RemoveView(shadow, true);
+
+  // Yoga nodes that are still alive keep the arena until they are removed.
+  m_rootTagsToYogaNodeArenas.erase(shadow.m_tag);
 }
 
 void NativeUIManager::onBatchComplete() {
@@ -399,365 +546,396 @@ static void SetYogaValueAutoHelper(
   }
 }
 
-static void StyleYogaNode(
+template <class TEnum, size_t N, uint32_t Seed>
+static TEnum EnumOrDefault(
+    const winrt::Microsoft::ReactNative::JSValue &value,
+    TEnum defaultValue,
+    const PerfectHashMap<TEnum, N, Seed> &values) {
+  if (auto str = value.TryGetString()) {
+    if (auto result = values.Find(*str)) {
+      return *result;
+    }
+  } else if (value.IsNull()) {
+    return defaultValue;
+  }
+
+  assert(false);
+  return defaultValue;
+}
+
+static constexpr auto FlexDirectionValues = MakePerfectHashMap<YGFlexDirection>({
+    {"column", YGFlexDirectionColumn},
+    {"row", YGFlexDirectionRow},
+    {"column-reverse", YGFlexDirectionColumnReverse},
+    {"row-reverse", YGFlexDirectionRowReverse},
+});
+
+static constexpr auto JustifyValues = MakePerfectHashMap<YGJustify>({
+    {"flex-start", YGJustifyFlexStart},
+    {"flex-end", YGJustifyFlexEnd},
+    {"center", YGJustifyCenter},
+    {"space-between", YGJustifySpaceBetween},
+    {"space-around", YGJustifySpaceAround},
+    {"space-evenly", YGJustifySpaceEvenly},
+});
+
+static constexpr auto WrapValues = MakePerfectHashMap<YGWrap>({
+    {"nowrap", YGWrapNoWrap},
+    {"wrap", YGWrapWrap},
+});
+
+static constexpr auto AlignItemsValues = MakePerfectHashMap<YGAlign>({
+    {"stretch", YGAlignStretch},
+    {"flex-start", YGAlignFlexStart},
+    {"flex-end", YGAlignFlexEnd},
+    {"center", YGAlignCenter},
+    {"baseline", YGAlignBaseline},
+});
+
+static constexpr auto AlignSelfValues = MakePerfectHashMap<YGAlign>({
+    {"auto", YGAlignAuto},
+    {"stretch", YGAlignStretch},
+    {"flex-start", YGAlignFlexStart},
+    {"flex-end", YGAlignFlexEnd},
+    {"center", YGAlignCenter},
+    {"baseline", YGAlignBaseline},
+});
+
+static constexpr auto AlignContentValues = MakePerfectHashMap<YGAlign>({
+    {"stretch", YGAlignStretch},
+    {"flex-start", YGAlignFlexStart},
+    {"flex-end", YGAlignFlexEnd},
+    {"center", YGAlignCenter},
+    {"space-between", YGAlignSpaceBetween},
+    {"space-around", YGAlignSpaceAround},
+});
+
+static constexpr auto PositionTypeValues = MakePerfectHashMap<YGPositionType>({
+    {"relative", YGPositionTypeRelative},
+    {"absolute", YGPositionTypeAbsolute},
+    {"static", YGPositionTypeStatic},
+});
+
+static constexpr auto OverflowValues = MakePerfectHashMap<YGOverflow>({
+    {"visible", YGOverflowVisible},
+    {"hidden", YGOverflowHidden},
+    {"scroll", YGOverflowScroll},
+});
+
+static constexpr auto DisplayValues = MakePerfectHashMap<YGDisplay>({
+    {"flex", YGDisplayFlex},
+    {"none", YGDisplayNone},
+});
+
+using StyleYogaPropSetter = void (*)(
     ShadowNodeBase &shadowNode,
     const YGNodeRef yogaNode,
-    const winrt::Microsoft::ReactNative::JSValueObject &props) {
-  for (const auto &pair : props) {
-    const std::string &key = pair.first;
-    const auto &value = pair.second;
-
-    if (key == "flexDirection") {
-      YGFlexDirection direction = YGFlexDirectionColumn;
-
-      if (value == "column" || value.IsNull())
-        direction = YGFlexDirectionColumn;
-      else if (value == "row")
-        direction = YGFlexDirectionRow;
-      else if (value == "column-reverse")
-        direction = YGFlexDirectionColumnReverse;
-      else if (value == "row-reverse")
-        direction = YGFlexDirectionRowReverse;
-      else
-        assert(false);
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value);
 
-      YGNodeStyleSetFlexDirection(yogaNode, direction);
-    } else if (key == "justifyContent") {
-      YGJustify justify = YGJustifyFlexStart;
-
-      if (value == "flex-start" || value.IsNull())
-        justify = YGJustifyFlexStart;
-      else if (value == "flex-end")
-        justify = YGJustifyFlexEnd;
-      else if (value == "center")
-        justify = YGJustifyCenter;
-      else if (value == "space-between")
-        justify = YGJustifySpaceBetween;
-      else if (value == "space-around")
-        justify = YGJustifySpaceAround;
-      else if (value == "space-evenly")
-        justify = YGJustifySpaceEvenly;
-      else
-        assert(false);
+static void SetFlexDirection(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetFlexDirection(yogaNode, EnumOrDefault(value, YGFlexDirectionColumn, FlexDirectionValues));
+}
 
-      YGNodeStyleSetJustifyContent(yogaNode, justify);
-    } else if (key == "flexWrap") {
-      YGWrap wrap = YGWrapNoWrap;
+static void SetJustifyContent(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetJustifyContent(yogaNode, EnumOrDefault(value, YGJustifyFlexStart, JustifyValues));
+}
 
-      if (value == "nowrap" || value.IsNull())
-        wrap = YGWrapNoWrap;
-      else if (value == "wrap")
-        wrap = YGWrapWrap;
-      else
-        assert(false);
+static void SetFlexWrap(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetFlexWrap(yogaNode, EnumOrDefault(value, YGWrapNoWrap, WrapValues));
+}
 
-      YGNodeStyleSetFlexWrap(yogaNode, wrap);
-    } else if (key == "alignItems") {
-      YGAlign align = YGAlignStretch;
-
-      if (value == "stretch" || value.IsNull())
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+static void SetAlignItems(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetAlignItems(yogaNode, EnumOrDefault(value, YGAlignStretch, AlignItemsValues));
+}
 
-      YGNodeStyleSetAlignItems(yogaNode, align);
-    } else if (key == "alignSelf") {
-      YGAlign align = YGAlignAuto;
-
-      if (value == "auto" || value.IsNull())
-        align = YGAlignAuto;
-      else if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start")
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "baseline")
-        align = YGAlignBaseline;
-      else
-        assert(false);
+static void SetAlignSelf(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetAlignSelf(yogaNode, EnumOrDefault(value, YGAlignAuto, AlignSelfValues));
+}
 
-      YGNodeStyleSetAlignSelf(yogaNode, align);
-    } else if (key == "alignContent") {
-      YGAlign align = YGAlignFlexStart;
-
-      if (value == "stretch")
-        align = YGAlignStretch;
-      else if (value == "flex-start" || value.IsNull())
-        align = YGAlignFlexStart;
-      else if (value == "flex-end")
-        align = YGAlignFlexEnd;
-      else if (value == "center")
-        align = YGAlignCenter;
-      else if (value == "space-between")
-        align = YGAlignSpaceBetween;
-      else if (value == "space-around")
-        align = YGAlignSpaceAround;
-      else
-        assert(false);
+static void SetAlignContent(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetAlignContent(yogaNode, EnumOrDefault(value, YGAlignFlexStart, AlignContentValues));
+}
 
-      YGNodeStyleSetAlignContent(yogaNode, align);
-    } else if (key == "flex") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlex(yogaNode, result);
-    } else if (key == "flexGrow") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexGrow(yogaNode, result);
-    } else if (key == "flexShrink") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
-
-      YGNodeStyleSetFlexShrink(yogaNode, result);
-    } else if (key == "flexBasis") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
-    } else if (key == "position") {
-      YGPositionType position = YGPositionTypeRelative;
-
-      if (value == "relative" || value.IsNull())
-        position = YGPositionTypeRelative;
-      else if (value == "absolute")
-        position = YGPositionTypeAbsolute;
-      else if (value == "static")
-        position = YGPositionTypeStatic;
-      else
-        assert(false);
+static void SetPositionType(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetPositionType(yogaNode, EnumOrDefault(value, YGPositionTypeRelative, PositionTypeValues));
+}
 
-      YGNodeStyleSetPositionType(yogaNode, position);
-    } else if (key == "overflow") {
-      YGOverflow overflow = YGOverflowVisible;
-      if (value == "visible" || value.IsNull())
-        overflow = YGOverflowVisible;
-      else if (value == "hidden")
-        overflow = YGOverflowHidden;
-      else if (value == "scroll")
-        overflow = YGOverflowScroll;
-
-      YGNodeStyleSetOverflow(yogaNode, overflow);
-    } else if (key == "display") {
-      YGDisplay display = YGDisplayFlex;
-      if (value == "flex" || value.IsNull())
-        display = YGDisplayFlex;
-      else if (value == "none")
-        display = YGDisplayNone;
-
-      YGNodeStyleSetDisplay(yogaNode, display);
-    } else if (key == "direction") {
-      // https://github.com/microsoft/react-native-windows/issues/4668
-      // In order to support the direction property, we tell yoga to always layout
-      // in LTR direction, then push the appropriate FlowDirection into XAML.
-      // This way XAML handles flipping in RTL mode, which works both for RN components
-      // as well as native components that have purely XAML sub-trees (eg ComboBox).
-      YGDirection direction = YGDirectionLTR;
-
-      YGNodeStyleSetDirection(yogaNode, direction);
-    } else if (key == "aspectRatio") {
-      float result = NumberOrDefault(value, 1.0f /*default*/);
-
-      YGNodeStyleSetAspectRatio(yogaNode, result);
-    } else if (key == "left") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "top") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "right") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "bottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "end") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "start") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
-    } else if (key == "width") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
-    } else if (key == "minWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
-    } else if (key == "maxWidth") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
-    } else if (key == "height") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueAutoHelper(
-          yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
-    } else if (key == "minHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
-    } else if (key == "maxHeight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
-    } else if (key == "margin") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeAll, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginLeft") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeLeft, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginStart") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeStart, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginTop") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeTop, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeRight, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginEnd") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeEnd, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginBottom") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode, YGEdgeBottom, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
-    } else if (key == "marginHorizontal") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeHorizontal,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "marginVertical") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-      SetYogaValueAutoHelper(
-          yogaNode,
-          YGEdgeVertical,
-          result,
-          YGNodeStyleSetMargin,
-          YGNodeStyleSetMarginPercent,
-          YGNodeStyleSetMarginAuto);
-    } else if (key == "padding") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
-
-        SetYogaValueHelper(yogaNode, YGEdgeAll, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingLeft") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetOverflow(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetOverflow(yogaNode, EnumOrDefault(value, YGOverflowVisible, OverflowValues));
+}
 
-        SetYogaValueHelper(yogaNode, YGEdgeLeft, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingStart") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetDisplay(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetDisplay(yogaNode, EnumOrDefault(value, YGDisplayFlex, DisplayValues));
+}
 
-        SetYogaValueHelper(yogaNode, YGEdgeStart, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingTop") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetDirection(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue & /*value*/) {
+  // https://github.com/microsoft/react-native-windows/issues/4668
+  // In order to support the direction property, we tell yoga to always layout
+  // in LTR direction, then push the appropriate FlowDirection into XAML.
+  // This way XAML handles flipping in RTL mode, which works both for RN components
+  // as well as native components that have purely XAML sub-trees (eg ComboBox).
+  YGNodeStyleSetDirection(yogaNode, YGDirectionLTR);
+}
 
-        SetYogaValueHelper(yogaNode, YGEdgeTop, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingRight") {
-      YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetFlex(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetFlex(yogaNode, NumberOrDefault(value, 0.0f /*default*/));
+}
 
-      SetYogaValueHelper(yogaNode, YGEdgeRight, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-    } else if (key == "paddingEnd") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetFlexGrow(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetFlexGrow(yogaNode, NumberOrDefault(value, 0.0f /*default*/));
+}
 
-        SetYogaValueHelper(yogaNode, YGEdgeEnd, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingBottom") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetFlexShrink(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetFlexShrink(yogaNode, NumberOrDefault(value, 0.0f /*default*/));
+}
 
-        SetYogaValueHelper(yogaNode, YGEdgeBottom, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingHorizontal") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetAspectRatio(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetAspectRatio(yogaNode, NumberOrDefault(value, 1.0f /*default*/));
+}
 
-        SetYogaValueHelper(yogaNode, YGEdgeHorizontal, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "paddingVertical") {
-      if (!shadowNode.ImplementsPadding()) {
-        YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+static void SetFlexBasis(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-        SetYogaValueHelper(yogaNode, YGEdgeVertical, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
-      }
-    } else if (key == "borderWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+  SetYogaUnitValueAutoHelper(
+      yogaNode, result, YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
+}
+
+static void SetWidth(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+  SetYogaUnitValueAutoHelper(
+      yogaNode, result, YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
+}
+
+static void SetMinWidth(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
+
+  SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent);
+}
+
+static void SetMaxWidth(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+  SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent);
+}
+
+static void SetHeight(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+  SetYogaUnitValueAutoHelper(
+      yogaNode, result, YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
+}
+
+static void SetMinHeight(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{0.0f, YGUnitPoint} /*default*/, shadowNode, key);
+
+  SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent);
+}
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeAll, result);
-    } else if (key == "borderLeftWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+static void SetMaxHeight(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
+
+  SetYogaUnitValueHelper(yogaNode, result, YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent);
+}
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeLeft, result);
-    } else if (key == "borderStartWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+template <YGEdge edge>
+static void SetPosition(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeStart, result);
-    } else if (key == "borderTopWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+  SetYogaValueHelper(yogaNode, edge, result, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent);
+}
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeTop, result);
-    } else if (key == "borderRightWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+template <YGEdge edge>
+static void SetMargin(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeRight, result);
-    } else if (key == "borderEndWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+  SetYogaValueAutoHelper(
+      yogaNode, edge, result, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+}
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeEnd, result);
-    } else if (key == "borderBottomWidth") {
-      float result = NumberOrDefault(value, 0.0f /*default*/);
+template <YGEdge edge>
+static void SetPadding(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const std::string &key,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  if (!shadowNode.ImplementsPadding()) {
+    YGValue result = YGValueOrDefault(value, YGValue{YGUndefined, YGUnitPoint} /*default*/, shadowNode, key);
 
-      YGNodeStyleSetBorder(yogaNode, YGEdgeBottom, result);
+    SetYogaValueHelper(yogaNode, edge, result, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent);
+  }
+}
+
+template <YGEdge edge>
+static void SetBorder(
+    ShadowNodeBase & /*shadowNode*/,
+    const YGNodeRef yogaNode,
+    const std::string & /*key*/,
+    const winrt::Microsoft::ReactNative::JSValue &value) {
+  YGNodeStyleSetBorder(yogaNode, edge, NumberOrDefault(value, 0.0f /*default*/));
+}
+
+// Seed 9 is the first seed that maps all the prop names to distinct slots.
+static constexpr auto StyleYogaPropSetters = MakePerfectHashMap<StyleYogaPropSetter, /*Seed:*/ 9>({
+    {"flexDirection", SetFlexDirection},
+    {"justifyContent", SetJustifyContent},
+    {"flexWrap", SetFlexWrap},
+    {"alignItems", SetAlignItems},
+    {"alignSelf", SetAlignSelf},
+    {"alignContent", SetAlignContent},
+    {"flex", SetFlex},
+    {"flexGrow", SetFlexGrow},
+    {"flexShrink", SetFlexShrink},
+    {"flexBasis", SetFlexBasis},
+    {"position", SetPositionType},
+    {"overflow", SetOverflow},
+    {"display", SetDisplay},
+    {"direction", SetDirection},
+    {"aspectRatio", SetAspectRatio},
+    {"left", SetPosition<YGEdgeLeft>},
+    {"top", SetPosition<YGEdgeTop>},
+    {"right", SetPosition<YGEdgeRight>},
+    {"bottom", SetPosition<YGEdgeBottom>},
+    {"end", SetPosition<YGEdgeEnd>},
+    {"start", SetPosition<YGEdgeStart>},
+    {"width", SetWidth},
+    {"minWidth", SetMinWidth},
+    {"maxWidth", SetMaxWidth},
+    {"height", SetHeight},
+    {"minHeight", SetMinHeight},
+    {"maxHeight", SetMaxHeight},
+    {"margin", SetMargin<YGEdgeAll>},
+    {"marginLeft", SetMargin<YGEdgeLeft>},
+    {"marginStart", SetMargin<YGEdgeStart>},
+    {"marginTop", SetMargin<YGEdgeTop>},
+    {"marginRight", SetMargin<YGEdgeRight>},
+    {"marginEnd", SetMargin<YGEdgeEnd>},
+    {"marginBottom", SetMargin<YGEdgeBottom>},
+    {"marginHorizontal", SetMargin<YGEdgeHorizontal>},
+    {"marginVertical", SetMargin<YGEdgeVertical>},
+    {"padding", SetPadding<YGEdgeAll>},
+    {"paddingLeft", SetPadding<YGEdgeLeft>},
+    {"paddingStart", SetPadding<YGEdgeStart>},
+    {"paddingTop", SetPadding<YGEdgeTop>},
+    {"paddingRight", SetPadding<YGEdgeRight>},
+    {"paddingEnd", SetPadding<YGEdgeEnd>},
+    {"paddingBottom", SetPadding<YGEdgeBottom>},
+    {"paddingHorizontal", SetPadding<YGEdgeHorizontal>},
+    {"paddingVertical", SetPadding<YGEdgeVertical>},
+    {"borderWidth", SetBorder<YGEdgeAll>},
+    {"borderLeftWidth", SetBorder<YGEdgeLeft>},
+    {"borderStartWidth", SetBorder<YGEdgeStart>},
+    {"borderTopWidth", SetBorder<YGEdgeTop>},
+    {"borderRightWidth", SetBorder<YGEdgeRight>},
+    {"borderEndWidth", SetBorder<YGEdgeEnd>},
+    {"borderBottomWidth", SetBorder<YGEdgeBottom>},
+});
+
+static void StyleYogaNode(
+    ShadowNodeBase &shadowNode,
+    const YGNodeRef yogaNode,
+    const winrt::Microsoft::ReactNative::JSValueObject &props) {
+  for (const auto &pair : props) {
+    if (auto setter = StyleYogaPropSetters.Find(pair.first)) {
+      (*setter)(shadowNode, yogaNode, pair.first, pair.second);
     }
   }
 }
 
-void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &props) {
+void NativeUIManager::CreateView(ShadowNode &shadowNode, int64_t rootTag, React::JSValueObject &props) {
   ShadowNodeBase &node = static_cast<ShadowNodeBase &>(shadowNode);
   auto *pViewManager = node.GetViewManager();
 
@@ -767,16 +945,18 @@ void NativeUIManager::CreateView(ShadowNode &shadowNode, React::JSValueObject &p
       m_extraLayoutNodes.push_back(node.m_tag);
     }
 
-    auto result = m_tagsToYogaNodes.emplace(node.m_tag, make_yoga_node(m_yogaConfig));
+    auto result = m_tagsToYogaNodes.Emplace(node.m_tag, MakeYogaNode(rootTag));
     if (result.second == true) {
-      YGNodeRef yogaNode = result.first->second.get();
+      YGNodeRef yogaNode = result.first->get();
       StyleYogaNode(node, yogaNode, props);
 
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
-        YGNodeSetMeasureFunc(yogaNode, func);
+        YGNodeSetMeasureFunc(yogaNode, &MeasureYogaNode);
 
         auto context = std::make_unique<Microsoft::ReactNative::YogaContext>(node.GetView());
+        context->measureFunc = func;
+        context->useMeasureCache = m_useMeasureCache;
         YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
 
         m_tagsToYogaContext.emplace(node.m_tag, std::move(context));
@@ -820,7 +1000,7 @@ void NativeUIManager::RemoveView(ShadowNode &shadowNode, bool removeChildren /*=
     }
   }
 
-  m_tagsToYogaNodes.erase(node.m_tag);
+  m_tagsToYogaNodes.Erase(node.m_tag);
   m_tagsToYogaContext.erase(node.m_tag);
 }
 
@@ -836,6 +1016,8 @@ void NativeUIManager::ReplaceView(ShadowNode &shadowNode) {
       YGMeasureFunc func = pViewManager->GetYogaCustomMeasureFunc();
       if (func != nullptr) {
         auto context = std::make_unique<YogaContext>(node.GetView());
+        context->measureFunc = func;
+        context->useMeasureCache = m_useMeasureCache;
         YGNodeSetContext(yogaNode, reinterpret_cast<void *>(context.get()));
 
         m_tagsToYogaContext.erase(node.m_tag);
@@ -889,6 +1071,8 @@ void NativeUIManager::DoLayout() {
   // Values need to be cleared from the vector before next call to DoLayout.
   m_extraLayoutNodes.clear();
   auto &rootTags = m_host->GetAllRootTags();
+  std::vector<RootLayout> rootLayouts;
+  rootLayouts.reserve(rootTags.size());
   for (int64_t rootTag : rootTags) {
     UpdateExtraLayout(rootTag);
 
@@ -898,30 +1082,47 @@ void NativeUIManager::DoLayout() {
 
     float actualWidth = static_cast<float>(rootElement.ActualWidth());
     float actualHeight = static_cast<float>(rootElement.ActualHeight());
+    rootLayouts.push_back({rootNode, actualWidth, actualHeight});
+  }
 
-    // We must always run layout in LTR mode, which might seem unintuitive.
-    // We will flip the root of the tree into RTL by forcing the root XAML node's FlowDirection to RightToLeft
-    // which will inherit down the XAML tree, allowing all native controls to pick it up.
-    YGNodeCalculateLayout(rootNode, actualWidth, actualHeight, YGDirectionLTR);
+  // Root views do not share Yoga nodes, and they can be laid out independently.
+  if (m_useParallelRootLayout && rootLayouts.size() > 1) {
+    ParallelRootLayout{}.Run(rootLayouts);
+  } else {
+    for (const RootLayout &rootLayout : rootLayouts) {
+      CalculateRootLayout(rootLayout);
+    }
   }
 
-  for (auto &tagToYogaNode : m_tagsToYogaNodes) {
-    int64_t tag = tagToYogaNode.first;
-    YGNodeRef yogaNode = tagToYogaNode.second.get();
+  for (int64_t rootTag : rootTags) {
+    ApplyLayout(rootTag);
+  }
+}
 
-    if (!YGNodeGetHasNewLayout(yogaNode))
-      continue;
-    YGNodeSetHasNewLayout(yogaNode, false);
+void NativeUIManager::ApplyLayout(int64_t tag) {
+  // Yoga marks a node with new layout only when it lays out the node's parent too.
+  // Thus, we only visit the subtrees with new layout instead of checking all nodes.
+  YGNodeRef yogaNode = GetYogaNode(tag);
+  if (yogaNode == nullptr || !YGNodeGetHasNewLayout(yogaNode))
+    return;
+  YGNodeSetHasNewLayout(yogaNode, false);
+
+  float left = YGNodeLayoutGetLeft(yogaNode);
+  float top = YGNodeLayoutGetTop(yogaNode);
+  float width = YGNodeLayoutGetWidth(yogaNode);
+  float height = YGNodeLayoutGetHeight(yogaNode);
 
-    float left = YGNodeLayoutGetLeft(yogaNode);
-    float top = YGNodeLayoutGetTop(yogaNode);
-    float width = YGNodeLayoutGetWidth(yogaNode);
-    float height = YGNodeLayoutGetHeight(yogaNode);
+  ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
+  auto view = shadowNode.GetView();
+  auto pViewManager = shadowNode.GetViewManager();
+  pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+
+  // Children of the native controls with self layout are not part of the Yoga tree.
+  if (pViewManager->IsNativeControlWithSelfLayout())
+    return;
 
-    ShadowNodeBase &shadowNode = static_cast<ShadowNodeBase &>(m_host->GetShadowNodeForTag(tag));
-    auto view = shadowNode.GetView();
-    auto pViewManager = shadowNode.GetViewManager();
-    pViewManager->SetLayoutProps(shadowNode, view, left, top, width, height);
+  for (int64_t child : shadowNode.m_children) {
+    ApplyLayout(child);
   }
 }
 
@@ -5,6 +5,7 @@
 
 #include <INativeUIManager.h>
 #include <IReactRootView.h>
+#include <Utils/DenseTagMap.h>
 #include <Views/ViewManagerBase.h>
 
 #include <folly/dynamic.h>
@@ -16,6 +17,7 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include "YogaNodeArena.h"
 
 namespace Microsoft::ReactNative {
 struct IXamlReactControl;
@@ -25,8 +27,15 @@ namespace Microsoft::ReactNative {
 
 struct YogaNodeDeleter {
   void operator()(YGNodeRef node) {
-    YGNodeFree(node);
+    if (arena) {
+      arena->FreeNode(node);
+    } else {
+      YGNodeFree(node);
+    }
   }
+
+  // The arena the node is allocated from, or null if the node is allocated by Yoga.
+  std::shared_ptr<YogaNodeArena> arena;
 };
 
 typedef std::unique_ptr<YGNode, YogaNodeDeleter> YogaNodePtr;
@@ -48,7 +57,10 @@ class NativeUIManager final : public INativeUIManager {
     return m_host;
   }
   void AddRootView(ShadowNode &shadowNode, facebook::react::IReactRootView *pReactRootView) override;
-  void CreateView(ShadowNode &shadowNode, winrt::Microsoft::ReactNative::JSValueObject &props) override;
+  void CreateView(
+      ShadowNode &shadowNode,
+      int64_t rootTag,
+      winrt::Microsoft::ReactNative::JSValueObject &props) override;
   void AddView(ShadowNode &parentShadowNode, ShadowNode &childShadowNode, uint64_t index) override;
   void RemoveView(ShadowNode &shadowNode, bool removeChildren = true) override;
   void ReplaceView(ShadowNode &shadowNode) override;
@@ -97,7 +109,9 @@ class NativeUIManager final : public INativeUIManager {
  private:
   void DoLayout();
   void UpdateExtraLayout(int64_t tag);
+  void ApplyLayout(int64_t tag);
   YGNodeRef GetYogaNode(int64_t tag) const;
+  YogaNodePtr MakeYogaNode(int64_t rootTag);
 
   winrt::weak_ref<winrt::Microsoft::ReactNative::ReactRootView> GetParentXamlReactControl(int64_t tag) const;
 
@@ -107,7 +121,11 @@ class NativeUIManager final : public INativeUIManager {
   YGConfigRef m_yogaConfig;
   bool m_inBatch = false;
 
-  std::map<int64_t, YogaNodePtr> m_tagsToYogaNodes;
+  DenseTagMap<YogaNodePtr> m_tagsToYogaNodes;
+  std::map<int64_t, std::shared_ptr<YogaNodeArena>> m_rootTagsToYogaNodeArenas;
+  bool m_useYogaNodeArena = false;
+  bool m_useParallelRootLayout = false;
+  bool m_useMeasureCache = false;
   std::map<int64_t, std::unique_ptr<YogaContext>> m_tagsToYogaContext;
   std::vector<xaml::FrameworkElement::SizeChanged_revoker> m_sizeChangedVector;
   std::vector<std::function<void()>> m_batchCompletedCallbacks;
@@ -134,7 +134,7 @@ class UIManagerModule : public std::enable_shared_from_this<UIManagerModule>, pu
 
     node->createView(props);
 
-    m_nativeUIManager->CreateView(*node, props);
+    m_nativeUIManager->CreateView(*node, rootTag, props);
 
     m_nodeRegistry.addNode(shadow_ptr(node), reactTag);
 
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "YogaNodeArena.h"
+
+#include <yoga/event/event.h>
+
+namespace Microsoft::ReactNative {
+
+YogaNodeArena::~YogaNodeArena() noexcept {
+  // The node owners keep the arena alive until all of its nodes are freed.
+  assert(m_nodeCount == 0);
+}
+
+YGNodeRef YogaNodeArena::NewNode(YGConfigRef config) noexcept {
+  Slot *slot = m_freeList;
+  if (slot != nullptr) {
+    m_freeList = slot->nextFree;
+  } else {
+    if (m_usedInLastSlab == SlabSize) {
+      m_slabs.push_back(std::make_unique<Slot[]>(SlabSize));
+      m_usedInLastSlab = 0;
+    }
+
+    slot = &m_slabs.back()[m_usedInLastSlab++];
+  }
+
+  ++m_nodeCount;
+  YGNodeRef node = ::new (&slot->storage) YGNode{config};
+  facebook::yoga::Event::publish<facebook::yoga::Event::NodeAllocation>(node, {config});
+  return node;
+}
+
+void YogaNodeArena::FreeNode(YGNodeRef node) noexcept {
+  if (YGNodeRef owner = node->getOwner()) {
+    owner->removeChild(node);
+    node->setOwner(nullptr);
+  }
+
+  for (YGNodeRef child : node->getChildren()) {
+    child->setOwner(nullptr);
+  }
+
+  node->clearChildren();
+  facebook::yoga::Event::publish<facebook::yoga::Event::NodeDeallocation>(node, {node->getConfig()});
+  node->~YGNode();
+
+  Slot *slot = reinterpret_cast<Slot *>(node);
+  slot->nextFree = m_freeList;
+  m_freeList = slot;
+  --m_nodeCount;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <yoga/YGNode.h>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Allocates Yoga nodes of one root view from fixed-size slabs.
+// Nodes created one after another, such as children of the same subtree, are placed next to each other
+// to improve memory locality of the Yoga layout traversal. Freed nodes return their slots to a free list.
+class YogaNodeArena {
+ public:
+  YogaNodeArena() noexcept = default;
+  YogaNodeArena(const YogaNodeArena &) = delete;
+  YogaNodeArena &operator=(const YogaNodeArena &) = delete;
+  ~YogaNodeArena() noexcept;
+
+  // Constructs a node the same way as YGNodeNewWithConfig, including the NodeAllocation event.
+  YGNodeRef NewNode(YGConfigRef config) noexcept;
+
+  // Disconnects the node from its owner and children the same way as YGNodeFree, and returns its slot.
+  // Publishes the NodeDeallocation event before the node is destroyed.
+  void FreeNode(YGNodeRef node) noexcept;
+
+ private:
+  union Slot {
+    Slot *nextFree;
+    std::aligned_storage_t<sizeof(YGNode), alignof(YGNode)> storage;
+  };
+
+  static constexpr size_t SlabSize = 256;
+
+  std::vector<std::unique_ptr<Slot[]>> m_slabs;
+  Slot *m_freeList{nullptr};
+  size_t m_usedInLastSlab{SlabSize};
+  size_t m_nodeCount{0};
+};
+
+} // namespace Microsoft::ReactNative
@@ -32,6 +32,41 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> AcceptSelfSignedCertsProper
   return propId;
 }
 
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> UseYogaNodeArenaProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> propId{L"ReactNative.QuirkSettings", L"UseYogaNodeArena"};
+  return propId;
+}
+
+/*static*/ void QuirkSettings::SetUseYogaNodeArena(
+    winrt::Microsoft::ReactNative::ReactPropertyBag properties,
+    bool value) noexcept {
+  properties.Set(UseYogaNodeArenaProperty(), value);
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> UseParallelRootLayoutProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> propId{
+      L"ReactNative.QuirkSettings", L"UseParallelRootLayout"};
+  return propId;
+}
+
+/*static*/ void QuirkSettings::SetUseParallelRootLayout(
+    winrt::Microsoft::ReactNative::ReactPropertyBag properties,
+    bool value) noexcept {
+  properties.Set(UseParallelRootLayoutProperty(), value);
+}
+
+winrt::Microsoft::ReactNative::ReactPropertyId<bool> UseYogaMeasureCacheProperty() noexcept {
+  static winrt::Microsoft::ReactNative::ReactPropertyId<bool> propId{
+      L"ReactNative.QuirkSettings", L"UseYogaMeasureCache"};
+  return propId;
+}
+
+/*static*/ void QuirkSettings::SetUseYogaMeasureCache(
+    winrt::Microsoft::ReactNative::ReactPropertyBag properties,
+    bool value) noexcept {
+  properties.Set(UseYogaMeasureCacheProperty(), value);
+}
+
 #pragma region IDL interface
 
 /*static*/ void QuirkSettings::SetMatchAndroidAndIOSStretchBehavior(
@@ -46,6 +81,18 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> AcceptSelfSignedCertsProper
   ReactPropertyBag(settings.Properties()).Set(AcceptSelfSignedCertsProperty(), value);
 }
 
+/*static*/ void QuirkSettings::SetUseYogaNodeArena(
+    winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
+    bool value) noexcept {
+  SetUseYogaNodeArena(ReactPropertyBag(settings.Properties()), value);
+}
+
+/*static*/ void QuirkSettings::SetUseParallelRootLayout(
+    winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
+    bool value) noexcept {
+  SetUseParallelRootLayout(ReactPropertyBag(settings.Properties()), value);
+}
+
 #pragma endregion IDL interface
 
 /*static*/ bool QuirkSettings::GetMatchAndroidAndIOSStretchBehavior(ReactPropertyBag properties) noexcept {
@@ -56,4 +103,16 @@ winrt::Microsoft::ReactNative::ReactPropertyId<bool> AcceptSelfSignedCertsProper
   return properties.Get(AcceptSelfSignedCertsProperty()).value_or(false);
 }
 
+/*static*/ bool QuirkSettings::GetUseYogaNodeArena(ReactPropertyBag properties) noexcept {
+  return properties.Get(UseYogaNodeArenaProperty()).value_or(false);
+}
+
+/*static*/ bool QuirkSettings::GetUseParallelRootLayout(ReactPropertyBag properties) noexcept {
+  return properties.Get(UseParallelRootLayoutProperty()).value_or(false);
+}
+
+/*static*/ bool QuirkSettings::GetUseYogaMeasureCache(ReactPropertyBag properties) noexcept {
+  return properties.Get(UseYogaMeasureCacheProperty()).value_or(false);
+}
+
 } // namespace winrt::Microsoft::ReactNative::implementation
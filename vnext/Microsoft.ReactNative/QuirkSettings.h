@@ -22,6 +22,15 @@ struct QuirkSettings : QuirkSettingsT<QuirkSettings> {
 
   static bool GetAcceptSelfSigned(winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
 
+  static void SetUseYogaNodeArena(winrt::Microsoft::ReactNative::ReactPropertyBag properties, bool value) noexcept;
+  static bool GetUseYogaNodeArena(winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
+
+  static void SetUseParallelRootLayout(winrt::Microsoft::ReactNative::ReactPropertyBag properties, bool value) noexcept;
+  static bool GetUseParallelRootLayout(winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
+
+  static void SetUseYogaMeasureCache(winrt::Microsoft::ReactNative::ReactPropertyBag properties, bool value) noexcept;
+  static bool GetUseYogaMeasureCache(winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
+
   static bool GetEnableFabric(winrt::Microsoft::ReactNative::ReactPropertyBag properties) noexcept;
 
 #pragma region Public API - part of IDL interface
@@ -30,6 +39,12 @@ struct QuirkSettings : QuirkSettingsT<QuirkSettings> {
       bool value) noexcept;
 
   static void SetAcceptSelfSigned(winrt::Microsoft::ReactNative::ReactInstanceSettings settings, bool value) noexcept;
+
+  static void SetUseYogaNodeArena(winrt::Microsoft::ReactNative::ReactInstanceSettings settings, bool value) noexcept;
+
+  static void SetUseParallelRootLayout(
+      winrt::Microsoft::ReactNative::ReactInstanceSettings settings,
+      bool value) noexcept;
 #pragma endregion Public API - part of IDL interface
 };
 
@@ -7,6 +7,8 @@
 #include "pch.h"
 #include "TurboModulesProvider.h"
 #include <ReactCommon/TurboModuleUtils.h>
+#include <algorithm>
+#include <unordered_set>
 #include "JsiApi.h"
 #include "JsiReader.h"
 #include "JsiWriter.h"
@@ -73,6 +75,58 @@ struct TurboModuleBuilder : winrt::implements<TurboModuleBuilder, IReactModuleBu
   IReactContext m_reactContext;
 };
 
+/*-------------------------------------------------------------------------------
+  TurboModuleMembers
+-------------------------------------------------------------------------------*/
+
+// Host functions created for the members of a TurboModule in the runtime that accessed the module first.
+struct TurboModuleMembers {
+  facebook::jsi::Runtime *Runtime{nullptr};
+  std::unordered_map<std::string, facebook::jsi::Function> Functions;
+};
+
+// The guard is stored in the runtime global object, so the runtime destroys it while it is torn down.
+// It releases the cached functions before the runtime is gone, even if a module outlives the runtime.
+// Resetting the runtime pointer also keeps a new runtime at the same address from getting the old functions.
+struct TurboModuleMembersGuard : facebook::jsi::HostObject {
+  ~TurboModuleMembersGuard() noexcept override {
+    for (auto &weakMembers : m_members) {
+      if (auto members = weakMembers.lock()) {
+        members->Functions.clear();
+        members->Runtime = nullptr;
+      }
+    }
+  }
+
+  static void Watch(facebook::jsi::Runtime &runtime, const std::shared_ptr<TurboModuleMembers> &members) {
+    auto global = runtime.global();
+    std::shared_ptr<TurboModuleMembersGuard> guard;
+    auto guardValue = global.getProperty(runtime, GuardPropertyName);
+    if (guardValue.isObject()) {
+      auto guardObject = guardValue.getObject(runtime);
+      if (guardObject.isHostObject<TurboModuleMembersGuard>(runtime)) {
+        guard = guardObject.getHostObject<TurboModuleMembersGuard>(runtime);
+      }
+    }
+
+    if (!guard) {
+      guard = std::make_shared<TurboModuleMembersGuard>();
+      global.setProperty(runtime, GuardPropertyName, facebook::jsi::Object::createFromHostObject(runtime, guard));
+    }
+
+    auto &guardMembers = guard->m_members;
+    guardMembers.erase(
+        std::remove_if(
+            guardMembers.begin(), guardMembers.end(), [](const auto &weakMembers) { return weakMembers.expired(); }),
+        guardMembers.end());
+    guardMembers.push_back(members);
+  }
+
+ private:
+  static constexpr const char *GuardPropertyName = "__turboModuleMembersGuard";
+  std::vector<std::weak_ptr<TurboModuleMembers>> m_members;
+};
+
 /*-------------------------------------------------------------------------------
   TurboModuleImpl
 -------------------------------------------------------------------------------*/
@@ -92,12 +146,28 @@ class TurboModuleImpl : public facebook::react::TurboModule {
   }
 
   std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &rt) override {
+    std::vector<facebook::jsi::PropNameID> props;
+    auto tmb = m_moduleBuilder.as<TurboModuleBuilder>();
     if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->getPropertyNames(rt);
+      props = m_hostObjectWrapper->getPropertyNames(rt);
+      if (tmb->m_methods.empty()) {
+        return props;
+      }
+
+      // The host object may implement only a part of the module members that are added to the module builder.
+      std::unordered_set<std::string> names;
+      for (auto &prop : props) {
+        names.insert(prop.utf8(rt));
+      }
+
+      for (auto &it : tmb->m_methods) {
+        if (names.find(it.first) == names.end()) {
+          props.push_back(facebook::jsi::PropNameID::forAscii(rt, it.first));
+        }
+      }
+      return props;
     }
 
-    std::vector<facebook::jsi::PropNameID> props;
-    auto tmb = m_moduleBuilder.as<TurboModuleBuilder>();
     for (auto &it : tmb->m_methods) {
       props.push_back(facebook::jsi::PropNameID::forAscii(rt, it.first));
     }
@@ -106,12 +176,52 @@ class TurboModuleImpl : public facebook::react::TurboModule {
 
   facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &propName) override {
     if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->get(runtime, propName);
+      // The members that the host object does not have are created from the module builder.
+      auto result = m_hostObjectWrapper->get(runtime, propName);
+      if (!result.isUndefined()) {
+        return result;
+      }
     }
 
-    // it is not safe to assume that "runtime" never changes, so members are not cached here
-    auto tmb = m_moduleBuilder.as<TurboModuleBuilder>();
+    // it is not safe to assume that "runtime" never changes, so members are cached only for the first runtime
+    // that accesses the module. Other runtimes get a new function on each access.
     auto key = propName.utf8(runtime);
+    if (m_members->Runtime == nullptr) {
+      m_members->Runtime = &runtime;
+      TurboModuleMembersGuard::Watch(runtime, m_members);
+    }
+
+    bool isMembersRuntime = m_members->Runtime == &runtime;
+    if (isMembersRuntime) {
+      auto it = m_members->Functions.find(key);
+      if (it != m_members->Functions.end()) {
+        return {runtime, it->second};
+      }
+    }
+
+    auto member = CreateMember(runtime, propName, key);
+    if (isMembersRuntime && member.isObject()) {
+      m_members->Functions.emplace(key, member.getObject(runtime).getFunction(runtime));
+    }
+
+    return member;
+  }
+
+  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
+      override {
+    if (m_hostObjectWrapper) {
+      return m_hostObjectWrapper->set(rt, name, value);
+    }
+
+    facebook::react::TurboModule::set(rt, name, value);
+  }
+
+ private:
+  facebook::jsi::Value CreateMember(
+      facebook::jsi::Runtime &runtime,
+      const facebook::jsi::PropNameID &propName,
+      const std::string &key) {
+    auto tmb = m_moduleBuilder.as<TurboModuleBuilder>();
 
     if (key == "getConstants" && tmb->m_constantProviders.size() > 0) {
       // try to find getConstants if there is any constant
@@ -289,19 +399,13 @@ class TurboModuleImpl : public facebook::react::TurboModule {
     return facebook::jsi::Value::undefined();
   }
 
-  void set(facebook::jsi::Runtime &rt, const facebook::jsi::PropNameID &name, const facebook::jsi::Value &value)
-      override {
-    if (m_hostObjectWrapper) {
-      return m_hostObjectWrapper->set(rt, name, value);
-    }
-
-    facebook::react::TurboModule::set(rt, name, value);
-  }
-
- private:
   IReactModuleBuilder m_moduleBuilder;
   IInspectable providedModule;
   std::shared_ptr<implementation::HostObjectWrapper> m_hostObjectWrapper;
+
+  // Host functions created for the module members. They are released by the module or by the runtime
+  // teardown, whichever comes first.
+  std::shared_ptr<TurboModuleMembers> m_members{std::make_shared<TurboModuleMembers>()};
 };
 
 /*-------------------------------------------------------------------------------
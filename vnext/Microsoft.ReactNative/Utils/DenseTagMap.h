@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Microsoft::ReactNative {
+
+// Map from React tags to values.
+// React tags are allocated almost densely, so the values are stored in fixed-size pages indexed by the tag.
+// A lookup is two array accesses. Pages are released when they become empty.
+// Negative and very large tags are kept in an ordered map, so that the iteration still visits the values
+// in ascending tag order, the same way as std::map.
+template <class TValue>
+class DenseTagMap {
+ public:
+  DenseTagMap() noexcept = default;
+  DenseTagMap(const DenseTagMap &) = delete;
+  DenseTagMap &operator=(const DenseTagMap &) = delete;
+
+  TValue *Find(int64_t tag) noexcept {
+    if (!IsDense(tag)) {
+      auto it = m_sparse.find(tag);
+      return it != m_sparse.end() ? &it->second : nullptr;
+    }
+
+    size_t pageIndex = PageIndex(tag);
+    if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) {
+      return nullptr;
+    }
+
+    auto &slot = m_pages[pageIndex]->slots[SlotIndex(tag)];
+    return slot ? &*slot : nullptr;
+  }
+
+  const TValue *Find(int64_t tag) const noexcept {
+    return const_cast<DenseTagMap *>(this)->Find(tag);
+  }
+
+  // Does not replace the existing value, the same way as std::map::emplace.
+  std::pair<TValue *, bool> Emplace(int64_t tag, TValue &&value) {
+    if (!IsDense(tag)) {
+      auto result = m_sparse.try_emplace(tag, std::move(value));
+      m_size += result.second ? 1 : 0;
+      return {&result.first->second, result.second};
+    }
+
+    Page &page = EnsurePage(PageIndex(tag));
+    auto &slot = page.slots[SlotIndex(tag)];
+    if (slot) {
+      return {&*slot, false};
+    }
+
+    slot.emplace(std::move(value));
+    ++page.count;
+    ++m_size;
+    return {&*slot, true};
+  }
+
+  TValue &InsertOrAssign(int64_t tag, TValue &&value) {
+    auto result = Emplace(tag, std::move(value));
+    if (!result.second) {
+      *result.first = std::move(value);
+    }
+
+    return *result.first;
+  }
+
+  // The removed value is destroyed after it is detached from the map.
+  bool Erase(int64_t tag) noexcept {
+    std::optional<TValue> removed;
+    if (!IsDense(tag)) {
+      auto it = m_sparse.find(tag);
+      if (it == m_sparse.end()) {
+        return false;
+      }
+
+      removed.emplace(std::move(it->second));
+      m_sparse.erase(it);
+    } else {
+      size_t pageIndex = PageIndex(tag);
+      if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) {
+        return false;
+      }
+
+      auto &page = m_pages[pageIndex];
+      auto &slot = page->slots[SlotIndex(tag)];
+      if (!slot) {
+        return false;
+      }
+
+      removed.emplace(std::move(*slot));
+      slot.reset();
+      if (--page->count == 0 && m_iterationDepth == 0) {
+        page.reset();
+      }
+    }
+
+    --m_size;
+    return true;
+  }
+
+  size_t Size() const noexcept {
+    return m_size;
+  }
+
+  // Calls func(int64_t tag, TValue &value) for each value in ascending tag order.
+  // The func may erase values, including the current one. Erased values are not visited afterwards.
+  // The func must not add values.
+  template <class TFunc>
+  void ForEach(TFunc &&func) {
+    // Empty pages are released after the iteration, so that Erase does not free the page being visited.
+    IterationScope scope{*this};
+
+    auto sparseIt = m_sparse.begin();
+    while (sparseIt != m_sparse.end() && sparseIt->first < 0) {
+      int64_t tag = sparseIt->first;
+      func(tag, sparseIt->second);
+      sparseIt = m_sparse.upper_bound(tag);
+    }
+
+    for (size_t pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex) {
+      if (Page *page = m_pages[pageIndex].get()) {
+        for (size_t slotIndex = 0; slotIndex < PageSize; ++slotIndex) {
+          if (auto &slot = page->slots[slotIndex]) {
+            func(static_cast<int64_t>((pageIndex << PageBits) | slotIndex), *slot);
+          }
+        }
+      }
+    }
+
+    sparseIt = m_sparse.lower_bound(MaxDenseTag);
+    while (sparseIt != m_sparse.end()) {
+      int64_t tag = sparseIt->first;
+      func(tag, sparseIt->second);
+      sparseIt = m_sparse.upper_bound(tag);
+    }
+  }
+
+ private:
+  static constexpr size_t PageBits = 10;
+  static constexpr size_t PageSize = size_t{1} << PageBits;
+  static constexpr int64_t MaxDenseTag = int64_t{1} << 26;
+
+  struct Page {
+    std::optional<TValue> slots[PageSize];
+    size_t count{0};
+  };
+
+  struct IterationScope {
+    explicit IterationScope(DenseTagMap &map) noexcept : m_map{map} {
+      ++m_map.m_iterationDepth;
+    }
+
+    ~IterationScope() noexcept {
+      if (--m_map.m_iterationDepth == 0) {
+        m_map.ReleaseEmptyPages();
+      }
+    }
+
+    IterationScope(const IterationScope &) = delete;
+    IterationScope &operator=(const IterationScope &) = delete;
+
+   private:
+    DenseTagMap &m_map;
+  };
+
+  static bool IsDense(int64_t tag) noexcept {
+    return tag >= 0 && tag < MaxDenseTag;
+  }
+
+  static size_t PageIndex(int64_t tag) noexcept {
+    return static_cast<size_t>(tag) >> PageBits;
+  }
+
+  static size_t SlotIndex(int64_t tag) noexcept {
+    return static_cast<size_t>(tag) & (PageSize - 1);
+  }
+
+  Page &EnsurePage(size_t pageIndex) {
+    if (pageIndex >= m_pages.size()) {
+      m_pages.resize(pageIndex + 1);
+    }
+
+    auto &page = m_pages[pageIndex];
+    if (!page) {
+      page = std::make_unique<Page>();
+    }
+
+    return *page;
+  }
+
+  void ReleaseEmptyPages() noexcept {
+    for (auto &page : m_pages) {
+      if (page && page->count == 0) {
+        page.reset();
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<Page>> m_pages;
+  std::map<int64_t, TValue> m_sparse;
+  size_t m_size{0};
+  size_t m_iterationDepth{0};
+};
+
+} // namespace Microsoft::ReactNative
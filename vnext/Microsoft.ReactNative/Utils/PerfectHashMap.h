@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Microsoft::ReactNative {
+
+template <class TValue>
+struct PerfectHashMapEntry {
+  std::string_view key;
+  TValue value;
+};
+
+// Read-only map from string keys to values that is built at compile time.
+// The Seed maps all keys to distinct slots, so a lookup costs one hash computation and one key comparison.
+// The constructor only verifies the given seed instead of searching for one, which keeps the compile time
+// work linear in the size of the table. If the keys collide for the seed, a compile error is reported at the
+// throw below. Then try the next seeds: with eight slots per key one of the first few seeds usually works.
+template <class TValue, size_t N, uint32_t Seed = 0>
+class PerfectHashMap {
+ public:
+  constexpr PerfectHashMap(const PerfectHashMapEntry<TValue> (&entries)[N]) : m_entries{}, m_slots{} {
+    static_assert(N > 0 && N < EmptySlot, "Unsupported number of entries");
+
+    for (size_t i = 0; i < N; ++i) {
+      m_entries[i] = entries[i];
+    }
+
+    if (!TryBuildSlots()) {
+      throw "Two keys map to the same slot. Pass another Seed to MakePerfectHashMap.";
+    }
+  }
+
+  constexpr const TValue *Find(std::string_view key) const noexcept {
+    uint8_t index = m_slots[SlotIndex(key)];
+    if (index != EmptySlot && m_entries[index].key == key) {
+      return &m_entries[index].value;
+    }
+
+    return nullptr;
+  }
+
+ private:
+  static constexpr uint8_t EmptySlot = 0xFF;
+
+  static constexpr size_t GetSlotCount() noexcept {
+    // Eight slots per key keeps the number of seeds to try small.
+    size_t count = 1;
+    while (count < N * 8) {
+      count <<= 1;
+    }
+
+    return count;
+  }
+
+  static constexpr size_t SlotCount = GetSlotCount();
+
+  // FNV-1a with a seeded offset basis
+  static constexpr size_t SlotIndex(std::string_view key) noexcept {
+    uint64_t hash = 14695981039346656037ull ^ (Seed * 0x9E3779B97F4A7C15ull);
+    for (char ch : key) {
+      hash = (hash ^ static_cast<uint8_t>(ch)) * 1099511628211ull;
+    }
+
+    return static_cast<size_t>(hash ^ (hash >> 32)) & (SlotCount - 1);
+  }
+
+  constexpr bool TryBuildSlots() noexcept {
+    for (size_t i = 0; i < SlotCount; ++i) {
+      m_slots[i] = EmptySlot;
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+      size_t slot = SlotIndex(m_entries[i].key);
+      if (m_slots[slot] != EmptySlot) {
+        return false;
+      }
+
+      m_slots[slot] = static_cast<uint8_t>(i);
+    }
+
+    return true;
+  }
+
+  PerfectHashMapEntry<TValue> m_entries[N];
+  uint8_t m_slots[SlotCount];
+};
+
+// Deduces the number of entries, e.g. MakePerfectHashMap<YGWrap>({{"nowrap", YGWrapNoWrap}, {"wrap", YGWrapWrap}}).
+// The Seed is only needed when the keys collide with the default one.
+template <class TValue, uint32_t Seed = 0, size_t N>
+constexpr PerfectHashMap<TValue, N, Seed> MakePerfectHashMap(const PerfectHashMapEntry<TValue> (&entries)[N]) {
+  return PerfectHashMap<TValue, N, Seed>{entries};
+}
+
+} // namespace Microsoft::ReactNative
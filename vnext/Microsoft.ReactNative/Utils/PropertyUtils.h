@@ -9,6 +9,7 @@
 
 #include <UI.Text.h>
 #include <stdint.h>
+#include <string_view>
 #include <winrt/Windows.Foundation.Metadata.h>
 #include <winrt/Windows.Foundation.h>
 
@@ -30,6 +31,48 @@ static const std::unordered_map<std::string, ShadowEdges> edgeTypeMap = {
     {"borderWidth", ShadowEdges::AllEdges},
 };
 
+// Names of the properties handled by the TryUpdate* helpers below that handle more than one property,
+// used to register the helpers in the view manager property handler maps.
+inline constexpr std::string_view BorderPropertyNames[] = {
+    "borderColor",
+    "borderLeftWidth",
+    "borderTopWidth",
+    "borderRightWidth",
+    "borderBottomWidth",
+    "borderStartWidth",
+    "borderEndWidth",
+    "borderWidth",
+};
+
+inline constexpr std::string_view PaddingPropertyNames[] = {
+    "paddingLeft",
+    "paddingTop",
+    "paddingRight",
+    "paddingBottom",
+    "paddingStart",
+    "paddingEnd",
+    "paddingHorizontal",
+    "paddingVertical",
+    "padding",
+};
+
+inline constexpr std::string_view CornerRadiusPropertyNames[] = {
+    "borderTopLeftRadius",
+    "borderTopRightRadius",
+    "borderTopStartRadius",
+    "borderTopEndRadius",
+    "borderBottomRightRadius",
+    "borderBottomLeftRadius",
+    "borderBottomStartRadius",
+    "borderBottomEndRadius",
+    "borderRadius",
+};
+
+inline constexpr std::string_view FontPropertyNames[] = {"fontSize", "fontFamily", "fontWeight", "fontStyle"};
+inline constexpr std::string_view FlowDirectionPropertyNames[] = {"writingDirection", "direction"};
+inline constexpr std::string_view CharacterSpacingPropertyNames[] = {"letterSpacing", "characterSpacing"};
+inline constexpr std::string_view MouseEventPropertyNames[] = {"onMouseEnter", "onMouseLeave"};
+
 inline xaml::Thickness GetThickness(double thicknesses[(int)ShadowEdges::CountEdges]) {
   const double defaultWidth = std::max<double>(0, thicknesses[(int)ShadowEdges::AllEdges]);
   double startWidth = DefaultOrOverride(thicknesses[(int)ShadowEdges::Left], thicknesses[(int)ShadowEdges::Start]);
@@ -32,23 +32,39 @@ XamlView ActivityIndicatorViewManager::CreateViewCore(
   return progressRing;
 }
 
+static bool UpdateAnimatingProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto progressRing = nodeToUpdate->GetView().as<xaml::Controls::ProgressRing>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    progressRing.IsActive(propertyValue.AsBoolean());
+  if (propertyValue.IsNull())
+    progressRing.ClearValue(xaml::Controls::ProgressRing::IsActiveProperty());
+
+  return true;
+}
+
 bool ActivityIndicatorViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  auto progressRing = nodeToUpdate->GetView().as<xaml::Controls::ProgressRing>();
-  if (progressRing == nullptr)
+  if (nodeToUpdate->GetView() == nullptr) {
     return true;
-
-  if (propertyName == "animating") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-      progressRing.IsActive(propertyValue.AsBoolean());
-    if (propertyValue.IsNull())
-      progressRing.ClearValue(xaml::Controls::ProgressRing::IsActiveProperty());
-  } else {
-    return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
   }
-  return true;
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &ActivityIndicatorViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["animating"] = UpdateAnimatingProperty;
+    return result;
+  }();
+
+  return handlers;
 }
 
 } // namespace Microsoft::ReactNative
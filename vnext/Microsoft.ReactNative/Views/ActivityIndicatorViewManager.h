@@ -21,6 +21,7 @@ class ActivityIndicatorViewManager : public ControlViewManager {
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
       const winrt::Microsoft::ReactNative::JSValue &propertyValue) override;
+  static const PropertyHandlerMap &GetPropertyHandlers();
 
   XamlView CreateViewCore(int64_t tag, const winrt::Microsoft::ReactNative::JSValueObject &) override;
 };
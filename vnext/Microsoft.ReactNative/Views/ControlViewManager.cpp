@@ -47,43 +47,116 @@ void ControlViewManager::TransferProperties(const XamlView &oldView, const XamlV
   Super::TransferProperties(oldView, newView);
 }
 
-bool ControlViewManager::UpdateProperty(
+static bool UpdateBackgroundProperty(
+    ViewManagerBase & /*viewManager*/,
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  auto control(nodeToUpdate->GetView().as<xaml::Controls::Control>());
-
-  bool implementsPadding = nodeToUpdate->ImplementsPadding();
-  bool finalizeBorderRadius{false};
-  bool ret = true;
-
-  if (control != nullptr) {
-    if (TryUpdateBackgroundBrush(control, propertyName, propertyValue)) {
-    } else if (TryUpdateBorderProperties(nodeToUpdate, control, propertyName, propertyValue)) {
-    } else if (TryUpdateForeground(control, propertyName, propertyValue)) {
-    } else if (TryUpdateCornerRadiusOnNode(nodeToUpdate, control, propertyName, propertyValue)) {
-      finalizeBorderRadius = true;
-    } else if (implementsPadding && TryUpdatePadding(nodeToUpdate, control, propertyName, propertyValue)) {
-    } else if (propertyName == "tabIndex") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto tabIndex = propertyValue.AsDouble();
-        if (tabIndex == static_cast<int32_t>(tabIndex))
-          control.ClearValue(TAB_INDEX_PROPERTY());
-        control.TabIndex(static_cast<int32_t>(tabIndex));
-      } else if (propertyValue.IsNull()) {
-        control.ClearValue(TAB_INDEX_PROPERTY());
-      }
-    } else {
-      ret = Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
-    }
+  auto control = nodeToUpdate->GetView().as<xaml::Controls::Control>();
+  return TryUpdateBackgroundBrush(control, propertyName, propertyValue);
+}
+
+static bool UpdateBorderProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto control = nodeToUpdate->GetView().as<xaml::Controls::Control>();
+  return TryUpdateBorderProperties(nodeToUpdate, control, propertyName, propertyValue);
+}
+
+static bool UpdateForegroundProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto control = nodeToUpdate->GetView().as<xaml::Controls::Control>();
+  return TryUpdateForeground(control, propertyName, propertyValue);
+}
+
+static bool UpdateCornerRadiusProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto control = nodeToUpdate->GetView().as<xaml::Controls::Control>();
+  if (!TryUpdateCornerRadiusOnNode(nodeToUpdate, control, propertyName, propertyValue)) {
+    return false;
   }
 
-  if (finalizeBorderRadius && control.try_as<xaml::Controls::IControl7>()) {
+  if (control.try_as<xaml::Controls::IControl7>()) {
     // Control.CornerRadius is only supported on >= RS5, setting borderRadius on Controls have no effect < RS5
     UpdateCornerRadiusOnElement(nodeToUpdate, control);
   }
-  return ret;
+
+  return true;
+}
+
+static bool UpdatePaddingProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (!nodeToUpdate->ImplementsPadding()) {
+    return false;
+  }
+
+  auto control = nodeToUpdate->GetView().as<xaml::Controls::Control>();
+  return TryUpdatePadding(nodeToUpdate, control, propertyName, propertyValue);
+}
+
+static bool UpdateTabIndexProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto control = nodeToUpdate->GetView().as<xaml::Controls::Control>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    auto tabIndex = propertyValue.AsDouble();
+    if (tabIndex == static_cast<int32_t>(tabIndex))
+      control.ClearValue(TAB_INDEX_PROPERTY());
+    control.TabIndex(static_cast<int32_t>(tabIndex));
+  } else if (propertyValue.IsNull()) {
+    control.ClearValue(TAB_INDEX_PROPERTY());
+  }
+
+  return true;
+}
+
+bool ControlViewManager::UpdateProperty(
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
+  }
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &ControlViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["backgroundColor"] = UpdateBackgroundProperty;
+    for (auto propertyName : BorderPropertyNames) {
+      result[propertyName] = UpdateBorderProperties;
+    }
+
+    result["color"] = UpdateForegroundProperty;
+    for (auto propertyName : CornerRadiusPropertyNames) {
+      result[propertyName] = UpdateCornerRadiusProperties;
+    }
+
+    for (auto propertyName : PaddingPropertyNames) {
+      result[propertyName] = UpdatePaddingProperties;
+    }
+
+    result["tabIndex"] = UpdateTabIndexProperty;
+    return result;
+  }();
+
+  return handlers;
 }
 
 void ControlViewManager::OnViewCreated(XamlView view) {
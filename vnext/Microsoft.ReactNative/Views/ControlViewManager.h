@@ -23,6 +23,7 @@ class REACTWINDOWS_EXPORT ControlViewManager : public FrameworkElementViewManage
   void TransferProperties(const XamlView &oldView, const XamlView &newView) override;
 
  protected:
+  static const PropertyHandlerMap &GetPropertyHandlers();
   void OnViewCreated(XamlView view) override;
 };
 
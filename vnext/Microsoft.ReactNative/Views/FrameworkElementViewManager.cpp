@@ -118,400 +118,659 @@ void FrameworkElementViewManager::GetNativeProps(const winrt::Microsoft::ReactNa
   GetAccessibilityValueProps(writer);
 }
 
-bool FrameworkElementViewManager::UpdateProperty(
+static bool UpdateOpacityProperty(
+    ViewManagerBase & /*viewManager*/,
     ShadowNodeBase *nodeToUpdate,
-    const std::string &propertyName,
+    const std::string & /*propertyName*/,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  auto element(nodeToUpdate->GetView().as<xaml::FrameworkElement>());
-  if (element != nullptr) {
-    if (propertyName == "opacity") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double opacity = propertyValue.AsDouble();
-        if (opacity >= 0 && opacity <= 1)
-          element.Opacity(opacity);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::UIElement::OpacityProperty());
-      }
-    } else if (propertyName == "transform") {
-      if (element.try_as<xaml::IUIElement10>()) // Works on 19H1+
-      {
-        if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
-          assert(propertyValue.AsArray().size() == 16);
-          winrt::Windows::Foundation::Numerics::float4x4 transformMatrix;
-          transformMatrix.m11 = static_cast<float>(propertyValue[0].AsDouble());
-          transformMatrix.m12 = static_cast<float>(propertyValue[1].AsDouble());
-          transformMatrix.m13 = static_cast<float>(propertyValue[2].AsDouble());
-          transformMatrix.m14 = static_cast<float>(propertyValue[3].AsDouble());
-          transformMatrix.m21 = static_cast<float>(propertyValue[4].AsDouble());
-          transformMatrix.m22 = static_cast<float>(propertyValue[5].AsDouble());
-          transformMatrix.m23 = static_cast<float>(propertyValue[6].AsDouble());
-          transformMatrix.m24 = static_cast<float>(propertyValue[7].AsDouble());
-          transformMatrix.m31 = static_cast<float>(propertyValue[8].AsDouble());
-          transformMatrix.m32 = static_cast<float>(propertyValue[9].AsDouble());
-          transformMatrix.m33 = static_cast<float>(propertyValue[10].AsDouble());
-          transformMatrix.m34 = static_cast<float>(propertyValue[11].AsDouble());
-          transformMatrix.m41 = static_cast<float>(propertyValue[12].AsDouble());
-          transformMatrix.m42 = static_cast<float>(propertyValue[13].AsDouble());
-          transformMatrix.m43 = static_cast<float>(propertyValue[14].AsDouble());
-          transformMatrix.m44 = static_cast<float>(propertyValue[15].AsDouble());
-
-          if (!element.IsLoaded()) {
-            element.Loaded([=](auto sender, auto &&) -> auto {
-              ApplyTransformMatrix(sender.as<xaml::UIElement>(), nodeToUpdate, transformMatrix);
-            });
-          } else {
-            ApplyTransformMatrix(element, nodeToUpdate, transformMatrix);
-          }
-        } else if (propertyValue.IsNull()) {
-          element.TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4::identity());
-        }
-      } else {
-        cdebug << "[Dim down] " << propertyName << "\n";
-      }
-    } else if (propertyName == "width") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double width = propertyValue.AsDouble();
-        if (width >= 0)
-          element.Width(width);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::WidthProperty());
-      }
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double opacity = propertyValue.AsDouble();
+    if (opacity >= 0 && opacity <= 1)
+      element.Opacity(opacity);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::UIElement::OpacityProperty());
+  }
 
-    } else if (propertyName == "height") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double height = propertyValue.AsDouble();
-        if (height >= 0)
-          element.Height(height);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::HeightProperty());
-      }
-    } else if (propertyName == "minWidth") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double minWidth = propertyValue.AsDouble();
-        if (minWidth >= 0)
-          element.MinWidth(minWidth);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MinWidthProperty());
-      }
-    } else if (propertyName == "maxWidth") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double maxWidth = propertyValue.AsDouble();
-        if (maxWidth >= 0)
-          element.MaxWidth(maxWidth);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MaxWidthProperty());
-      }
+  return true;
+}
 
-    } else if (propertyName == "minHeight") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double minHeight = propertyValue.AsDouble();
-        if (minHeight >= 0)
-          element.MinHeight(minHeight);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MinHeightProperty());
-      }
-    } else if (propertyName == "maxHeight") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        double maxHeight = propertyValue.AsDouble();
-        if (maxHeight >= 0)
-          element.MaxHeight(maxHeight);
-        // else
-        // TODO report error
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::FrameworkElement::MaxHeightProperty());
-      }
+static bool UpdateWidthProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double width = propertyValue.AsDouble();
+    if (width >= 0)
+      element.Width(width);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::FrameworkElement::WidthProperty());
+  }
 
-    } else if (propertyName == "accessibilityHint") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = asHstring(propertyValue);
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
+  return true;
+}
 
-        element.SetValue(xaml::Automation::AutomationProperties::HelpTextProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::HelpTextProperty());
-      }
-    } else if (propertyName == "accessibilityLabel") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = asHstring(propertyValue);
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::NameProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::NameProperty());
-      }
-      AnnounceLiveRegionChangedIfNeeded(element);
-    } else if (propertyName == "accessible") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
-        if (!propertyValue.AsBoolean())
-          xaml::Automation::AutomationProperties::SetAccessibilityView(element, winrt::Peers::AccessibilityView::Raw);
-      }
-    } else if (propertyName == "accessibilityLiveRegion") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = propertyValue.AsString();
+static bool UpdateHeightProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double height = propertyValue.AsDouble();
+    if (height >= 0)
+      element.Height(height);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::FrameworkElement::HeightProperty());
+  }
+
+  return true;
+}
 
-        auto liveSetting = winrt::AutomationLiveSetting::Off;
+static bool UpdateMinWidthProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double minWidth = propertyValue.AsDouble();
+    if (minWidth >= 0)
+      element.MinWidth(minWidth);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::FrameworkElement::MinWidthProperty());
+  }
 
-        if (value == "polite") {
-          liveSetting = winrt::AutomationLiveSetting::Polite;
-        } else if (value == "assertive") {
-          liveSetting = winrt::AutomationLiveSetting::Assertive;
-        }
+  return true;
+}
 
-        element.SetValue(xaml::Automation::AutomationProperties::LiveSettingProperty(), winrt::box_value(liveSetting));
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::LiveSettingProperty());
-      }
-      AnnounceLiveRegionChangedIfNeeded(element);
-    } else if (propertyName == "accessibilityPosInSet") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto value = static_cast<int>(propertyValue.AsDouble());
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::PositionInSetProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::PositionInSetProperty());
-      }
-    } else if (propertyName == "accessibilitySetSize") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto value = static_cast<int>(propertyValue.AsDouble());
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::SizeOfSetProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::SizeOfSetProperty());
-      }
-    } else if (propertyName == "accessibilityRole") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        const std::string &role = propertyValue.AsString();
-        if (role == "none")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::None);
-        else if (role == "button")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Button);
-        else if (role == "link")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Link);
-        else if (role == "search")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Search);
-        else if (role == "image")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Image);
-        else if (role == "keyboardkey")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::KeyboardKey);
-        else if (role == "text")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Text);
-        else if (role == "adjustable")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Adjustable);
-        else if (role == "imagebutton")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::ImageButton);
-        else if (role == "header")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Header);
-        else if (role == "summary")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Summary);
-        else if (role == "alert")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Alert);
-        else if (role == "checkbox")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::CheckBox);
-        else if (role == "combobox")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::ComboBox);
-        else if (role == "menu")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Menu);
-        else if (role == "menubar")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::MenuBar);
-        else if (role == "menuitem")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::MenuItem);
-        else if (role == "progressbar")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::ProgressBar);
-        else if (role == "radio")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Radio);
-        else if (role == "radiogroup")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::RadioGroup);
-        else if (role == "scrollbar")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::ScrollBar);
-        else if (role == "spinbutton")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::SpinButton);
-        else if (role == "switch")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Switch);
-        else if (role == "tab")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Tab);
-        else if (role == "tablist")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::TabList);
-        else if (role == "timer")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Timer);
-        else if (role == "toolbar")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::ToolBar);
-        else if (role == "list")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::List);
-        else if (role == "listitem")
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::ListItem);
-        else
-          DynamicAutomationProperties::SetAccessibilityRole(
-              element, winrt::Microsoft::ReactNative::AccessibilityRoles::Unknown);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(DynamicAutomationProperties::AccessibilityRoleProperty());
-      }
-    } else if (propertyName == "accessibilityState") {
-      bool states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::CountStates)] = {};
-
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
-        for (const auto &pair : propertyValue.AsObject()) {
-          const std::string &innerName = pair.first;
-          const auto &innerValue = pair.second;
-
-          if (innerName == "selected")
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Selected)] =
-                innerValue.AsBoolean();
-          else if (innerName == "disabled")
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Disabled)] =
-                innerValue.AsBoolean();
-          else if (innerName == "checked") {
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Checked)] =
-                innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && innerValue.AsBoolean();
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Unchecked)] =
-                innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && !innerValue.AsBoolean();
-            // If the state is "mixed" we'll just set both Checked and Unchecked to false,
-            // then later in the IToggleProvider implementation it will return the Intermediate state
-            // due to both being set to false (see  DynamicAutomationPeer::ToggleState()).
-          } else if (innerName == "busy")
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Busy)] =
-                !innerValue.IsNull() && innerValue.AsBoolean();
-          else if (innerName == "expanded") {
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Expanded)] =
-                !innerValue.IsNull() && innerValue.AsBoolean();
-            states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Collapsed)] =
-                innerValue.IsNull() || !innerValue.AsBoolean();
-          }
-        }
-      }
+static bool UpdateMaxWidthProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double maxWidth = propertyValue.AsDouble();
+    if (maxWidth >= 0)
+      element.MaxWidth(maxWidth);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::FrameworkElement::MaxWidthProperty());
+  }
 
-      DynamicAutomationProperties::SetAccessibilityStateSelected(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Selected)]);
-      DynamicAutomationProperties::SetAccessibilityStateDisabled(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Disabled)]);
-      DynamicAutomationProperties::SetAccessibilityStateChecked(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Checked)]);
-      DynamicAutomationProperties::SetAccessibilityStateUnchecked(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Unchecked)]);
-      DynamicAutomationProperties::SetAccessibilityStateBusy(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Busy)]);
-      DynamicAutomationProperties::SetAccessibilityStateExpanded(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Expanded)]);
-      DynamicAutomationProperties::SetAccessibilityStateCollapsed(
-          element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Collapsed)]);
-    } else if (propertyName == "accessibilityValue") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
-        for (const auto &pair : propertyValue.AsObject()) {
-          const std::string &innerName = pair.first;
-          const auto &innerValue = pair.second;
-
-          if (innerName == "min" &&
-              (innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-               innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)) {
-            DynamicAutomationProperties::SetAccessibilityValueMin(element, innerValue.AsDouble());
-          } else if (
-              innerName == "max" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-              innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-            DynamicAutomationProperties::SetAccessibilityValueMax(element, innerValue.AsDouble());
-          } else if (
-              innerName == "now" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-              innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-            DynamicAutomationProperties::SetAccessibilityValueNow(element, innerValue.AsDouble());
-          } else if (innerName == "text" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-            auto value = asHstring(innerValue);
-            DynamicAutomationProperties::SetAccessibilityValueText(element, value);
-          }
-        }
-      }
-    } else if (propertyName == "testID") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = asHstring(propertyValue);
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
-
-        element.SetValue(xaml::Automation::AutomationProperties::AutomationIdProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::Automation::AutomationProperties::AutomationIdProperty());
-      }
-    } else if (propertyName == "tooltip") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        winrt::ToolTipService::SetToolTip(element, winrt::box_value(asHstring(propertyValue)));
-      }
-    } else if (propertyName == "zIndex") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        auto value = static_cast<int>(propertyValue.AsDouble());
-        auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
-
-        element.SetValue(winrt::Canvas::ZIndexProperty(), boxedValue);
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(winrt::Canvas::ZIndexProperty());
+  return true;
+}
+
+static bool UpdateMinHeightProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double minHeight = propertyValue.AsDouble();
+    if (minHeight >= 0)
+      element.MinHeight(minHeight);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::FrameworkElement::MinHeightProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateMaxHeightProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    double maxHeight = propertyValue.AsDouble();
+    if (maxHeight >= 0)
+      element.MaxHeight(maxHeight);
+    // else
+    // TODO report error
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::FrameworkElement::MaxHeightProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilityHintProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    auto value = asHstring(propertyValue);
+    auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
+
+    element.SetValue(xaml::Automation::AutomationProperties::HelpTextProperty(), boxedValue);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::Automation::AutomationProperties::HelpTextProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilityLabelProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    auto value = asHstring(propertyValue);
+    auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
+
+    element.SetValue(xaml::Automation::AutomationProperties::NameProperty(), boxedValue);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::Automation::AutomationProperties::NameProperty());
+  }
+  AnnounceLiveRegionChangedIfNeeded(element);
+
+  return true;
+}
+
+static bool UpdateAccessibleProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
+    if (!propertyValue.AsBoolean())
+      xaml::Automation::AutomationProperties::SetAccessibilityView(element, winrt::Peers::AccessibilityView::Raw);
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilityLiveRegionProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    auto value = propertyValue.AsString();
+
+    auto liveSetting = winrt::AutomationLiveSetting::Off;
+
+    if (value == "polite") {
+      liveSetting = winrt::AutomationLiveSetting::Polite;
+    } else if (value == "assertive") {
+      liveSetting = winrt::AutomationLiveSetting::Assertive;
+    }
+
+    element.SetValue(xaml::Automation::AutomationProperties::LiveSettingProperty(), winrt::box_value(liveSetting));
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::Automation::AutomationProperties::LiveSettingProperty());
+  }
+  AnnounceLiveRegionChangedIfNeeded(element);
+
+  return true;
+}
+
+static bool UpdateAccessibilityPosInSetProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    auto value = static_cast<int>(propertyValue.AsDouble());
+    auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
+
+    element.SetValue(xaml::Automation::AutomationProperties::PositionInSetProperty(), boxedValue);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::Automation::AutomationProperties::PositionInSetProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilitySetSizeProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    auto value = static_cast<int>(propertyValue.AsDouble());
+    auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
+
+    element.SetValue(xaml::Automation::AutomationProperties::SizeOfSetProperty(), boxedValue);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::Automation::AutomationProperties::SizeOfSetProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilityRoleProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    const std::string &role = propertyValue.AsString();
+    if (role == "none")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::None);
+    else if (role == "button")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Button);
+    else if (role == "link")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Link);
+    else if (role == "search")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Search);
+    else if (role == "image")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Image);
+    else if (role == "keyboardkey")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::KeyboardKey);
+    else if (role == "text")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Text);
+    else if (role == "adjustable")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Adjustable);
+    else if (role == "imagebutton")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::ImageButton);
+    else if (role == "header")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Header);
+    else if (role == "summary")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Summary);
+    else if (role == "alert")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Alert);
+    else if (role == "checkbox")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::CheckBox);
+    else if (role == "combobox")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::ComboBox);
+    else if (role == "menu")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Menu);
+    else if (role == "menubar")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::MenuBar);
+    else if (role == "menuitem")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::MenuItem);
+    else if (role == "progressbar")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::ProgressBar);
+    else if (role == "radio")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Radio);
+    else if (role == "radiogroup")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::RadioGroup);
+    else if (role == "scrollbar")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::ScrollBar);
+    else if (role == "spinbutton")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::SpinButton);
+    else if (role == "switch")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Switch);
+    else if (role == "tab")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Tab);
+    else if (role == "tablist")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::TabList);
+    else if (role == "timer")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Timer);
+    else if (role == "toolbar")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::ToolBar);
+    else if (role == "list")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::List);
+    else if (role == "listitem")
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::ListItem);
+    else
+      DynamicAutomationProperties::SetAccessibilityRole(
+          element, winrt::Microsoft::ReactNative::AccessibilityRoles::Unknown);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(DynamicAutomationProperties::AccessibilityRoleProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilityStateProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  bool states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::CountStates)] = {};
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
+    for (const auto &pair : propertyValue.AsObject()) {
+      const std::string &innerName = pair.first;
+      const auto &innerValue = pair.second;
+
+      if (innerName == "selected")
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Selected)] =
+            innerValue.AsBoolean();
+      else if (innerName == "disabled")
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Disabled)] =
+            innerValue.AsBoolean();
+      else if (innerName == "checked") {
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Checked)] =
+            innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && innerValue.AsBoolean();
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Unchecked)] =
+            innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean && !innerValue.AsBoolean();
+        // If the state is "mixed" we'll just set both Checked and Unchecked to false,
+        // then later in the IToggleProvider implementation it will return the Intermediate state
+        // due to both being set to false (see  DynamicAutomationPeer::ToggleState()).
+      } else if (innerName == "busy")
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Busy)] =
+            !innerValue.IsNull() && innerValue.AsBoolean();
+      else if (innerName == "expanded") {
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Expanded)] =
+            !innerValue.IsNull() && innerValue.AsBoolean();
+        states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Collapsed)] =
+            innerValue.IsNull() || !innerValue.AsBoolean();
       }
-    } else if (TryUpdateFlowDirection(element, propertyName, propertyValue)) {
-    } else if (propertyName == "accessibilityActions") {
-      auto value = json_type_traits<winrt::IVector<winrt::Microsoft::ReactNative::AccessibilityAction>>::parseJson(
-          propertyValue);
-      DynamicAutomationProperties::SetAccessibilityActions(element, value);
-    } else if (propertyName == "display") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto value = propertyValue.AsString();
-        if (value == "none") {
-          element.Visibility(xaml::Visibility::Collapsed);
-        } else {
-          element.Visibility(xaml::Visibility::Visible);
-        }
-      } else if (propertyValue.IsNull()) {
-        element.ClearValue(xaml::UIElement::VisibilityProperty());
+    }
+  }
+
+  DynamicAutomationProperties::SetAccessibilityStateSelected(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Selected)]);
+  DynamicAutomationProperties::SetAccessibilityStateDisabled(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Disabled)]);
+  DynamicAutomationProperties::SetAccessibilityStateChecked(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Checked)]);
+  DynamicAutomationProperties::SetAccessibilityStateUnchecked(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Unchecked)]);
+  DynamicAutomationProperties::SetAccessibilityStateBusy(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Busy)]);
+  DynamicAutomationProperties::SetAccessibilityStateExpanded(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Expanded)]);
+  DynamicAutomationProperties::SetAccessibilityStateCollapsed(
+      element, states[static_cast<int32_t>(winrt::Microsoft::ReactNative::AccessibilityStates::Collapsed)]);
+
+  return true;
+}
+
+static bool UpdateAccessibilityValueProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
+    for (const auto &pair : propertyValue.AsObject()) {
+      const std::string &innerName = pair.first;
+      const auto &innerValue = pair.second;
+
+      if (innerName == "min" &&
+          (innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+           innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)) {
+        DynamicAutomationProperties::SetAccessibilityValueMin(element, innerValue.AsDouble());
+      } else if (
+          innerName == "max" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+          innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+        DynamicAutomationProperties::SetAccessibilityValueMax(element, innerValue.AsDouble());
+      } else if (
+          innerName == "now" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+          innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+        DynamicAutomationProperties::SetAccessibilityValueNow(element, innerValue.AsDouble());
+      } else if (innerName == "text" && innerValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+        auto value = asHstring(innerValue);
+        DynamicAutomationProperties::SetAccessibilityValueText(element, value);
       }
+    }
+  }
+
+  return true;
+}
+
+static bool UpdateTestIDProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    auto value = asHstring(propertyValue);
+    auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateString(value);
+
+    element.SetValue(xaml::Automation::AutomationProperties::AutomationIdProperty(), boxedValue);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::Automation::AutomationProperties::AutomationIdProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateTooltipProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    winrt::ToolTipService::SetToolTip(element, winrt::box_value(asHstring(propertyValue)));
+  }
+
+  return true;
+}
+
+static bool UpdateZIndexProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    auto value = static_cast<int>(propertyValue.AsDouble());
+    auto boxedValue = winrt::Windows::Foundation::PropertyValue::CreateInt32(value);
+
+    element.SetValue(winrt::Canvas::ZIndexProperty(), boxedValue);
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(winrt::Canvas::ZIndexProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateAccessibilityActionsProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  auto value = json_type_traits<winrt::IVector<winrt::Microsoft::ReactNative::AccessibilityAction>>::parseJson(
+      propertyValue);
+  DynamicAutomationProperties::SetAccessibilityActions(element, value);
+
+  return true;
+}
+
+static bool UpdateDisplayProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    auto value = propertyValue.AsString();
+    if (value == "none") {
+      element.Visibility(xaml::Visibility::Collapsed);
     } else {
-      return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
+      element.Visibility(xaml::Visibility::Visible);
     }
+  } else if (propertyValue.IsNull()) {
+    element.ClearValue(xaml::UIElement::VisibilityProperty());
   }
+
+  return true;
+}
+
+static bool UpdateFlowDirectionProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+  return TryUpdateFlowDirection(element, propertyName, propertyValue);
+}
+
+bool FrameworkElementViewManager::UpdateProperty(
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
+  }
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &FrameworkElementViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["opacity"] = UpdateOpacityProperty;
+    result["transform"] = UpdateTransformProperty;
+    result["width"] = UpdateWidthProperty;
+    result["height"] = UpdateHeightProperty;
+    result["minWidth"] = UpdateMinWidthProperty;
+    result["maxWidth"] = UpdateMaxWidthProperty;
+    result["minHeight"] = UpdateMinHeightProperty;
+    result["maxHeight"] = UpdateMaxHeightProperty;
+    result["accessibilityHint"] = UpdateAccessibilityHintProperty;
+    result["accessibilityLabel"] = UpdateAccessibilityLabelProperty;
+    result["accessible"] = UpdateAccessibleProperty;
+    result["accessibilityLiveRegion"] = UpdateAccessibilityLiveRegionProperty;
+    result["accessibilityPosInSet"] = UpdateAccessibilityPosInSetProperty;
+    result["accessibilitySetSize"] = UpdateAccessibilitySetSizeProperty;
+    result["accessibilityRole"] = UpdateAccessibilityRoleProperty;
+    result["accessibilityState"] = UpdateAccessibilityStateProperty;
+    result["accessibilityValue"] = UpdateAccessibilityValueProperty;
+    result["testID"] = UpdateTestIDProperty;
+    result["tooltip"] = UpdateTooltipProperty;
+    result["zIndex"] = UpdateZIndexProperty;
+    result["accessibilityActions"] = UpdateAccessibilityActionsProperty;
+    result["display"] = UpdateDisplayProperty;
+    for (auto propertyName : FlowDirectionPropertyNames) {
+      result[propertyName] = UpdateFlowDirectionProperties;
+    }
+
+    return result;
+  }();
+
+  return handlers;
+}
+
+/*static*/ bool FrameworkElementViewManager::UpdateTransformProperty(
+    ViewManagerBase &viewManager,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto &self = static_cast<FrameworkElementViewManager &>(viewManager);
+  auto element = nodeToUpdate->GetView().as<xaml::FrameworkElement>();
+
+  if (element.try_as<xaml::IUIElement10>()) // Works on 19H1+
+  {
+    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
+      assert(propertyValue.AsArray().size() == 16);
+      winrt::Windows::Foundation::Numerics::float4x4 transformMatrix;
+      transformMatrix.m11 = static_cast<float>(propertyValue[0].AsDouble());
+      transformMatrix.m12 = static_cast<float>(propertyValue[1].AsDouble());
+      transformMatrix.m13 = static_cast<float>(propertyValue[2].AsDouble());
+      transformMatrix.m14 = static_cast<float>(propertyValue[3].AsDouble());
+      transformMatrix.m21 = static_cast<float>(propertyValue[4].AsDouble());
+      transformMatrix.m22 = static_cast<float>(propertyValue[5].AsDouble());
+      transformMatrix.m23 = static_cast<float>(propertyValue[6].AsDouble());
+      transformMatrix.m24 = static_cast<float>(propertyValue[7].AsDouble());
+      transformMatrix.m31 = static_cast<float>(propertyValue[8].AsDouble());
+      transformMatrix.m32 = static_cast<float>(propertyValue[9].AsDouble());
+      transformMatrix.m33 = static_cast<float>(propertyValue[10].AsDouble());
+      transformMatrix.m34 = static_cast<float>(propertyValue[11].AsDouble());
+      transformMatrix.m41 = static_cast<float>(propertyValue[12].AsDouble());
+      transformMatrix.m42 = static_cast<float>(propertyValue[13].AsDouble());
+      transformMatrix.m43 = static_cast<float>(propertyValue[14].AsDouble());
+      transformMatrix.m44 = static_cast<float>(propertyValue[15].AsDouble());
+
+      if (!element.IsLoaded()) {
+        element.Loaded([self = &self, nodeToUpdate, transformMatrix](auto sender, auto &&) -> auto {
+          self->ApplyTransformMatrix(sender.as<xaml::UIElement>(), nodeToUpdate, transformMatrix);
+        });
+      } else {
+        self.ApplyTransformMatrix(element, nodeToUpdate, transformMatrix);
+      }
+    } else if (propertyValue.IsNull()) {
+      element.TransformMatrix(winrt::Windows::Foundation::Numerics::float4x4::identity());
+    }
+  } else {
+    cdebug << "[Dim down] " << propertyName << "\n";
+  }
+
   return true;
 }
 
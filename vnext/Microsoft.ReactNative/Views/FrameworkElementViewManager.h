@@ -26,8 +26,14 @@ class REACTWINDOWS_EXPORT FrameworkElementViewManager : public ViewManagerBase {
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
       const winrt::Microsoft::ReactNative::JSValue &propertyValue) override;
+  static const PropertyHandlerMap &GetPropertyHandlers();
 
  private:
+  static bool UpdateTransformProperty(
+      ViewManagerBase &viewManager,
+      ShadowNodeBase *nodeToUpdate,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
   void ApplyTransformMatrix(
       xaml::UIElement uielement,
       ShadowNodeBase *shadowNode,
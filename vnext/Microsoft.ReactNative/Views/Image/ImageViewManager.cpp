@@ -111,45 +111,118 @@ ShadowNode *ImageViewManager::createShadow() const {
   return new ImageShadowNode();
 }
 
-bool ImageViewManager::UpdateProperty(
+static bool UpdateResizeModeProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto resizeMode{json_type_traits<facebook::react::ImageResizeMode>::parseJson(propertyValue)};
+  auto grid{nodeToUpdate->GetView().as<winrt::Grid>()};
+  auto reactImage{grid.as<ReactImage>()};
+  reactImage->ResizeMode(resizeMode);
+
+  return true;
+}
+
+static bool UpdateBlurRadiusProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (propertyValue.Type() != winrt::Microsoft::ReactNative::JSValueType::Double &&
+      propertyValue.Type() != winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    return false;
+  }
+
+  auto grid{nodeToUpdate->GetView().as<winrt::Grid>()};
+  auto reactImage{grid.as<ReactImage>()};
+  reactImage->BlurRadius(propertyValue.AsSingle());
+
+  return true;
+}
+
+static bool UpdateTintColorProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (!IsValidColorValue(propertyValue)) {
+    return false;
+  }
+
+  auto grid{nodeToUpdate->GetView().as<winrt::Grid>()};
+  auto reactImage{grid.as<ReactImage>()};
+  reactImage->TintColor(ColorFrom(propertyValue));
+
+  return true;
+}
+
+static bool UpdateCornerRadiusProperties(
+    ViewManagerBase & /*viewManager*/,
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto grid{nodeToUpdate->GetView().as<winrt::Grid>()};
+  if (!TryUpdateCornerRadiusOnNode(nodeToUpdate, grid, propertyName, propertyValue)) {
+    return false;
+  }
 
-  if (grid == nullptr)
-    return true;
+  UpdateCornerRadiusOnElement(nodeToUpdate, grid);
+
+  return true;
+}
 
-  bool finalizeBorderRadius{false};
-  bool ret = true;
-
-  if (propertyName == "source") {
-    setSource(grid, propertyValue);
-  } else if (propertyName == "resizeMode") {
-    auto resizeMode{json_type_traits<facebook::react::ImageResizeMode>::parseJson(propertyValue)};
-    auto reactImage{grid.as<ReactImage>()};
-    reactImage->ResizeMode(resizeMode);
-  } else if (
-      propertyName == "blurRadius" &&
-      (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-       propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)) {
-    auto reactImage{grid.as<ReactImage>()};
-    reactImage->BlurRadius(propertyValue.AsSingle());
-  } else if (propertyName == "tintColor" && IsValidColorValue(propertyValue)) {
-    auto reactImage{grid.as<ReactImage>()};
-    reactImage->TintColor(ColorFrom(propertyValue));
-  } else if (TryUpdateCornerRadiusOnNode(nodeToUpdate, grid, propertyName, propertyValue)) {
-    finalizeBorderRadius = true;
-  } else if (TryUpdateBorderProperties(nodeToUpdate, grid, propertyName, propertyValue)) {
-  } else {
-    ret = Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
-    // TODO: overflow
+static bool UpdateBorderProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto grid{nodeToUpdate->GetView().as<winrt::Grid>()};
+  return TryUpdateBorderProperties(nodeToUpdate, grid, propertyName, propertyValue);
+}
+
+bool ImageViewManager::UpdateProperty(
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
   }
 
-  if (finalizeBorderRadius)
-    UpdateCornerRadiusOnElement(nodeToUpdate, grid);
+  // TODO: overflow
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &ImageViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["source"] = UpdateSourceProperty;
+    result["resizeMode"] = UpdateResizeModeProperty;
+    result["blurRadius"] = UpdateBlurRadiusProperty;
+    result["tintColor"] = UpdateTintColorProperty;
+    for (auto propertyName : CornerRadiusPropertyNames) {
+      result[propertyName] = UpdateCornerRadiusProperties;
+    }
+
+    for (auto propertyName : BorderPropertyNames) {
+      result[propertyName] = UpdateBorderProperties;
+    }
+
+    return result;
+  }();
+
+  return handlers;
+}
+
+/*static*/ bool ImageViewManager::UpdateSourceProperty(
+    ViewManagerBase &viewManager,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto grid{nodeToUpdate->GetView().as<winrt::Grid>()};
+  static_cast<ImageViewManager &>(viewManager).setSource(grid, propertyValue);
 
-  return ret;
+  return true;
 }
 
 void ImageViewManager::EmitImageEvent(winrt::Grid grid, const char *eventName, ReactImageSource &source) {
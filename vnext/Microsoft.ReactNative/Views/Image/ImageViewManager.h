@@ -25,10 +25,16 @@ class ImageViewManager : public FrameworkElementViewManager {
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
       const winrt::Microsoft::ReactNative::JSValue &propertyValue) override;
+  static const PropertyHandlerMap &GetPropertyHandlers();
 
   XamlView CreateViewCore(int64_t tag, const winrt::Microsoft::ReactNative::JSValueObject &) override;
 
  private:
+  static bool UpdateSourceProperty(
+      ViewManagerBase &viewManager,
+      ShadowNodeBase *nodeToUpdate,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
   void setSource(xaml::Controls::Grid grid, const winrt::Microsoft::ReactNative::JSValue &sources);
 };
 } // namespace Microsoft::ReactNative
@@ -44,17 +44,32 @@ bool RawTextViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  auto run = nodeToUpdate->GetView().as<winrt::Run>();
-  if (run == nullptr)
+  if (nodeToUpdate->GetView() == nullptr) {
     return true;
-
-  if (propertyName == "text") {
-    run.Text(asHstring(propertyValue));
-    static_cast<RawTextShadowNode *>(nodeToUpdate)->originalText = winrt::hstring{};
-    NotifyAncestorsTextChanged(nodeToUpdate);
-  } else {
-    return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
   }
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &RawTextViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["text"] = UpdateTextProperty;
+    return result;
+  }();
+
+  return handlers;
+}
+
+/*static*/ bool RawTextViewManager::UpdateTextProperty(
+    ViewManagerBase &viewManager,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto run = nodeToUpdate->GetView().as<winrt::Run>();
+  run.Text(asHstring(propertyValue));
+  static_cast<RawTextShadowNode *>(nodeToUpdate)->originalText = winrt::hstring{};
+  static_cast<RawTextViewManager &>(viewManager).NotifyAncestorsTextChanged(nodeToUpdate);
   return true;
 }
 
@@ -39,10 +39,16 @@ class RawTextViewManager : public ViewManagerBase {
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
       const winrt::Microsoft::ReactNative::JSValue &propertyValue) override;
+  static const PropertyHandlerMap &GetPropertyHandlers();
 
   XamlView CreateViewCore(int64_t tag, const winrt::Microsoft::ReactNative::JSValueObject &) override;
 
  private:
+  static bool UpdateTextProperty(
+      ViewManagerBase &viewManager,
+      ShadowNodeBase *nodeToUpdate,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
   void NotifyAncestorsTextChanged(ShadowNodeBase *nodeToUpdate);
 };
 
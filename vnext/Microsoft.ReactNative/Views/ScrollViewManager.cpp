@@ -37,6 +37,15 @@ class ScrollViewShadowNode : public ShadowNodeBase {
   void updateProperties(winrt::Microsoft::ReactNative::JSValueObject &props) override;
 
  private:
+  using PropertyHandler = void (*)(
+      ScrollViewShadowNode &node,
+      const winrt::ScrollViewer &scrollViewer,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+  using PropertyHandlerMap = std::unordered_map<std::string_view, PropertyHandler>;
+
+  // Handlers of the ScrollView specific properties. The other properties are handled by Super::updateProperties.
+  static const PropertyHandlerMap &GetPropertyHandlers();
+
   void AddHandlers(const winrt::ScrollViewer &scrollViewer);
   void EmitScrollEvent(
       const winrt::ScrollViewer &scrollViewer,
@@ -130,105 +139,174 @@ void ScrollViewShadowNode::createView(const winrt::Microsoft::ReactNative::JSVal
       });
 }
 
-void ScrollViewShadowNode::updateProperties(winrt::Microsoft::ReactNative::JSValueObject &props) {
-  m_updating = true;
-
-  const auto scrollViewer = GetView().as<winrt::ScrollViewer>();
-  if (scrollViewer == nullptr)
-    return;
+/*static*/ const ScrollViewShadowNode::PropertyHandlerMap &ScrollViewShadowNode::GetPropertyHandlers() {
+  using winrt::Microsoft::ReactNative::JSValue;
+  using winrt::Microsoft::ReactNative::JSValueType;
 
-  for (const auto &pair : props) {
-    const std::string &propertyName = pair.first;
-    const auto &propertyValue = pair.second;
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result;
 
-    if (propertyName == "horizontal") {
-      const auto [valid, horizontal] = getPropertyAndValidity(propertyValue, false);
+    result["horizontal"] = [](ScrollViewShadowNode &node,
+                              const winrt::ScrollViewer &scrollViewer,
+                              const JSValue &propertyValue) {
+      const auto [valid, horizontal] = node.getPropertyAndValidity(propertyValue, false);
       if (valid) {
-        m_isHorizontal = horizontal;
+        node.m_isHorizontal = horizontal;
         ScrollViewUWPImplementation(scrollViewer).SetHorizontal(horizontal);
-        SetScrollMode(scrollViewer);
+        node.SetScrollMode(scrollViewer);
       }
-    }
-    if (propertyName == "scrollEnabled") {
-      const auto [valid, scrollEnabled] = getPropertyAndValidity(propertyValue, true);
+    };
+
+    result["scrollEnabled"] = [](ScrollViewShadowNode &node,
+                                 const winrt::ScrollViewer &scrollViewer,
+                                 const JSValue &propertyValue) {
+      const auto [valid, scrollEnabled] = node.getPropertyAndValidity(propertyValue, true);
       if (valid) {
-        m_isScrollingEnabled = scrollEnabled;
-        SetScrollMode(scrollViewer);
+        node.m_isScrollingEnabled = scrollEnabled;
+        node.SetScrollMode(scrollViewer);
       }
-    } else if (propertyName == "showsHorizontalScrollIndicator") {
-      const auto [valid, showsHorizontalScrollIndicator] = getPropertyAndValidity(propertyValue, true);
+    };
+
+    result["showsHorizontalScrollIndicator"] = [](ScrollViewShadowNode &node,
+                                                  const winrt::ScrollViewer &scrollViewer,
+                                                  const JSValue &propertyValue) {
+      const auto [valid, showsHorizontalScrollIndicator] = node.getPropertyAndValidity(propertyValue, true);
       if (valid) {
         scrollViewer.HorizontalScrollBarVisibility(
             showsHorizontalScrollIndicator ? winrt::ScrollBarVisibility::Visible : winrt::ScrollBarVisibility::Hidden);
       }
-    } else if (propertyName == "showsVerticalScrollIndicator") {
-      const auto [valid, showsVerticalScrollIndicator] = getPropertyAndValidity(propertyValue, true);
+    };
+
+    result["showsVerticalScrollIndicator"] = [](ScrollViewShadowNode &node,
+                                                const winrt::ScrollViewer &scrollViewer,
+                                                const JSValue &propertyValue) {
+      const auto [valid, showsVerticalScrollIndicator] = node.getPropertyAndValidity(propertyValue, true);
       if (valid) {
         scrollViewer.VerticalScrollBarVisibility(
             showsVerticalScrollIndicator ? winrt::ScrollBarVisibility::Visible : winrt::ScrollBarVisibility::Hidden);
       }
-    } else if (propertyName == "minimumZoomScale") {
-      const auto [valid, minimumZoomScale] = getPropertyAndValidity(propertyValue, 1.0);
+    };
+
+    result["minimumZoomScale"] = [](ScrollViewShadowNode &node,
+                                    const winrt::ScrollViewer &scrollViewer,
+                                    const JSValue &propertyValue) {
+      const auto [valid, minimumZoomScale] = node.getPropertyAndValidity(propertyValue, 1.0);
       if (valid) {
         scrollViewer.MinZoomFactor(static_cast<float>(minimumZoomScale));
-        UpdateZoomMode(scrollViewer);
+        node.UpdateZoomMode(scrollViewer);
       }
-    } else if (propertyName == "maximumZoomScale") {
-      const auto [valid, maximumZoomScale] = getPropertyAndValidity(propertyValue, 1.0);
+    };
+
+    result["maximumZoomScale"] = [](ScrollViewShadowNode &node,
+                                    const winrt::ScrollViewer &scrollViewer,
+                                    const JSValue &propertyValue) {
+      const auto [valid, maximumZoomScale] = node.getPropertyAndValidity(propertyValue, 1.0);
       if (valid) {
         scrollViewer.MaxZoomFactor(static_cast<float>(maximumZoomScale));
-        UpdateZoomMode(scrollViewer);
+        node.UpdateZoomMode(scrollViewer);
       }
-    } else if (propertyName == "zoomScale") {
-      const auto [valid, zoomScale] = getPropertyAndValidity(propertyValue, 1.0);
+    };
+
+    result["zoomScale"] = [](ScrollViewShadowNode &node,
+                             const winrt::ScrollViewer &scrollViewer,
+                             const JSValue &propertyValue) {
+      const auto [valid, zoomScale] = node.getPropertyAndValidity(propertyValue, 1.0);
       if (valid) {
-        m_zoomFactor = static_cast<float>(zoomScale);
-        m_changeViewAfterLoaded = !scrollViewer.ChangeView(nullptr, nullptr, m_zoomFactor);
+        node.m_zoomFactor = static_cast<float>(zoomScale);
+        node.m_changeViewAfterLoaded = !scrollViewer.ChangeView(nullptr, nullptr, node.m_zoomFactor);
       }
-    } else if (propertyName == "snapToInterval") {
-      const auto [valid, snapToInterval] = getPropertyAndValidity(propertyValue, 0.0);
+    };
+
+    result["snapToInterval"] = [](ScrollViewShadowNode &node,
+                                  const winrt::ScrollViewer &scrollViewer,
+                                  const JSValue &propertyValue) {
+      const auto [valid, snapToInterval] = node.getPropertyAndValidity(propertyValue, 0.0);
       if (valid) {
         ScrollViewUWPImplementation(scrollViewer).SnapToInterval(static_cast<float>(snapToInterval));
       }
-    } else if (propertyName == "snapToOffsets") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array) {
+    };
+
+    result["snapToOffsets"] = [](ScrollViewShadowNode & /*node*/,
+                                 const winrt::ScrollViewer &scrollViewer,
+                                 const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Array) {
         const auto snapToOffsets = winrt::single_threaded_vector<float>();
         for (const auto &val : propertyValue.AsArray()) {
-          if (val.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-              val.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
+          if (val.Type() == JSValueType::Double || val.Type() == JSValueType::Int64)
             snapToOffsets.Append(val.AsSingle());
         }
         ScrollViewUWPImplementation(scrollViewer).SnapToOffsets(snapToOffsets.GetView());
       }
-    } else if (propertyName == "snapToStart") {
-      const auto [valid, snaptoStart] = getPropertyAndValidity(propertyValue, true);
+    };
+
+    result["snapToStart"] = [](ScrollViewShadowNode &node,
+                               const winrt::ScrollViewer &scrollViewer,
+                               const JSValue &propertyValue) {
+      const auto [valid, snaptoStart] = node.getPropertyAndValidity(propertyValue, true);
       if (valid) {
         ScrollViewUWPImplementation(scrollViewer).SnapToStart(snaptoStart);
       }
-    } else if (propertyName == "snapToEnd") {
-      const auto [valid, snapToEnd] = getPropertyAndValidity(propertyValue, true);
+    };
+
+    result["snapToEnd"] = [](ScrollViewShadowNode &node,
+                             const winrt::ScrollViewer &scrollViewer,
+                             const JSValue &propertyValue) {
+      const auto [valid, snapToEnd] = node.getPropertyAndValidity(propertyValue, true);
       if (valid) {
         ScrollViewUWPImplementation(scrollViewer).SnapToEnd(snapToEnd);
       }
-    } else if (propertyName == "keyboardDismissMode") {
-      m_dismissKeyboardOnDrag = false;
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        m_dismissKeyboardOnDrag = (propertyValue.AsString() == "on-drag");
-        if (m_dismissKeyboardOnDrag) {
-          m_SIPEventHandler = std::make_unique<SIPEventHandler>(GetViewManager()->GetReactContext());
-          m_SIPEventHandler->AttachView(GetView(), false /*fireKeyboardEvents*/);
+    };
+
+    result["keyboardDismissMode"] = [](ScrollViewShadowNode &node,
+                                       const winrt::ScrollViewer & /*scrollViewer*/,
+                                       const JSValue &propertyValue) {
+      node.m_dismissKeyboardOnDrag = false;
+      if (propertyValue.Type() == JSValueType::String) {
+        node.m_dismissKeyboardOnDrag = (propertyValue.AsString() == "on-drag");
+        if (node.m_dismissKeyboardOnDrag) {
+          node.m_SIPEventHandler = std::make_unique<SIPEventHandler>(node.GetViewManager()->GetReactContext());
+          node.m_SIPEventHandler->AttachView(node.GetView(), false /*fireKeyboardEvents*/);
         }
       }
-    } else if (propertyName == "snapToAlignment") {
-      const auto [valid, snapToAlignment] = getPropertyAndValidity(propertyValue, winrt::SnapPointsAlignment::Near);
+    };
+
+    result["snapToAlignment"] = [](ScrollViewShadowNode &node,
+                                   const winrt::ScrollViewer &scrollViewer,
+                                   const JSValue &propertyValue) {
+      const auto [valid, snapToAlignment] =
+          node.getPropertyAndValidity(propertyValue, winrt::SnapPointsAlignment::Near);
       if (valid) {
         ScrollViewUWPImplementation(scrollViewer).SnapPointAlignment(snapToAlignment);
       }
-    } else if (propertyName == "pagingEnabled") {
-      const auto [valid, pagingEnabled] = getPropertyAndValidity(propertyValue, false);
+    };
+
+    result["pagingEnabled"] = [](ScrollViewShadowNode &node,
+                                 const winrt::ScrollViewer &scrollViewer,
+                                 const JSValue &propertyValue) {
+      const auto [valid, pagingEnabled] = node.getPropertyAndValidity(propertyValue, false);
       if (valid) {
         ScrollViewUWPImplementation(scrollViewer).PagingEnabled(pagingEnabled);
       }
+    };
+
+    return result;
+  }();
+
+  return handlers;
+}
+
+void ScrollViewShadowNode::updateProperties(winrt::Microsoft::ReactNative::JSValueObject &props) {
+  m_updating = true;
+
+  const auto scrollViewer = GetView().as<winrt::ScrollViewer>();
+  if (scrollViewer == nullptr)
+    return;
+
+  const PropertyHandlerMap &handlers = GetPropertyHandlers();
+  for (const auto &pair : props) {
+    auto it = handlers.find(pair.first);
+    if (it != handlers.end()) {
+      it->second(*this, scrollViewer, pair.second);
     }
   }
 
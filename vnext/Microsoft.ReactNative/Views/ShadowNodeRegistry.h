@@ -2,9 +2,9 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <Utils/DenseTagMap.h>
 #include <Views/PaperShadowNode.h>
 #include <functional/functorref.h>
-#include <map>
 
 namespace Microsoft::ReactNative {
 
@@ -36,7 +36,7 @@ struct ShadowNodeRegistry {
 
  private:
   std::unordered_set<int64_t> m_roots;
-  std::map<int64_t, std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
+  DenseTagMap<std::unique_ptr<ShadowNode, ShadowNodeDeleter>> m_allNodes;
 };
 
 } // namespace Microsoft::ReactNative
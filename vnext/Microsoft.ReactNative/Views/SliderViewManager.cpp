@@ -61,29 +61,55 @@ XamlView SliderViewManager::CreateViewCore(int64_t /*tag*/, const winrt::Microso
   return slider;
 }
 
+static bool UpdateDisabledProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto slider = nodeToUpdate->GetView().as<xaml::Controls::Slider>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    slider.IsEnabled(!propertyValue.AsBoolean());
+  else if (propertyValue.IsNull())
+    slider.ClearValue(xaml::Controls::Control::IsEnabledProperty());
+
+  return true;
+}
+
+static bool UpdateValueProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto slider = nodeToUpdate->GetView().as<xaml::Controls::Slider>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
+    slider.Value(propertyValue.AsDouble());
+  else if (propertyValue.IsNull())
+    slider.Value(0);
+
+  return true;
+}
+
 bool SliderViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  auto slider = nodeToUpdate->GetView().as<xaml::Controls::Slider>();
-  if (slider == nullptr)
+  if (nodeToUpdate->GetView() == nullptr) {
     return true;
-
-  if (propertyName == "disabled") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-      slider.IsEnabled(!propertyValue.AsBoolean());
-    else if (propertyValue.IsNull())
-      slider.ClearValue(xaml::Controls::Control::IsEnabledProperty());
-  } else if (propertyName == "value") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-        propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64)
-      slider.Value(propertyValue.AsDouble());
-    else if (propertyValue.IsNull())
-      slider.Value(0);
-  } else {
-    return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
   }
-  return true;
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &SliderViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["disabled"] = UpdateDisabledProperty;
+    result["value"] = UpdateValueProperty;
+    return result;
+  }();
+
+  return handlers;
 }
 
 } // namespace Microsoft::ReactNative
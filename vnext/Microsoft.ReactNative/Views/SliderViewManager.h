@@ -23,6 +23,7 @@ class SliderViewManager : public ControlViewManager {
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
       const winrt::Microsoft::ReactNative::JSValue &propertyValue) override;
+  static const PropertyHandlerMap &GetPropertyHandlers();
 
   XamlView CreateViewCore(int64_t tag, const winrt::Microsoft::ReactNative::JSValueObject &) override;
 
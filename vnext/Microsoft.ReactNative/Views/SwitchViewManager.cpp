@@ -151,28 +151,54 @@ XamlView SwitchViewManager::CreateViewCore(int64_t /*tag*/, const winrt::Microso
   return toggleSwitch;
 }
 
+static bool UpdateDisabledProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto toggleSwitch = nodeToUpdate->GetView().as<winrt::ToggleSwitch>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    toggleSwitch.IsEnabled(!propertyValue.AsBoolean());
+  else if (propertyValue.IsNull())
+    toggleSwitch.ClearValue(xaml::Controls::Control::IsEnabledProperty());
+
+  return true;
+}
+
+static bool UpdateValueProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto toggleSwitch = nodeToUpdate->GetView().as<winrt::ToggleSwitch>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    toggleSwitch.IsOn(propertyValue.AsBoolean());
+  else if (propertyValue.IsNull())
+    toggleSwitch.ClearValue(winrt::ToggleSwitch::IsOnProperty());
+
+  return true;
+}
+
 bool SwitchViewManager::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  auto toggleSwitch = nodeToUpdate->GetView().as<winrt::ToggleSwitch>();
-  if (toggleSwitch == nullptr)
+  if (nodeToUpdate->GetView() == nullptr) {
     return true;
-
-  if (propertyName == "disabled") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-      toggleSwitch.IsEnabled(!propertyValue.AsBoolean());
-    else if (propertyValue.IsNull())
-      toggleSwitch.ClearValue(xaml::Controls::Control::IsEnabledProperty());
-  } else if (propertyName == "value") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-      toggleSwitch.IsOn(propertyValue.AsBoolean());
-    else if (propertyValue.IsNull())
-      toggleSwitch.ClearValue(winrt::ToggleSwitch::IsOnProperty());
-  } else {
-    return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
   }
-  return true;
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &SwitchViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["disabled"] = UpdateDisabledProperty;
+    result["value"] = UpdateValueProperty;
+    return result;
+  }();
+
+  return handlers;
 }
 
 } // namespace Microsoft::ReactNative
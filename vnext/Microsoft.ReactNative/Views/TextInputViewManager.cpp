@@ -123,6 +123,24 @@ class TextInputShadowNode : public ShadowNodeBase {
   }
 
  private:
+  // The views used by the property handlers of one updateProperties call. secureTextEntry replaces them.
+  struct PropertyUpdate {
+    xaml::Controls::Control Control{nullptr};
+    xaml::Controls::TextBox TextBox{nullptr};
+    xaml::Controls::PasswordBox PasswordBox{nullptr};
+    bool HasKeyDownEvents{false};
+  };
+
+  using PropertyHandler = void (*)(
+      TextInputShadowNode &node,
+      PropertyUpdate &update,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+  using PropertyHandlerMap = std::unordered_map<std::string_view, PropertyHandler>;
+
+  // Handlers of the TextInput specific properties. The other properties are handled by Super::updateProperties.
+  static const PropertyHandlerMap &GetPropertyHandlers();
+
   void dispatchTextInputChangeEvent(winrt::hstring newText);
   void registerEvents();
   void registerPreviewKeyDown();
@@ -465,207 +483,354 @@ void TextInputShadowNode::setPasswordBoxPlaceholderForeground(
   passwordBox.Resources(passwordBoxResource);
 }
 
-void TextInputShadowNode::updateProperties(winrt::Microsoft::ReactNative::JSValueObject &props) {
-  m_updating = true;
-  auto control = GetView().as<xaml::Controls::Control>();
-  auto textBox = control.try_as<xaml::Controls::TextBox>();
-  auto passwordBox = control.try_as<xaml::Controls::PasswordBox>();
-  auto hasKeyDownEvents = false;
+/*static*/ const TextInputShadowNode::PropertyHandlerMap &TextInputShadowNode::GetPropertyHandlers() {
+  using winrt::Microsoft::ReactNative::JSValue;
+  using winrt::Microsoft::ReactNative::JSValueType;
 
-  for (auto &pair : props) {
-    const std::string &propertyName = pair.first;
-    const auto &propertyValue = pair.second;
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result;
 
     // Applicable properties for both TextBox and PasswordBox
-    if (TryUpdateFontProperties(control, propertyName, propertyValue)) {
-      continue;
-    } else if (TryUpdateCharacterSpacing(control, propertyName, propertyValue)) {
-      continue;
-    } else if (propertyName == "allowFontScaling") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        control.IsTextScaleFactorEnabled(propertyValue.AsBoolean());
+    for (auto propertyName : FontPropertyNames) {
+      result[propertyName] = [](TextInputShadowNode & /*node*/,
+                                PropertyUpdate &update,
+                                const std::string &propertyName,
+                                const JSValue &propertyValue) {
+        TryUpdateFontProperties(update.Control, propertyName, propertyValue);
+      };
+    }
+
+    for (auto propertyName : CharacterSpacingPropertyNames) {
+      result[propertyName] = [](TextInputShadowNode & /*node*/,
+                                PropertyUpdate &update,
+                                const std::string &propertyName,
+                                const JSValue &propertyValue) {
+        TryUpdateCharacterSpacing(update.Control, propertyName, propertyValue);
+      };
+    }
+
+    result["allowFontScaling"] = [](TextInputShadowNode & /*node*/,
+                                    PropertyUpdate &update,
+                                    const std::string & /*propertyName*/,
+                                    const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean)
+        update.Control.IsTextScaleFactorEnabled(propertyValue.AsBoolean());
       else if (propertyValue.IsNull())
-        control.ClearValue(xaml::Controls::Control::IsTextScaleFactorEnabledProperty());
-    } else if (propertyName == "clearTextOnFocus") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        m_shouldClearTextOnFocus = propertyValue.AsBoolean();
-    } else if (propertyName == "selectTextOnFocus") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        m_shouldSelectTextOnFocus = propertyValue.AsBoolean();
-    } else if (propertyName == "mostRecentEventCount") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        m_mostRecentEventCount = propertyValue.AsInt32();
+        update.Control.ClearValue(xaml::Controls::Control::IsTextScaleFactorEnabledProperty());
+    };
+
+    result["clearTextOnFocus"] = [](TextInputShadowNode &node,
+                                    PropertyUpdate & /*update*/,
+                                    const std::string & /*propertyName*/,
+                                    const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean)
+        node.m_shouldClearTextOnFocus = propertyValue.AsBoolean();
+    };
+
+    result["selectTextOnFocus"] = [](TextInputShadowNode &node,
+                                     PropertyUpdate & /*update*/,
+                                     const std::string & /*propertyName*/,
+                                     const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean)
+        node.m_shouldSelectTextOnFocus = propertyValue.AsBoolean();
+    };
+
+    result["mostRecentEventCount"] = [](TextInputShadowNode &node,
+                                        PropertyUpdate & /*update*/,
+                                        const std::string & /*propertyName*/,
+                                        const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Double || propertyValue.Type() == JSValueType::Int64) {
+        node.m_mostRecentEventCount = propertyValue.AsInt32();
       }
-    } else if (propertyName == "contextMenuHidden") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        m_contextMenuHidden = propertyValue.AsBoolean();
-    } else if (propertyName == "caretHidden") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
-        m_hideCaret = propertyValue.AsBoolean();
-        HideCaretIfNeeded();
+    };
+
+    result["contextMenuHidden"] = [](TextInputShadowNode &node,
+                                     PropertyUpdate & /*update*/,
+                                     const std::string & /*propertyName*/,
+                                     const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean)
+        node.m_contextMenuHidden = propertyValue.AsBoolean();
+    };
+
+    result["caretHidden"] = [](TextInputShadowNode &node,
+                               PropertyUpdate & /*update*/,
+                               const std::string & /*propertyName*/,
+                               const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean) {
+        node.m_hideCaret = propertyValue.AsBoolean();
+        node.HideCaretIfNeeded();
       }
-    } else if (propertyName == "secureTextEntry") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
+    };
+
+    result["secureTextEntry"] = [](TextInputShadowNode &node,
+                                   PropertyUpdate &update,
+                                   const std::string & /*propertyName*/,
+                                   const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean) {
         if (propertyValue.AsBoolean()) {
-          if (m_isTextBox) {
+          if (node.m_isTextBox) {
             xaml::Controls::PasswordBox newPasswordBox;
-            ReparentView(newPasswordBox);
-            m_isTextBox = false;
-            registerEvents();
-            control = newPasswordBox.as<xaml::Controls::Control>();
-            passwordBox = newPasswordBox;
-            if (!m_placeholderTextColor.IsNull()) {
-              setPasswordBoxPlaceholderForeground(newPasswordBox, m_placeholderTextColor);
+            node.ReparentView(newPasswordBox);
+            node.m_isTextBox = false;
+            node.registerEvents();
+            update.Control = newPasswordBox.as<xaml::Controls::Control>();
+            update.PasswordBox = newPasswordBox;
+            if (!node.m_placeholderTextColor.IsNull()) {
+              node.setPasswordBoxPlaceholderForeground(newPasswordBox, node.m_placeholderTextColor);
             }
           }
         } else {
-          if (!m_isTextBox) {
+          if (!node.m_isTextBox) {
             xaml::Controls::TextBox newTextBox;
-            ReparentView(newTextBox);
-            m_isTextBox = true;
-            registerEvents();
-            control = newTextBox.as<xaml::Controls::Control>();
-            textBox = newTextBox;
-            if (!m_placeholderTextColor.IsNull()) {
-              textBox.PlaceholderForeground(SolidColorBrushFrom(m_placeholderTextColor));
+            node.ReparentView(newTextBox);
+            node.m_isTextBox = true;
+            node.registerEvents();
+            update.Control = newTextBox.as<xaml::Controls::Control>();
+            update.TextBox = newTextBox;
+            if (!node.m_placeholderTextColor.IsNull()) {
+              update.TextBox.PlaceholderForeground(SolidColorBrushFrom(node.m_placeholderTextColor));
             }
           }
         }
       }
-    } else if (propertyName == "maxLength") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-          propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-        control.SetValue(
-            m_isTextBox ? xaml::Controls::TextBox::MaxLengthProperty()
-                        : xaml::Controls::PasswordBox::MaxLengthProperty(),
+    };
+
+    result["maxLength"] = [](TextInputShadowNode &node,
+                             PropertyUpdate &update,
+                             const std::string & /*propertyName*/,
+                             const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Double || propertyValue.Type() == JSValueType::Int64) {
+        update.Control.SetValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::MaxLengthProperty()
+                             : xaml::Controls::PasswordBox::MaxLengthProperty(),
             winrt::PropertyValue::CreateInt32(propertyValue.AsInt32()));
       } else if (propertyValue.IsNull()) {
-        control.ClearValue(
-            m_isTextBox ? xaml::Controls::TextBox::MaxLengthProperty()
-                        : xaml::Controls::PasswordBox::MaxLengthProperty());
+        update.Control.ClearValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::MaxLengthProperty()
+                             : xaml::Controls::PasswordBox::MaxLengthProperty());
       }
-    } else if (propertyName == "placeholder") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        control.SetValue(
-            m_isTextBox ? xaml::Controls::TextBox::PlaceholderTextProperty()
-                        : xaml::Controls::PasswordBox::PlaceholderTextProperty(),
+    };
+
+    result["placeholder"] = [](TextInputShadowNode &node,
+                               PropertyUpdate &update,
+                               const std::string & /*propertyName*/,
+                               const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::String) {
+        update.Control.SetValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::PlaceholderTextProperty()
+                             : xaml::Controls::PasswordBox::PlaceholderTextProperty(),
             winrt::PropertyValue::CreateString(asHstring(propertyValue)));
       } else if (propertyValue.IsNull()) {
-        control.ClearValue(
-            m_isTextBox ? xaml::Controls::TextBox::PlaceholderTextProperty()
-                        : xaml::Controls::PasswordBox::PlaceholderTextProperty());
+        update.Control.ClearValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::PlaceholderTextProperty()
+                             : xaml::Controls::PasswordBox::PlaceholderTextProperty());
       }
-    } else if (propertyName == "selectionColor") {
+    };
+
+    result["selectionColor"] = [](TextInputShadowNode &node,
+                                  PropertyUpdate &update,
+                                  const std::string & /*propertyName*/,
+                                  const JSValue &propertyValue) {
       if (IsValidColorValue(propertyValue)) {
-        control.SetValue(
-            m_isTextBox ? xaml::Controls::TextBox::SelectionHighlightColorProperty()
-                        : xaml::Controls::PasswordBox::SelectionHighlightColorProperty(),
+        update.Control.SetValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::SelectionHighlightColorProperty()
+                             : xaml::Controls::PasswordBox::SelectionHighlightColorProperty(),
             SolidColorBrushFrom(propertyValue));
       } else if (propertyValue.IsNull())
-        control.ClearValue(
-            m_isTextBox ? xaml::Controls::TextBox::SelectionHighlightColorProperty()
-                        : xaml::Controls::PasswordBox::SelectionHighlightColorProperty());
-    } else if (propertyName == "keyboardType") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        auto inputScopeNameVaue = parseKeyboardType(propertyValue, m_isTextBox);
+        update.Control.ClearValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::SelectionHighlightColorProperty()
+                             : xaml::Controls::PasswordBox::SelectionHighlightColorProperty());
+    };
+
+    result["keyboardType"] = [](TextInputShadowNode &node,
+                                PropertyUpdate &update,
+                                const std::string & /*propertyName*/,
+                                const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::String) {
+        auto inputScopeNameVaue = parseKeyboardType(propertyValue, node.m_isTextBox);
         auto scope = xaml::Input::InputScope();
         auto scopeName = xaml::Input::InputScopeName(inputScopeNameVaue);
         auto names = scope.Names();
         names.Append(scopeName);
-        control.SetValue(
-            m_isTextBox ? xaml::Controls::TextBox::InputScopeProperty()
-                        : xaml::Controls::PasswordBox::InputScopeProperty(),
+        update.Control.SetValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::InputScopeProperty()
+                             : xaml::Controls::PasswordBox::InputScopeProperty(),
             scope);
       } else if (propertyValue.IsNull())
-        control.ClearValue(
-            m_isTextBox ? xaml::Controls::TextBox::InputScopeProperty()
-                        : xaml::Controls::PasswordBox::InputScopeProperty());
-    } else if (propertyName == "placeholderTextColor") {
-      m_placeholderTextColor = nullptr;
-      if (textBox.try_as<xaml::Controls::ITextBox6>() && m_isTextBox) {
+        update.Control.ClearValue(
+            node.m_isTextBox ? xaml::Controls::TextBox::InputScopeProperty()
+                             : xaml::Controls::PasswordBox::InputScopeProperty());
+    };
+
+    result["placeholderTextColor"] = [](TextInputShadowNode &node,
+                                        PropertyUpdate &update,
+                                        const std::string & /*propertyName*/,
+                                        const JSValue &propertyValue) {
+      node.m_placeholderTextColor = nullptr;
+      if (update.TextBox.try_as<xaml::Controls::ITextBox6>() && node.m_isTextBox) {
         if (IsValidColorValue(propertyValue)) {
-          m_placeholderTextColor = propertyValue.Copy();
-          textBox.PlaceholderForeground(SolidColorBrushFrom(propertyValue));
+          node.m_placeholderTextColor = propertyValue.Copy();
+          update.TextBox.PlaceholderForeground(SolidColorBrushFrom(propertyValue));
         } else if (propertyValue.IsNull())
-          textBox.ClearValue(xaml::Controls::TextBox::PlaceholderForegroundProperty());
-      } else if (m_isTextBox != true && IsValidColorValue(propertyValue)) {
-        setPasswordBoxPlaceholderForeground(passwordBox, propertyValue);
+          update.TextBox.ClearValue(xaml::Controls::TextBox::PlaceholderForegroundProperty());
+      } else if (node.m_isTextBox != true && IsValidColorValue(propertyValue)) {
+        node.setPasswordBoxPlaceholderForeground(update.PasswordBox, propertyValue);
       }
-    } else if (propertyName == "clearTextOnSubmit") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        m_shouldClearTextOnSubmit = propertyValue.AsBoolean();
-    } else if (propertyName == "submitKeyEvents") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Array)
-        m_submitKeyEvents = KeyboardHelper::FromJS(propertyValue);
+    };
+
+    result["clearTextOnSubmit"] = [](TextInputShadowNode &node,
+                                     PropertyUpdate & /*update*/,
+                                     const std::string & /*propertyName*/,
+                                     const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean)
+        node.m_shouldClearTextOnSubmit = propertyValue.AsBoolean();
+    };
+
+    result["submitKeyEvents"] = [](TextInputShadowNode &node,
+                                   PropertyUpdate & /*update*/,
+                                   const std::string & /*propertyName*/,
+                                   const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Array)
+        node.m_submitKeyEvents = KeyboardHelper::FromJS(propertyValue);
       else if (propertyValue.IsNull())
-        m_submitKeyEvents.clear();
-    } else if (propertyName == "keyDownEvents") {
-      hasKeyDownEvents = propertyValue.ItemCount() > 0;
-    } else if (propertyName == "autoFocus") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        m_autoFocus = propertyValue.AsBoolean();
-    } else {
-      if (m_isTextBox) { // Applicable properties for TextBox
-        if (TryUpdateTextAlignment(textBox, propertyName, propertyValue)) {
-          continue;
-        } else if (propertyName == "multiline") {
-          if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
-            const bool isMultiline = propertyValue.AsBoolean();
-            textBox.TextWrapping(isMultiline ? xaml::TextWrapping::Wrap : xaml::TextWrapping::NoWrap);
-            textBox.AcceptsReturn(isMultiline);
-          } else if (propertyValue.IsNull())
-            textBox.ClearValue(xaml::Controls::TextBox::TextWrappingProperty());
-        } else if (propertyName == "editable") {
-          if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-            textBox.IsReadOnly(!propertyValue.AsBoolean());
-          else if (propertyValue.IsNull())
-            textBox.ClearValue(xaml::Controls::TextBox::IsReadOnlyProperty());
-        } else if (propertyName == "scrollEnabled") {
-          if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean &&
-              textBox.TextWrapping() == xaml::TextWrapping::Wrap) {
-            auto scrollMode =
-                propertyValue.AsBoolean() ? xaml::Controls::ScrollMode::Auto : xaml::Controls::ScrollMode::Disabled;
-            xaml::Controls::ScrollViewer::SetVerticalScrollMode(textBox, scrollMode);
-            xaml::Controls::ScrollViewer::SetHorizontalScrollMode(textBox, scrollMode);
-          }
-        } else if (propertyName == "selection") {
-          if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Object) {
-            auto selection = json_type_traits<Selection>::parseJson(propertyValue);
-            SetSelection(selection.start, selection.end);
-          }
-        } else if (propertyName == "spellCheck") {
-          if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-            textBox.IsSpellCheckEnabled(propertyValue.AsBoolean());
-          else if (propertyValue.IsNull())
-            textBox.ClearValue(xaml::Controls::TextBox::IsSpellCheckEnabledProperty());
-        } else if (propertyName == "text") {
-          SetText(propertyValue);
-        } else if (propertyName == "autoCapitalize") {
-          if (textBox.try_as<xaml::Controls::ITextBox6>()) {
-            if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-              if (propertyValue.AsString() == "characters") {
-                textBox.CharacterCasing(xaml::Controls::CharacterCasing::Upper);
-              } else { // anything else turns off autoCap (should be "None" but
-                       // we don't support "words"/"senetences" yet)
-                textBox.CharacterCasing(xaml::Controls::CharacterCasing::Normal);
-              }
-            } else if (propertyValue.IsNull())
-              textBox.ClearValue(xaml::Controls::TextBox::CharacterCasingProperty());
+        node.m_submitKeyEvents.clear();
+    };
+
+    result["keyDownEvents"] = [](TextInputShadowNode & /*node*/,
+                                 PropertyUpdate &update,
+                                 const std::string & /*propertyName*/,
+                                 const JSValue &propertyValue) {
+      update.HasKeyDownEvents = propertyValue.ItemCount() > 0;
+    };
+
+    result["autoFocus"] = [](TextInputShadowNode &node,
+                             PropertyUpdate & /*update*/,
+                             const std::string & /*propertyName*/,
+                             const JSValue &propertyValue) {
+      if (propertyValue.Type() == JSValueType::Boolean)
+        node.m_autoFocus = propertyValue.AsBoolean();
+    };
+
+    result["text"] = [](TextInputShadowNode &node,
+                        PropertyUpdate & /*update*/,
+                        const std::string & /*propertyName*/,
+                        const JSValue &propertyValue) { node.SetText(propertyValue); };
+
+    // Applicable properties for TextBox
+    result["textAlign"] = [](TextInputShadowNode &node,
+                             PropertyUpdate &update,
+                             const std::string &propertyName,
+                             const JSValue &propertyValue) {
+      if (node.m_isTextBox)
+        TryUpdateTextAlignment(update.TextBox, propertyName, propertyValue);
+    };
+
+    result["multiline"] = [](TextInputShadowNode &node,
+                             PropertyUpdate &update,
+                             const std::string & /*propertyName*/,
+                             const JSValue &propertyValue) {
+      if (!node.m_isTextBox)
+        return;
+
+      if (propertyValue.Type() == JSValueType::Boolean) {
+        const bool isMultiline = propertyValue.AsBoolean();
+        update.TextBox.TextWrapping(isMultiline ? xaml::TextWrapping::Wrap : xaml::TextWrapping::NoWrap);
+        update.TextBox.AcceptsReturn(isMultiline);
+      } else if (propertyValue.IsNull())
+        update.TextBox.ClearValue(xaml::Controls::TextBox::TextWrappingProperty());
+    };
+
+    result["editable"] = [](TextInputShadowNode &node,
+                            PropertyUpdate &update,
+                            const std::string & /*propertyName*/,
+                            const JSValue &propertyValue) {
+      if (!node.m_isTextBox)
+        return;
+
+      if (propertyValue.Type() == JSValueType::Boolean)
+        update.TextBox.IsReadOnly(!propertyValue.AsBoolean());
+      else if (propertyValue.IsNull())
+        update.TextBox.ClearValue(xaml::Controls::TextBox::IsReadOnlyProperty());
+    };
+
+    result["scrollEnabled"] = [](TextInputShadowNode &node,
+                                 PropertyUpdate &update,
+                                 const std::string & /*propertyName*/,
+                                 const JSValue &propertyValue) {
+      if (node.m_isTextBox && propertyValue.Type() == JSValueType::Boolean &&
+          update.TextBox.TextWrapping() == xaml::TextWrapping::Wrap) {
+        auto scrollMode =
+            propertyValue.AsBoolean() ? xaml::Controls::ScrollMode::Auto : xaml::Controls::ScrollMode::Disabled;
+        xaml::Controls::ScrollViewer::SetVerticalScrollMode(update.TextBox, scrollMode);
+        xaml::Controls::ScrollViewer::SetHorizontalScrollMode(update.TextBox, scrollMode);
+      }
+    };
+
+    result["selection"] = [](TextInputShadowNode &node,
+                             PropertyUpdate & /*update*/,
+                             const std::string & /*propertyName*/,
+                             const JSValue &propertyValue) {
+      if (node.m_isTextBox && propertyValue.Type() == JSValueType::Object) {
+        auto selection = json_type_traits<Selection>::parseJson(propertyValue);
+        node.SetSelection(selection.start, selection.end);
+      }
+    };
+
+    result["spellCheck"] = [](TextInputShadowNode &node,
+                              PropertyUpdate &update,
+                              const std::string & /*propertyName*/,
+                              const JSValue &propertyValue) {
+      if (!node.m_isTextBox)
+        return;
+
+      if (propertyValue.Type() == JSValueType::Boolean)
+        update.TextBox.IsSpellCheckEnabled(propertyValue.AsBoolean());
+      else if (propertyValue.IsNull())
+        update.TextBox.ClearValue(xaml::Controls::TextBox::IsSpellCheckEnabledProperty());
+    };
+
+    result["autoCapitalize"] = [](TextInputShadowNode &node,
+                                  PropertyUpdate &update,
+                                  const std::string & /*propertyName*/,
+                                  const JSValue &propertyValue) {
+      if (node.m_isTextBox && update.TextBox.try_as<xaml::Controls::ITextBox6>()) {
+        if (propertyValue.Type() == JSValueType::String) {
+          if (propertyValue.AsString() == "characters") {
+            update.TextBox.CharacterCasing(xaml::Controls::CharacterCasing::Upper);
+          } else { // anything else turns off autoCap (should be "None" but
+                   // we don't support "words"/"senetences" yet)
+            update.TextBox.CharacterCasing(xaml::Controls::CharacterCasing::Normal);
           }
-        }
-      } else { // Applicable properties for PasswordBox
-        if (propertyName == "text" && !m_isTextBox) {
-          SetText(propertyValue);
-        }
+        } else if (propertyValue.IsNull())
+          update.TextBox.ClearValue(xaml::Controls::TextBox::CharacterCasingProperty());
       }
+    };
+
+    return result;
+  }();
+
+  return handlers;
+}
+
+void TextInputShadowNode::updateProperties(winrt::Microsoft::ReactNative::JSValueObject &props) {
+  m_updating = true;
+  PropertyUpdate update;
+  update.Control = GetView().as<xaml::Controls::Control>();
+  update.TextBox = update.Control.try_as<xaml::Controls::TextBox>();
+  update.PasswordBox = update.Control.try_as<xaml::Controls::PasswordBox>();
+
+  const PropertyHandlerMap &handlers = GetPropertyHandlers();
+  for (auto &pair : props) {
+    auto it = handlers.find(pair.first);
+    if (it != handlers.end()) {
+      it->second(*this, update, pair.first, pair.second);
     }
   }
 
   Super::updateProperties(props);
 
   // We need to re-register the PreviewKeyDown handler so it is invoked after the ShadowNodeBase handler
-  if (hasKeyDownEvents) {
+  if (update.HasKeyDownEvents) {
     m_controlPreviewKeyDownRevoker.revoke();
     registerPreviewKeyDown();
   }
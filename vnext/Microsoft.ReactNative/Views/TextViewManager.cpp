@@ -159,84 +159,239 @@ XamlView TextViewManager::CreateViewCore(int64_t /*tag*/, const winrt::Microsoft
   return textBlock;
 }
 
-bool TextViewManager::UpdateProperty(
+static bool UpdateColorProperty(
+    ViewManagerBase & /*viewManager*/,
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
-  if (textBlock == nullptr)
-    return true;
+  if (!TryUpdateForeground(textBlock, propertyName, propertyValue)) {
+    return false;
+  }
 
-  if (TryUpdateForeground(textBlock, propertyName, propertyValue)) {
-    static_cast<TextShadowNode *>(nodeToUpdate)->m_foregroundColor = ColorFrom(propertyValue);
-  } else if (TryUpdateFontProperties(textBlock, propertyName, propertyValue)) {
-  } else if (propertyName == "textTransform") {
-    auto textNode = static_cast<TextShadowNode *>(nodeToUpdate);
-    textNode->textTransform = TransformableText::GetTextTransform(propertyValue);
-    VirtualTextShadowNode::ApplyTextTransform(
-        *textNode, textNode->textTransform, /* forceUpdate = */ true, /* isRoot = */ true);
-  } else if (TryUpdatePadding(nodeToUpdate, textBlock, propertyName, propertyValue)) {
-  } else if (TryUpdateTextAlignment(textBlock, propertyName, propertyValue)) {
-  } else if (TryUpdateTextTrimming(textBlock, propertyName, propertyValue)) {
-  } else if (TryUpdateTextDecorationLine(textBlock, propertyName, propertyValue)) {
-    // Temporary workaround for bug in XAML which fails to flush old TextDecorationLine render
-    // Link to Bug: https://github.com/microsoft/microsoft-ui-xaml/issues/1093#issuecomment-514282402
-    winrt::hstring text(textBlock.Text().c_str());
-    textBlock.Text(L"");
-    textBlock.Text(text);
-  } else if (TryUpdateCharacterSpacing(textBlock, propertyName, propertyValue)) {
-  } else if (propertyName == "numberOfLines") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-        propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-      auto numberLines = propertyValue.AsInt32();
-      if (numberLines == 1) {
-        textBlock.TextWrapping(xaml::TextWrapping::NoWrap); // setting no wrap for single line
-                                                            // text for better trimming
-                                                            // experience
-      } else {
-        textBlock.TextWrapping(xaml::TextWrapping::Wrap);
-      }
-      textBlock.MaxLines(numberLines);
-    } else if (propertyValue.IsNull()) {
-      textBlock.TextWrapping(xaml::TextWrapping::Wrap); // set wrapping back to default
-      textBlock.ClearValue(xaml::Controls::TextBlock::MaxLinesProperty());
-    }
-  } else if (propertyName == "lineHeight") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
-        propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
-      textBlock.LineHeight(propertyValue.AsInt32());
-      textBlock.LineStackingStrategy(xaml::LineStackingStrategy::BlockLineHeight);
-    } else if (propertyValue.IsNull()) {
-      textBlock.ClearValue(xaml::Controls::TextBlock::LineHeightProperty());
-      textBlock.ClearValue(xaml::Controls::TextBlock::LineStackingStrategyProperty());
-    }
-  } else if (propertyName == "selectable") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-      textBlock.IsTextSelectionEnabled(propertyValue.AsBoolean());
-    else if (propertyValue.IsNull())
-      textBlock.ClearValue(xaml::Controls::TextBlock::IsTextSelectionEnabledProperty());
-  } else if (propertyName == "allowFontScaling") {
-    if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
-      textBlock.IsTextScaleFactorEnabled(propertyValue.AsBoolean());
+  static_cast<TextShadowNode *>(nodeToUpdate)->m_foregroundColor = ColorFrom(propertyValue);
+
+  return true;
+}
+
+static bool UpdateFontProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  return TryUpdateFontProperties(textBlock, propertyName, propertyValue);
+}
+
+static bool UpdateTextTransformProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textNode = static_cast<TextShadowNode *>(nodeToUpdate);
+  textNode->textTransform = TransformableText::GetTextTransform(propertyValue);
+  VirtualTextShadowNode::ApplyTextTransform(
+      *textNode, textNode->textTransform, /* forceUpdate = */ true, /* isRoot = */ true);
+
+  return true;
+}
+
+static bool UpdatePaddingProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  return TryUpdatePadding(nodeToUpdate, textBlock, propertyName, propertyValue);
+}
+
+static bool UpdateTextAlignProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  return TryUpdateTextAlignment(textBlock, propertyName, propertyValue);
+}
+
+static bool UpdateEllipsizeModeProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  return TryUpdateTextTrimming(textBlock, propertyName, propertyValue);
+}
+
+static bool UpdateTextDecorationLineProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  if (!TryUpdateTextDecorationLine(textBlock, propertyName, propertyValue)) {
+    return false;
+  }
+
+  // Temporary workaround for bug in XAML which fails to flush old TextDecorationLine render
+  // Link to Bug: https://github.com/microsoft/microsoft-ui-xaml/issues/1093#issuecomment-514282402
+  winrt::hstring text(textBlock.Text().c_str());
+  textBlock.Text(L"");
+  textBlock.Text(text);
+
+  return true;
+}
+
+static bool UpdateCharacterSpacingProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  return TryUpdateCharacterSpacing(textBlock, propertyName, propertyValue);
+}
+
+static bool UpdateNumberOfLinesProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    auto numberLines = propertyValue.AsInt32();
+    if (numberLines == 1) {
+      textBlock.TextWrapping(xaml::TextWrapping::NoWrap); // setting no wrap for single line
+                                                          // text for better trimming
+                                                          // experience
     } else {
-      textBlock.ClearValue(xaml::Controls::TextBlock::IsTextScaleFactorEnabledProperty());
-    }
-  } else if (propertyName == "selectionColor") {
-    if (IsValidColorValue(propertyValue)) {
-      textBlock.SelectionHighlightColor(SolidColorBrushFrom(propertyValue));
-    } else
-      textBlock.ClearValue(xaml::Controls::TextBlock::SelectionHighlightColorProperty());
-  } else if (propertyName == "backgroundColor") {
-    if (IsValidColorValue(propertyValue)) {
-      static_cast<TextShadowNode *>(nodeToUpdate)->m_backgroundColor = ColorFrom(propertyValue);
+      textBlock.TextWrapping(xaml::TextWrapping::Wrap);
     }
+    textBlock.MaxLines(numberLines);
+  } else if (propertyValue.IsNull()) {
+    textBlock.TextWrapping(xaml::TextWrapping::Wrap); // set wrapping back to default
+    textBlock.ClearValue(xaml::Controls::TextBlock::MaxLinesProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateLineHeightProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Double ||
+      propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Int64) {
+    textBlock.LineHeight(propertyValue.AsInt32());
+    textBlock.LineStackingStrategy(xaml::LineStackingStrategy::BlockLineHeight);
+  } else if (propertyValue.IsNull()) {
+    textBlock.ClearValue(xaml::Controls::TextBlock::LineHeightProperty());
+    textBlock.ClearValue(xaml::Controls::TextBlock::LineStackingStrategyProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateSelectableProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    textBlock.IsTextSelectionEnabled(propertyValue.AsBoolean());
+  else if (propertyValue.IsNull())
+    textBlock.ClearValue(xaml::Controls::TextBlock::IsTextSelectionEnabledProperty());
+
+  return true;
+}
+
+static bool UpdateAllowFontScalingProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean) {
+    textBlock.IsTextScaleFactorEnabled(propertyValue.AsBoolean());
   } else {
-    return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
+    textBlock.ClearValue(xaml::Controls::TextBlock::IsTextScaleFactorEnabledProperty());
+  }
+
+  return true;
+}
+
+static bool UpdateSelectionColorProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto textBlock = nodeToUpdate->GetView().as<xaml::Controls::TextBlock>();
+  if (IsValidColorValue(propertyValue)) {
+    textBlock.SelectionHighlightColor(SolidColorBrushFrom(propertyValue));
+  } else
+    textBlock.ClearValue(xaml::Controls::TextBlock::SelectionHighlightColorProperty());
+
+  return true;
+}
+
+static bool UpdateBackgroundColorProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (IsValidColorValue(propertyValue)) {
+    static_cast<TextShadowNode *>(nodeToUpdate)->m_backgroundColor = ColorFrom(propertyValue);
   }
 
   return true;
 }
 
+bool TextViewManager::UpdateProperty(
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
+  }
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &TextViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["color"] = UpdateColorProperty;
+    for (auto propertyName : FontPropertyNames) {
+      result[propertyName] = UpdateFontProperties;
+    }
+
+    result["textTransform"] = UpdateTextTransformProperty;
+    for (auto propertyName : PaddingPropertyNames) {
+      result[propertyName] = UpdatePaddingProperties;
+    }
+
+    result["textAlign"] = UpdateTextAlignProperty;
+    result["ellipsizeMode"] = UpdateEllipsizeModeProperty;
+    result["textDecorationLine"] = UpdateTextDecorationLineProperty;
+    for (auto propertyName : CharacterSpacingPropertyNames) {
+      result[propertyName] = UpdateCharacterSpacingProperties;
+    }
+
+    result["numberOfLines"] = UpdateNumberOfLinesProperty;
+    result["lineHeight"] = UpdateLineHeightProperty;
+    result["selectable"] = UpdateSelectableProperty;
+    result["allowFontScaling"] = UpdateAllowFontScalingProperty;
+    result["selectionColor"] = UpdateSelectionColorProperty;
+    result["backgroundColor"] = UpdateBackgroundColorProperty;
+    return result;
+  }();
+
+  return handlers;
+}
+
 void TextViewManager::AddView(const XamlView &parent, const XamlView &child, int64_t index) {
   auto textBlock(parent.as<xaml::Controls::TextBlock>());
 
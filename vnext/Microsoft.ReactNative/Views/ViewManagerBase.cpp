@@ -18,6 +18,8 @@
 #include <TestHook.h>
 #include <Views/ExpressionAnimationStore.h>
 #include <Views/ShadowNodeBase.h>
+#include <Views/YogaMeasureCache.h>
+#include <Views/YogaMeasureHashes.h>
 
 namespace winrt {
 using namespace xaml;
@@ -54,6 +56,19 @@ YGSize DefaultYogaSelfMeasureFunc(
   float constrainToHeight =
       heightMode == YGMeasureMode::YGMeasureModeUndefined ? std::numeric_limits<float>::max() : height;
 
+  std::optional<YogaMeasureCacheKey> cacheKey;
+  if (context->useMeasureCache) {
+    uint64_t contentHash;
+    uint64_t styleHash;
+    if (TryGetYogaMeasureHashes(element, contentHash, styleHash)) {
+      cacheKey = MakeYogaMeasureCacheKey(
+          contentHash, styleHash, GetYogaMeasureRasterizationScale(element), width, widthMode, height, heightMode);
+      if (auto cachedSize = YogaMeasureCache::Instance().Find(*cacheKey)) {
+        return *cachedSize;
+      }
+    }
+  }
+
   try {
     winrt::Windows::Foundation::Size availableSpace(constrainToWidth, constrainToHeight);
 
@@ -77,6 +92,11 @@ YGSize DefaultYogaSelfMeasureFunc(
   YGSize desiredSize = {
       GetConstrainedResult(constrainToWidth, element.DesiredSize().Width, widthMode),
       GetConstrainedResult(constrainToHeight, element.DesiredSize().Height, heightMode)};
+
+  if (cacheKey) {
+    YogaMeasureCache::Instance().Insert(*cacheKey, desiredSize);
+  }
+
   return desiredSize;
 }
 
@@ -254,18 +274,48 @@ bool ViewManagerBase::UpdateProperty(
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
-  if (propertyName == "onLayout") {
-    nodeToUpdate->m_onLayoutRegistered = !propertyValue.IsNull() && propertyValue.AsBoolean();
-  } else if (propertyName == "keyDownEvents") {
-    nodeToUpdate->UpdateHandledKeyboardEvents(propertyName, propertyValue);
-  } else if (propertyName == "keyUpEvents") {
-    nodeToUpdate->UpdateHandledKeyboardEvents(propertyName, propertyValue);
-  } else {
-    return false;
-  }
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+static bool UpdateOnLayoutProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  nodeToUpdate->m_onLayoutRegistered = !propertyValue.IsNull() && propertyValue.AsBoolean();
   return true;
 }
 
+static bool UpdateKeyboardEventProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  nodeToUpdate->UpdateHandledKeyboardEvents(propertyName, propertyValue);
+  return true;
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &ViewManagerBase::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result;
+    result["onLayout"] = UpdateOnLayoutProperty;
+    result["keyDownEvents"] = UpdateKeyboardEventProperties;
+    result["keyUpEvents"] = UpdateKeyboardEventProperties;
+    return result;
+  }();
+
+  return handlers;
+}
+
+bool ViewManagerBase::UpdatePropertyWithHandlers(
+    const PropertyHandlerMap &handlers,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto it = handlers.find(propertyName);
+  return it != handlers.end() && it->second(*this, nodeToUpdate, propertyName, propertyValue);
+}
+
 void ViewManagerBase::TransferProperties(const XamlView & /*oldView*/, const XamlView & /*newView*/) {}
 
 void ViewManagerBase::DispatchCommand(
@@ -9,6 +9,8 @@
 #include <XamlView.h>
 #include <folly/dynamic.h>
 #include <yoga/yoga.h>
+#include <string_view>
+#include <unordered_map>
 
 namespace Microsoft::ReactNative {
 
@@ -21,6 +23,12 @@ struct YogaContext {
   YogaContext(const XamlView &view_) : view(view_) {}
 
   XamlView view;
+
+  // The view manager's measure function. Yoga calls it on the UI thread through the NativeUIManager.
+  YGMeasureFunc measureFunc = nullptr;
+
+  // Whether DefaultYogaSelfMeasureFunc may reuse the sizes stored in the YogaMeasureCache.
+  bool useMeasureCache = false;
 };
 
 REACTWINDOWS_EXPORT YGSize DefaultYogaSelfMeasureFunc(
@@ -93,6 +101,25 @@ class REACTWINDOWS_EXPORT ViewManagerBase : public IViewManager {
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
       const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+
+  // Handles one property. Returns false if the property is not handled.
+  using PropertyHandler = bool (*)(
+      ViewManagerBase &viewManager,
+      ShadowNodeBase *nodeToUpdate,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+  using PropertyHandlerMap = std::unordered_map<std::string_view, PropertyHandler>;
+
+  // Returns the property handlers of this class merged with the handlers of its base classes.
+  // A view manager that overrides UpdateProperty hides this function with its own merged map, so that
+  // UpdateProperty needs a single lookup to find the handler in the whole class hierarchy.
+  static const PropertyHandlerMap &GetPropertyHandlers();
+  bool UpdatePropertyWithHandlers(
+      const PropertyHandlerMap &handlers,
+      ShadowNodeBase *nodeToUpdate,
+      const std::string &propertyName,
+      const winrt::Microsoft::ReactNative::JSValue &propertyValue);
+
   virtual void NotifyUnimplementedProperty(
       ShadowNodeBase *nodeToUpdate,
       const std::string &propertyName,
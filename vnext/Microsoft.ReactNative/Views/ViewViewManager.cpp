@@ -385,53 +385,166 @@ void ViewViewManager::GetNativeProps(const winrt::Microsoft::ReactNative::IJSVal
   winrt::Microsoft::ReactNative::WriteProperty(writer, L"tabIndex", L"number");
 }
 
-bool ViewViewManager::UpdateProperty(
+static bool UpdateBackgroundProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto pPanel = static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel();
+  return TryUpdateBackgroundBrush(pPanel, propertyName, propertyValue);
+}
+
+static bool UpdateBorderProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto pPanel = static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel();
+  return TryUpdateBorderProperties(nodeToUpdate, pPanel, propertyName, propertyValue);
+}
+
+static bool UpdateCornerRadiusProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto pPanel = static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel();
+  if (!TryUpdateCornerRadiusOnNode(nodeToUpdate, pPanel, propertyName, propertyValue)) {
+    return false;
+  }
+
+  UpdateCornerRadiusOnElement(nodeToUpdate, pPanel);
+
+  return true;
+}
+
+static bool UpdateMouseEventProperties(
+    ViewManagerBase & /*viewManager*/,
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  return TryUpdateMouseEvents(nodeToUpdate, propertyName, propertyValue);
+}
+
+static bool UpdateOnClickProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  static_cast<ViewShadowNode *>(nodeToUpdate)->OnClick(!propertyValue.IsNull() && propertyValue.AsBoolean());
+
+  return true;
+}
+
+static bool UpdateOverflowProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto pPanel = static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    bool clipChildren = propertyValue.AsString() == "hidden";
+    pPanel.ClipChildren(clipChildren);
+  }
+
+  return true;
+}
+
+static bool UpdatePointerEventsProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto pPanel = static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel();
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
+    bool hitTestable = propertyValue.AsString() != "none";
+    pPanel.IsHitTestVisible(hitTestable);
+  }
+
+  return true;
+}
+
+static bool UpdateFocusableProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto *pViewShadowNode = static_cast<ViewShadowNode *>(nodeToUpdate);
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    pViewShadowNode->IsFocusable(propertyValue.AsBoolean());
 
-  auto pPanel = pViewShadowNode->GetViewPanel();
-  bool ret = true;
-  if (pPanel != nullptr) {
-    if (TryUpdateBackgroundBrush(pPanel, propertyName, propertyValue)) {
-    } else if (TryUpdateBorderProperties(nodeToUpdate, pPanel, propertyName, propertyValue)) {
-    } else if (TryUpdateCornerRadiusOnNode(nodeToUpdate, pPanel, propertyName, propertyValue)) {
-      UpdateCornerRadiusOnElement(nodeToUpdate, pPanel);
-    } else if (TryUpdateMouseEvents(nodeToUpdate, propertyName, propertyValue)) {
-    } else if (propertyName == "onClick") {
-      pViewShadowNode->OnClick(!propertyValue.IsNull() && propertyValue.AsBoolean());
-    } else if (propertyName == "overflow") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        bool clipChildren = propertyValue.AsString() == "hidden";
-        pPanel.ClipChildren(clipChildren);
-      }
-    } else if (propertyName == "pointerEvents") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::String) {
-        bool hitTestable = propertyValue.AsString() != "none";
-        pPanel.IsHitTestVisible(hitTestable);
-      }
-    } else if (propertyName == "focusable") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        pViewShadowNode->IsFocusable(propertyValue.AsBoolean());
-    } else if (propertyName == "enableFocusRing") {
-      if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
-        pViewShadowNode->EnableFocusRing(propertyValue.AsBoolean());
-      else if (propertyValue.IsNull())
-        pViewShadowNode->EnableFocusRing(false);
-    } else if (propertyName == "tabIndex") {
-      auto tabIndex = propertyValue.AsInt64();
-      if (tabIndex == static_cast<int32_t>(tabIndex)) {
-        pViewShadowNode->TabIndex(static_cast<int32_t>(tabIndex));
-      } else if (propertyValue.IsNull()) {
-        pViewShadowNode->TabIndex(std::numeric_limits<std::int32_t>::max());
-      }
-    } else {
-      ret = Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
-    }
+  return true;
+}
+
+static bool UpdateEnableFocusRingProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto *pViewShadowNode = static_cast<ViewShadowNode *>(nodeToUpdate);
+  if (propertyValue.Type() == winrt::Microsoft::ReactNative::JSValueType::Boolean)
+    pViewShadowNode->EnableFocusRing(propertyValue.AsBoolean());
+  else if (propertyValue.IsNull())
+    pViewShadowNode->EnableFocusRing(false);
+
+  return true;
+}
+
+static bool UpdateTabIndexProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto *pViewShadowNode = static_cast<ViewShadowNode *>(nodeToUpdate);
+  auto tabIndex = propertyValue.AsInt64();
+  if (tabIndex == static_cast<int32_t>(tabIndex)) {
+    pViewShadowNode->TabIndex(static_cast<int32_t>(tabIndex));
+  } else if (propertyValue.IsNull()) {
+    pViewShadowNode->TabIndex(std::numeric_limits<std::int32_t>::max());
   }
 
-  return ret;
+  return true;
+}
+
+bool ViewViewManager::UpdateProperty(
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  // Properties of a view without its panel are ignored.
+  if (static_cast<ViewShadowNode *>(nodeToUpdate)->GetViewPanel() == nullptr) {
+    return true;
+  }
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &ViewViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["backgroundColor"] = UpdateBackgroundProperty;
+
+    for (auto propertyName : BorderPropertyNames) {
+      result[propertyName] = UpdateBorderProperties;
+    }
+
+    for (auto propertyName : CornerRadiusPropertyNames) {
+      result[propertyName] = UpdateCornerRadiusProperties;
+    }
+
+    for (auto propertyName : MouseEventPropertyNames) {
+      result[propertyName] = UpdateMouseEventProperties;
+    }
+
+    result["onClick"] = UpdateOnClickProperty;
+    result["overflow"] = UpdateOverflowProperty;
+    result["pointerEvents"] = UpdatePointerEventsProperty;
+    result["focusable"] = UpdateFocusableProperty;
+    result["enableFocusRing"] = UpdateEnableFocusRingProperty;
+    result["tabIndex"] = UpdateTabIndexProperty;
+    return result;
+  }();
+
+  return handlers;
 }
 
 void ViewViewManager::OnPropertiesUpdated(ShadowNodeBase *node) {
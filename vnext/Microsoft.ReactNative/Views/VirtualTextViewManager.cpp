@@ -95,37 +95,107 @@ XamlView VirtualTextViewManager::CreateViewCore(int64_t /*tag*/, const winrt::Mi
   return winrt::Span();
 }
 
-bool VirtualTextViewManager::UpdateProperty(
+static bool UpdateColorProperty(
+    ViewManagerBase & /*viewManager*/,
     ShadowNodeBase *nodeToUpdate,
     const std::string &propertyName,
     const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
   auto span = nodeToUpdate->GetView().as<winrt::Span>();
-  if (span == nullptr)
-    return true;
-
   // FUTURE: In the future cppwinrt will generate code where static methods on
   // base types can be called.  For now we specify the base type explicitly
-  if (TryUpdateForeground<winrt::TextElement>(span, propertyName, propertyValue)) {
-    static_cast<VirtualTextShadowNode *>(nodeToUpdate)->m_highlightData.foregroundColor = ColorFrom(propertyValue);
-  } else if (TryUpdateFontProperties<winrt::TextElement>(span, propertyName, propertyValue)) {
-  } else if (TryUpdateCharacterSpacing<winrt::TextElement>(span, propertyName, propertyValue)) {
-  } else if (TryUpdateTextDecorationLine<winrt::TextElement>(span, propertyName, propertyValue)) {
-  } else if (propertyName == "textTransform") {
-    auto node = static_cast<VirtualTextShadowNode *>(nodeToUpdate);
-    node->textTransform = TransformableText::GetTextTransform(propertyValue);
-    VirtualTextShadowNode::ApplyTextTransform(
-        *node, node->textTransform, /* forceUpdate = */ true, /* isRoot = */ true);
-  } else if (propertyName == "backgroundColor") {
-    if (IsValidColorValue(propertyValue)) {
-      static_cast<VirtualTextShadowNode *>(nodeToUpdate)->m_highlightData.backgroundColor = ColorFrom(propertyValue);
-    }
-  } else {
-    return Super::UpdateProperty(nodeToUpdate, propertyName, propertyValue);
+  if (!TryUpdateForeground<winrt::TextElement>(span, propertyName, propertyValue)) {
+    return false;
+  }
+
+  static_cast<VirtualTextShadowNode *>(nodeToUpdate)->m_highlightData.foregroundColor = ColorFrom(propertyValue);
+
+  return true;
+}
+
+static bool UpdateFontProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto span = nodeToUpdate->GetView().as<winrt::Span>();
+  return TryUpdateFontProperties<winrt::TextElement>(span, propertyName, propertyValue);
+}
+
+static bool UpdateCharacterSpacingProperties(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto span = nodeToUpdate->GetView().as<winrt::Span>();
+  return TryUpdateCharacterSpacing<winrt::TextElement>(span, propertyName, propertyValue);
+}
+
+static bool UpdateTextDecorationLineProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto span = nodeToUpdate->GetView().as<winrt::Span>();
+  return TryUpdateTextDecorationLine<winrt::TextElement>(span, propertyName, propertyValue);
+}
+
+static bool UpdateTextTransformProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  auto node = static_cast<VirtualTextShadowNode *>(nodeToUpdate);
+  node->textTransform = TransformableText::GetTextTransform(propertyValue);
+  VirtualTextShadowNode::ApplyTextTransform(
+      *node, node->textTransform, /* forceUpdate = */ true, /* isRoot = */ true);
+
+  return true;
+}
+
+static bool UpdateBackgroundColorProperty(
+    ViewManagerBase & /*viewManager*/,
+    ShadowNodeBase *nodeToUpdate,
+    const std::string & /*propertyName*/,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (IsValidColorValue(propertyValue)) {
+    static_cast<VirtualTextShadowNode *>(nodeToUpdate)->m_highlightData.backgroundColor = ColorFrom(propertyValue);
   }
 
   return true;
 }
 
+bool VirtualTextViewManager::UpdateProperty(
+    ShadowNodeBase *nodeToUpdate,
+    const std::string &propertyName,
+    const winrt::Microsoft::ReactNative::JSValue &propertyValue) {
+  if (nodeToUpdate->GetView() == nullptr) {
+    return true;
+  }
+
+  return UpdatePropertyWithHandlers(GetPropertyHandlers(), nodeToUpdate, propertyName, propertyValue);
+}
+
+/*static*/ const ViewManagerBase::PropertyHandlerMap &VirtualTextViewManager::GetPropertyHandlers() {
+  static const PropertyHandlerMap handlers = [] {
+    PropertyHandlerMap result = Super::GetPropertyHandlers();
+    result["color"] = UpdateColorProperty;
+    for (auto propertyName : FontPropertyNames) {
+      result[propertyName] = UpdateFontProperties;
+    }
+
+    for (auto propertyName : CharacterSpacingPropertyNames) {
+      result[propertyName] = UpdateCharacterSpacingProperties;
+    }
+
+    result["textDecorationLine"] = UpdateTextDecorationLineProperty;
+    result["textTransform"] = UpdateTextTransformProperty;
+    result["backgroundColor"] = UpdateBackgroundColorProperty;
+    return result;
+  }();
+
+  return handlers;
+}
+
 void VirtualTextViewManager::AddView(const XamlView &parent, const XamlView &child, int64_t index) {
   auto span(parent.as<winrt::Span>());
   auto childInline(child.as<winrt::Inline>());
@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "YogaMeasureCache.h"
+
+#include <functional>
+
+namespace Microsoft::ReactNative {
+
+bool YogaMeasureCacheKey::operator==(const YogaMeasureCacheKey &other) const noexcept {
+  return contentHash == other.contentHash && styleHash == other.styleHash &&
+      rasterizationScale == other.rasterizationScale && width == other.width && height == other.height &&
+      widthMode == other.widthMode && heightMode == other.heightMode;
+}
+
+YogaMeasureCacheKey MakeYogaMeasureCacheKey(
+    uint64_t contentHash,
+    uint64_t styleHash,
+    float rasterizationScale,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) noexcept {
+  // Yoga passes NaN for the undefined sizes, which never compares equal.
+  return YogaMeasureCacheKey{
+      contentHash,
+      styleHash,
+      rasterizationScale,
+      widthMode == YGMeasureModeUndefined ? 0.0f : width,
+      heightMode == YGMeasureModeUndefined ? 0.0f : height,
+      widthMode,
+      heightMode};
+}
+
+size_t YogaMeasureCache::KeyHash::operator()(const YogaMeasureCacheKey &key) const noexcept {
+  // The content and style hashes are already well distributed. Mix in the constraints.
+  size_t hash = static_cast<size_t>(key.contentHash ^ (key.styleHash * 31));
+  auto combine = [&hash](size_t value) noexcept { hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+  combine(std::hash<float>{}(key.rasterizationScale));
+  combine(std::hash<float>{}(key.width));
+  combine(std::hash<float>{}(key.height));
+  combine(static_cast<size_t>(key.widthMode));
+  combine(static_cast<size_t>(key.heightMode));
+  return hash;
+}
+
+YogaMeasureCache::YogaMeasureCache(size_t capacity) noexcept : m_capacity(capacity) {}
+
+/*static*/ YogaMeasureCache &YogaMeasureCache::Instance() noexcept {
+  static YogaMeasureCache instance;
+  return instance;
+}
+
+std::optional<YGSize> YogaMeasureCache::Find(const YogaMeasureCacheKey &key) noexcept {
+  std::scoped_lock lock{m_mutex};
+  auto it = m_index.find(key);
+  if (it == m_index.end()) {
+    ++m_counters.Misses;
+    return std::nullopt;
+  }
+
+  ++m_counters.Hits;
+  m_entries.splice(m_entries.begin(), m_entries, it->second);
+  return it->second->second;
+}
+
+void YogaMeasureCache::Insert(const YogaMeasureCacheKey &key, YGSize size) noexcept {
+  if (m_capacity == 0) {
+    return;
+  }
+
+  std::scoped_lock lock{m_mutex};
+  auto it = m_index.find(key);
+  if (it != m_index.end()) {
+    it->second->second = size;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return;
+  }
+
+  if (m_entries.size() == m_capacity) {
+    m_index.erase(m_entries.back().first);
+    m_entries.pop_back();
+  }
+
+  m_entries.emplace_front(key, size);
+  m_index.emplace(key, m_entries.begin());
+}
+
+void YogaMeasureCache::Clear() noexcept {
+  std::scoped_lock lock{m_mutex};
+  m_index.clear();
+  m_entries.clear();
+}
+
+YogaMeasureCacheCounters YogaMeasureCache::GetCounters() const noexcept {
+  std::scoped_lock lock{m_mutex};
+  return m_counters;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <yoga/yoga.h>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace Microsoft::ReactNative {
+
+struct YogaMeasureCacheKey {
+  uint64_t contentHash;
+  uint64_t styleHash;
+  float rasterizationScale; // Layout rounding makes the size depend on the XamlRoot scale
+  float width;
+  float height;
+  YGMeasureMode widthMode;
+  YGMeasureMode heightMode;
+
+  bool operator==(const YogaMeasureCacheKey &other) const noexcept;
+};
+
+struct YogaMeasureCacheCounters {
+  uint64_t Hits;
+  uint64_t Misses;
+};
+
+// Creates a cache key for the measure constraints. Sizes of undefined measure modes are ignored.
+YogaMeasureCacheKey MakeYogaMeasureCacheKey(
+    uint64_t contentHash,
+    uint64_t styleHash,
+    float rasterizationScale,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) noexcept;
+
+// Process-wide LRU cache of the sizes returned by the self-measure functions.
+// Unlike the Yoga per-node measure cache, it is shared between nodes with the same content and style,
+// such as repeated list cells, and survives recreation of the nodes.
+class YogaMeasureCache {
+ public:
+  static constexpr size_t DefaultCapacity = 4096;
+
+  explicit YogaMeasureCache(size_t capacity = DefaultCapacity) noexcept;
+  YogaMeasureCache(const YogaMeasureCache &) = delete;
+  YogaMeasureCache &operator=(const YogaMeasureCache &) = delete;
+
+  static YogaMeasureCache &Instance() noexcept;
+
+  std::optional<YGSize> Find(const YogaMeasureCacheKey &key) noexcept;
+  void Insert(const YogaMeasureCacheKey &key, YGSize size) noexcept;
+  void Clear() noexcept;
+
+  YogaMeasureCacheCounters GetCounters() const noexcept;
+
+ private:
+  struct KeyHash {
+    size_t operator()(const YogaMeasureCacheKey &key) const noexcept;
+  };
+
+  using Entry = std::pair<YogaMeasureCacheKey, YGSize>;
+
+  mutable std::mutex m_mutex;
+  const size_t m_capacity;
+  std::list<Entry> m_entries; // The most recently used entries first
+  std::unordered_map<YogaMeasureCacheKey, std::list<Entry>::iterator, KeyHash> m_index;
+  YogaMeasureCacheCounters m_counters{};
+};
+
+} // namespace Microsoft::ReactNative
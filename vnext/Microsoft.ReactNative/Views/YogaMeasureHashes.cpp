@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "YogaMeasureHashes.h"
+
+#include <UI.Xaml.Controls.h>
+#include <UI.Xaml.Documents.h>
+#include <winrt/Windows.UI.ViewManagement.h>
+#include <type_traits>
+
+namespace winrt {
+using namespace xaml::Controls;
+using namespace xaml::Documents;
+} // namespace winrt
+
+namespace Microsoft::ReactNative {
+
+namespace {
+
+// FNV-1a
+class Hasher {
+ public:
+  void AddBytes(const void *data, size_t size) noexcept {
+    auto bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+      m_value = (m_value ^ bytes[i]) * 1099511628211ull;
+    }
+  }
+
+  template <class T>
+  void Add(const T &value) noexcept {
+    static_assert(std::is_trivially_copyable_v<T>);
+    AddBytes(&value, sizeof(T));
+  }
+
+  void Add(const winrt::hstring &value) noexcept {
+    Add(value.size());
+    AddBytes(value.data(), value.size() * sizeof(wchar_t));
+  }
+
+  void Add(const xaml::Thickness &value) noexcept {
+    Add(value.Left);
+    Add(value.Top);
+    Add(value.Right);
+    Add(value.Bottom);
+  }
+
+  uint64_t Value() const noexcept {
+    return m_value;
+  }
+
+ private:
+  uint64_t m_value{14695981039346656037ull};
+};
+
+void HashFont(const winrt::TextElement &element, Hasher &styleHasher) {
+  styleHasher.Add(element.FontSize());
+  styleHasher.Add(element.FontFamily().Source());
+  styleHasher.Add(element.FontWeight().Weight);
+  styleHasher.Add(element.FontStyle());
+  styleHasher.Add(element.FontStretch());
+  styleHasher.Add(element.CharacterSpacing());
+}
+
+bool TryHashInlines(const winrt::InlineCollection &inlines, Hasher &contentHasher, Hasher &styleHasher) {
+  contentHasher.Add(inlines.Size());
+  for (const auto &inl : inlines) {
+    if (auto run = inl.try_as<winrt::Run>()) {
+      contentHasher.Add('R');
+      contentHasher.Add(run.Text());
+      HashFont(run, styleHasher);
+    } else if (auto span = inl.try_as<winrt::Span>()) {
+      contentHasher.Add('S');
+      HashFont(span, styleHasher);
+      if (!TryHashInlines(span.Inlines(), contentHasher, styleHasher)) {
+        return false;
+      }
+    } else if (inl.try_as<winrt::LineBreak>()) {
+      contentHasher.Add('L');
+    } else {
+      // Inline UI containers are measured by their child elements.
+      return false;
+    }
+  }
+
+  return true;
+}
+
+double GetTextScaleFactor() {
+  static const winrt::Windows::UI::ViewManagement::UISettings uiSettings;
+  return uiSettings.TextScaleFactor();
+}
+
+} // namespace
+
+bool TryGetYogaMeasureHashes(const xaml::UIElement &element, uint64_t &contentHash, uint64_t &styleHash) {
+  auto textBlock = element.try_as<winrt::TextBlock>();
+  if (!textBlock) {
+    return false;
+  }
+
+  Hasher contentHasher;
+  Hasher styleHasher;
+  if (!TryHashInlines(textBlock.Inlines(), contentHasher, styleHasher)) {
+    return false;
+  }
+
+  styleHasher.Add(textBlock.FontSize());
+  styleHasher.Add(textBlock.FontFamily().Source());
+  styleHasher.Add(textBlock.FontWeight().Weight);
+  styleHasher.Add(textBlock.FontStyle());
+  styleHasher.Add(textBlock.FontStretch());
+  styleHasher.Add(textBlock.CharacterSpacing());
+  styleHasher.Add(textBlock.TextWrapping());
+  styleHasher.Add(textBlock.TextTrimming());
+  styleHasher.Add(textBlock.TextLineBounds());
+  styleHasher.Add(textBlock.OpticalMarginAlignment());
+  styleHasher.Add(textBlock.MaxLines());
+  styleHasher.Add(textBlock.LineHeight());
+  styleHasher.Add(textBlock.LineStackingStrategy());
+  styleHasher.Add(textBlock.Padding());
+  styleHasher.Add(textBlock.Margin());
+  styleHasher.Add(textBlock.MinWidth());
+  styleHasher.Add(textBlock.MaxWidth());
+  styleHasher.Add(textBlock.MinHeight());
+  styleHasher.Add(textBlock.MaxHeight());
+  styleHasher.Add(textBlock.Visibility());
+  styleHasher.Add(textBlock.IsTextScaleFactorEnabled() ? GetTextScaleFactor() : 1.0);
+
+  contentHash = contentHasher.Value();
+  styleHash = styleHasher.Value();
+  return true;
+}
+
+float GetYogaMeasureRasterizationScale(const xaml::UIElement &element) {
+  if (auto uiElement10 = element.try_as<xaml::IUIElement10>()) {
+    if (auto xamlRoot = uiElement10.XamlRoot()) {
+      return static_cast<float>(xamlRoot.RasterizationScale());
+    }
+  }
+
+  return 1.0f;
+}
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,19 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <XamlView.h>
+#include <cstdint>
+
+namespace Microsoft::ReactNative {
+
+// Computes the hashes of the content and of the properties that affect the desired size of the element.
+// Returns false if the element size cannot be derived from them. Only TextBlocks with Run, Span and LineBreak
+// inlines are supported.
+bool TryGetYogaMeasureHashes(const xaml::UIElement &element, uint64_t &contentHash, uint64_t &styleHash);
+
+// Returns the rasterization scale of the element's XamlRoot, or 1 if the element is not in a XamlRoot.
+float GetYogaMeasureRasterizationScale(const xaml::UIElement &element);
+
+} // namespace Microsoft::ReactNative
@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/TestCheck.h"
+#include "motifCpp/libletawarememleakdetection.h"
+
+using namespace std::chrono_literals;
+
+namespace Mso::Async::Test {
+
+TEST_CLASS_EX (DispatchQueueTest, LibletAwareMemLeakDetection) {
+  // MemoryLeakDetectionHook::TrackPerTest m_trackLeakPerTest;
+
+  TEST_METHOD(DispatchQueue_Post_ManyProducers) {
+    constexpr int32_t producerCount = 8;
+    constexpr int32_t taskCount = 1000;
+    auto queue = DispatchQueue::MakeSerialQueue();
+    std::vector<int32_t> lastValues(producerCount, -1);
+    std::atomic<int32_t> outOfOrderCount{0};
+
+    std::vector<std::thread> producers;
+    for (int32_t producer = 0; producer < producerCount; ++producer) {
+      producers.emplace_back([&queue, &lastValues, &outOfOrderCount, producer]() noexcept {
+        for (int32_t i = 0; i < taskCount; ++i) {
+          queue.Post([&lastValues, &outOfOrderCount, producer, i]() noexcept {
+            // Tasks posted by the same thread must run in the order they were posted.
+            if (lastValues[producer] != i - 1) {
+              ++outOfOrderCount;
+            }
+
+            lastValues[producer] = i;
+          });
+        }
+      });
+    }
+
+    for (auto &producer : producers) {
+      producer.join();
+    }
+
+    queue.AwaitTermination();
+    TestCheckEqual(0, outOfOrderCount.load());
+    for (int32_t producer = 0; producer < producerCount; ++producer) {
+      TestCheckEqual(taskCount - 1, lastValues[producer]);
+    }
+  }
+
+  TEST_METHOD(DispatchQueue_Post_AfterShutdownIsCanceled) {
+    auto queue = DispatchQueue::MakeSerialQueue();
+    queue.Shutdown(PendingTaskAction::Cancel);
+
+    bool isInvoked{false};
+    bool isCanceled{false};
+    queue.Post(Mso::MakeDispatchTask(
+        [&isInvoked]() noexcept { isInvoked = true; }, [&isCanceled]() noexcept { isCanceled = true; }));
+
+    queue.AwaitTermination();
+    TestCheck(!isInvoked);
+    TestCheck(isCanceled);
+  }
+
+  TEST_METHOD(DispatchQueue_Post_ConcurrentWithShutdownIsInvokedOrCanceled) {
+    // Each task posted while the queue shuts down must be either invoked or canceled.
+    constexpr int32_t iterationCount = 100;
+    constexpr int32_t taskCount = 100;
+    for (int32_t iteration = 0; iteration < iterationCount; ++iteration) {
+      auto queue = DispatchQueue::MakeSerialQueue();
+      std::atomic<int32_t> invokeCount{0};
+      std::atomic<int32_t> cancelCount{0};
+
+      std::thread producer{[&queue, &invokeCount, &cancelCount]() noexcept {
+        for (int32_t i = 0; i < taskCount; ++i) {
+          queue.Post(Mso::MakeDispatchTask(
+              [&invokeCount]() noexcept { ++invokeCount; }, [&cancelCount]() noexcept { ++cancelCount; }));
+        }
+      }};
+
+      queue.Shutdown(iteration % 2 == 0 ? PendingTaskAction::Cancel : PendingTaskAction::Complete);
+      producer.join();
+      queue.AwaitTermination();
+      TestCheckEqual(taskCount, invokeCount.load() + cancelCount.load());
+    }
+  }
+
+  TEST_METHOD(DispatchQueue_PostDelayed_RunsAfterDelay) {
+    auto queue = DispatchQueue::MakeSerialQueue();
+    ManualResetEvent done;
+    auto startTime = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point invokeTime;
+    queue.PostDelayed(20ms, [&invokeTime, done]() noexcept {
+      invokeTime = std::chrono::steady_clock::now();
+      done.Set();
+    });
+
+    TestCheck(done.WaitFor(10s));
+    TestCheck(invokeTime - startTime >= 20ms);
+  }
+
+  TEST_METHOD(DispatchQueue_PostAt_RunsInDueTimeOrder) {
+    constexpr int32_t taskCount = 2000;
+    auto queue = DispatchQueue::MakeSerialQueue();
+
+    // All tasks must be scheduled before the first one is due. Otherwise, a late PostAt call could post
+    // its task after tasks with later due times.
+    auto startTime = std::chrono::steady_clock::now() + 200ms;
+    std::vector<std::chrono::milliseconds> invokedDelays;
+    std::atomic<int32_t> earlyCount{0};
+    ManualResetEvent done;
+
+    // The delays span several rounds of the first timer wheel level.
+    for (int32_t i = 0; i < taskCount; ++i) {
+      auto delay = std::chrono::milliseconds((i * 7919) % 600);
+      queue.PostAt(startTime + delay, [&, delay]() noexcept {
+        if (std::chrono::steady_clock::now() - startTime < delay) {
+          ++earlyCount;
+        }
+
+        invokedDelays.push_back(delay);
+        if (invokedDelays.size() == taskCount) {
+          done.Set();
+        }
+      });
+    }
+
+    TestCheck(done.WaitFor(10s));
+    TestCheckEqual(0, earlyCount.load());
+    TestCheck(std::is_sorted(invokedDelays.begin(), invokedDelays.end()));
+  }
+
+  TEST_METHOD(DispatchQueue_PostDelayed_SparseTasks) {
+    // A far timer keeps the wheel busy while it skips the empty ticks between the sparse tasks.
+    auto queue = DispatchQueue::MakeSerialQueue();
+    auto farTimer = queue.PostDelayed(1h, []() noexcept {});
+
+    const std::chrono::milliseconds delays[] = {5ms, 300ms, 1100ms};
+    auto startTime = std::chrono::steady_clock::now();
+    std::vector<std::chrono::milliseconds> invokedDelays;
+    std::atomic<int32_t> earlyCount{0};
+    ManualResetEvent done;
+    for (auto delay : delays) {
+      queue.PostAt(startTime + delay, [&, delay]() noexcept {
+        if (std::chrono::steady_clock::now() - startTime < delay) {
+          ++earlyCount;
+        }
+
+        invokedDelays.push_back(delay);
+        if (invokedDelays.size() == std::size(delays)) {
+          done.Set();
+        }
+      });
+    }
+
+    TestCheck(done.WaitFor(10s));
+    TestCheckEqual(0, earlyCount.load());
+    TestCheck(std::equal(invokedDelays.begin(), invokedDelays.end(), std::begin(delays), std::end(delays)));
+    TestCheck(farTimer.Cancel());
+  }
+
+  TEST_METHOD(DispatchQueue_PostDelayed_Cancel) {
+    auto queue = DispatchQueue::MakeSerialQueue();
+    bool isInvoked{false};
+    bool isCanceled{false};
+    auto timer = queue.PostDelayed(
+        1h,
+        Mso::MakeDispatchTask(
+            [&isInvoked]() noexcept { isInvoked = true; }, [&isCanceled]() noexcept { isCanceled = true; }));
+
+    TestCheck(timer.Cancel());
+    TestCheck(isCanceled);
+    TestCheck(!timer.Cancel());
+
+    queue.AwaitTermination();
+    TestCheck(!isInvoked);
+  }
+
+  TEST_METHOD(DispatchQueue_PostDelayed_CanceledOnShutdown) {
+    auto queue = DispatchQueue::MakeSerialQueue();
+    bool isInvoked{false};
+    bool isCanceled{false};
+    auto timer = queue.PostDelayed(
+        1h,
+        Mso::MakeDispatchTask(
+            [&isInvoked]() noexcept { isInvoked = true; }, [&isCanceled]() noexcept { isCanceled = true; }));
+
+    queue.Shutdown(PendingTaskAction::Complete);
+    TestCheck(isCanceled);
+    TestCheck(!timer.Cancel());
+
+    queue.AwaitTermination();
+    TestCheck(!isInvoked);
+  }
+
+  TEST_METHOD(DispatchQueue_TaskBatching_Nested) {
+    auto queue = DispatchQueue::MakeSerialQueue();
+    std::vector<int32_t> values;
+    {
+      auto outerBatch = queue.StartTaskBatching();
+      queue.Post([&values]() noexcept { values.push_back(1); });
+      {
+        // The nested batch is posted into the enclosing batch when it ends.
+        auto innerBatch = queue.StartTaskBatching();
+        queue.Post([&values]() noexcept { values.push_back(2); });
+      }
+
+      // Tasks posted after the nested batch ends must still go to the enclosing batch.
+      queue.Post([&values]() noexcept { values.push_back(3); });
+
+      // Nothing runs until the enclosing batch is posted.
+      std::this_thread::sleep_for(10ms);
+      TestCheck(values.empty());
+    }
+
+    queue.AwaitTermination();
+    TestCheckEqual(3u, values.size());
+    for (int32_t i = 0; i < 3; ++i) {
+      TestCheckEqual(i + 1, values[i]);
+    }
+  }
+};
+
+} // namespace Mso::Async::Test
@@ -0,0 +1,163 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "dispatchQueue/dispatchQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "motifCpp/TestCheck.h"
+#include "motifCpp/libletawarememleakdetection.h"
+
+using namespace std::chrono_literals;
+
+namespace Mso::Async::Test {
+
+// Posts two tasks per level until depth reaches zero. The last completed leaf sets the done event.
+static void PostFanOut(
+    Mso::DispatchQueue const &queue,
+    int32_t depth,
+    std::atomic<int32_t> &leafCount,
+    std::atomic<int32_t> &pendingCount,
+    Mso::ManualResetEvent const &done) noexcept {
+  if (depth > 0) {
+    pendingCount += 2;
+    for (int32_t i = 0; i < 2; ++i) {
+      queue.Post([&queue, depth, &leafCount, &pendingCount, done]() noexcept {
+        PostFanOut(queue, depth - 1, leafCount, pendingCount, done);
+      });
+    }
+  } else {
+    ++leafCount;
+  }
+
+  if (--pendingCount == 0) {
+    done.Set();
+  }
+}
+
+TEST_CLASS_EX (ThreadPoolSchedulerTest, LibletAwareMemLeakDetection) {
+  // MemoryLeakDetectionHook::TrackPerTest m_trackLeakPerTest;
+
+  TEST_METHOD(ThreadPoolScheduler_ConcurrentQueue_RunsAllTasks) {
+    constexpr int32_t taskCount = 10000;
+    std::atomic<int32_t> value{0};
+    ManualResetEvent done;
+    for (int32_t i = 0; i < taskCount; ++i) {
+      DispatchQueue::ConcurrentQueue().Post([&value, done]() noexcept {
+        if (++value == taskCount) {
+          done.Set();
+        }
+      });
+    }
+
+    TestCheck(done.WaitFor(10s));
+    TestCheckEqual(taskCount, value.load());
+  }
+
+  TEST_METHOD(ThreadPoolScheduler_MaxThreads) {
+    for (uint32_t maxThreads : {2u, 3u}) {
+      auto queue = DispatchQueue::MakeConcurrentQueue(maxThreads);
+      std::atomic<int32_t> runningCount{0};
+      std::atomic<int32_t> maxRunningCount{0};
+      for (int32_t i = 0; i < 200; ++i) {
+        queue.Post([&runningCount, &maxRunningCount]() noexcept {
+          int32_t running = ++runningCount;
+          int32_t maxRunning = maxRunningCount.load();
+          while (running > maxRunning && !maxRunningCount.compare_exchange_weak(maxRunning, running)) {
+          }
+
+          std::this_thread::sleep_for(100us);
+          --runningCount;
+        });
+      }
+
+      queue.AwaitTermination();
+      TestCheck(maxRunningCount.load() <= static_cast<int32_t>(maxThreads));
+    }
+  }
+
+  TEST_METHOD(ThreadPoolScheduler_SerialQueue_KeepsOrder) {
+    auto queue = DispatchQueue::MakeSerialQueue();
+    std::vector<int32_t> values;
+    for (int32_t i = 0; i < 1000; ++i) {
+      queue.Post([&values, i]() noexcept { values.push_back(i); });
+    }
+
+    queue.AwaitTermination();
+    TestCheckEqual(1000u, values.size());
+    for (int32_t i = 0; i < 1000; ++i) {
+      TestCheckEqual(i, values[i]);
+    }
+  }
+
+  TEST_METHOD(ThreadPoolScheduler_AwaitTermination_FromOtherQueue) {
+    auto serialQueue = DispatchQueue::MakeSerialQueue();
+    auto concurrentQueue = DispatchQueue::MakeConcurrentQueue(0);
+    std::atomic<int32_t> value{0};
+    int32_t valueAfterAwait{0};
+    ManualResetEvent done;
+    serialQueue.Post([&]() noexcept {
+      for (int32_t i = 0; i < 100; ++i) {
+        concurrentQueue.Post([&value]() noexcept { ++value; });
+      }
+
+      concurrentQueue.AwaitTermination();
+      valueAfterAwait = value.load();
+      done.Set();
+    });
+
+    TestCheck(done.WaitFor(10s));
+    TestCheckEqual(100, valueAfterAwait);
+  }
+
+  TEST_METHOD(ThreadPoolScheduler_QueueReleasedByOwnTask) {
+    ManualResetEvent done;
+    auto queue = DispatchQueue::MakeSerialQueue();
+    queue.Post([queueCopy = queue, done]() mutable noexcept {
+      // It releases the last queue reference while the task is running.
+      queueCopy = nullptr;
+      done.Set();
+    });
+    queue = nullptr;
+
+    TestCheck(done.WaitFor(10s));
+  }
+
+  TEST_METHOD(ThreadPoolScheduler_FanOutFanIn) {
+    auto queue = DispatchQueue::MakeConcurrentQueue(0);
+    std::atomic<int32_t> leafCount{0};
+    std::atomic<int32_t> pendingCount{1};
+    ManualResetEvent done;
+    queue.Post([&]() noexcept { PostFanOut(queue, 12, leafCount, pendingCount, done); });
+
+    TestCheck(done.WaitFor(10s));
+    TestCheckEqual(1 << 12, leafCount.load());
+  }
+
+  TEST_METHOD(ThreadPoolScheduler_AllWorkersBlocked) {
+    // Block more tasks than there are worker threads. They are released by a task posted after them,
+    // which can only run if the thread pool adds a thread while all its workers are blocked.
+    const uint32_t blockedCount = (std::min)((std::max)(std::thread::hardware_concurrency(), 4u) + 2, 60u);
+    auto queue = DispatchQueue::MakeConcurrentQueue(blockedCount + 1);
+    std::atomic<uint32_t> releasedCount{0};
+    ManualResetEvent release;
+    ManualResetEvent done;
+    for (uint32_t i = 0; i < blockedCount; ++i) {
+      queue.Post([&releasedCount, blockedCount, release, done]() noexcept {
+        if (release.WaitFor(20s) && ++releasedCount == blockedCount) {
+          done.Set();
+        }
+      });
+    }
+
+    queue.Post([release]() noexcept { release.Set(); });
+
+    TestCheck(done.WaitFor(20s));
+    TestCheckEqual(blockedCount, releasedCount.load());
+    queue.AwaitTermination();
+  }
+};
+
+} // namespace Mso::Async::Test
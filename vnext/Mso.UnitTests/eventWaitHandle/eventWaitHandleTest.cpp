@@ -4,6 +4,7 @@
 #include "eventWaitHandle/eventWaitHandle.h"
 #include <atomic>
 #include <thread>
+#include <vector>
 #include "compilerAdapters/cppMacrosDebug.h"
 #include "motifCpp/TestCheck.h"
 #include "motifCpp/libletawarememleakdetection.h"
@@ -357,6 +358,77 @@ TEST_CLASS_EX (EventWaitHandleTest, LibletAwareMemLeakDetection) {
     TestCheckEqual(1, value.load());
   }
 
+  TEST_METHOD(AutoResetEvent_PingPong) {
+    // Two threads take turns signaling each other. A lost wake-up would hang the test.
+    constexpr int32_t roundCount = 10000;
+    AutoResetEvent ping;
+    AutoResetEvent pong;
+    int32_t value{0};
+
+    std::thread th;
+    {
+      // Debug(Mso::Memory::AutoIgnoreLeakScope ignore);
+      th = std::thread([ping, pong, &value]() noexcept {
+        for (int32_t i = 0; i < roundCount; ++i) {
+          ping.Wait();
+          ++value;
+          pong.Set();
+        }
+      });
+    }
+
+    for (int32_t i = 0; i < roundCount; ++i) {
+      ping.Set();
+      pong.Wait();
+      TestCheckEqual(i + 1, value);
+    }
+
+    th.join();
+  }
+
+  TEST_METHOD(AutoResetEvent_ReleasesOneWaiterPerSet) {
+    constexpr int32_t threadCount = 4;
+    constexpr int32_t setCount = 1000;
+    AutoResetEvent ev;
+    AutoResetEvent released;
+    std::atomic<int32_t> value{0};
+
+    std::vector<std::thread> threads;
+    {
+      // Debug(Mso::Memory::AutoIgnoreLeakScope ignore);
+      for (int32_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([ev, released, &value]() noexcept {
+          for (;;) {
+            ev.Wait();
+            if (++value > setCount) {
+              break;
+            }
+
+            released.Set();
+          }
+        });
+      }
+    }
+
+    for (int32_t i = 0; i < setCount; ++i) {
+      ev.Set();
+      released.Wait();
+      TestCheckEqual(i + 1, value.load());
+    }
+
+    // Let all threads exit.
+    for (int32_t i = 0; i < threadCount; ++i) {
+      ev.Set();
+      while (value.load() <= setCount + i) {
+        std::this_thread::yield();
+      }
+    }
+
+    for (auto &th : threads) {
+      th.join();
+    }
+  }
+
   TESTMETHOD_REQUIRES_SEH(AutoResetEvent_WaitFor_CrashForOverflow) {
     TEST_DISABLE_MEMORY_LEAK_DETECTION();
     AutoResetEvent ev;
@@ -79,6 +79,74 @@ TEST_CLASS_EX (ExecutorTest, LibletAwareMemLeakDetection) {
     Mso::FutureWait(future);
     TestCheckEqual(5, value);
   }
+
+  TEST_METHOD(InlineIfReady_InvokesReadyContinuationInline) {
+    auto countersBefore = Mso::Executors::GetInlineIfReadyCounters();
+    int value = 0;
+    auto future = Mso::MakeCompletedFuture(5).Then<Mso::Executors::InlineIfReady<>>(
+        [&](int result) noexcept { value = result; });
+
+    TestCheckEqual(5, value);
+    TestCheck(Mso::GetIFuture(future)->IsSucceeded());
+    TestCheckEqual(countersBefore.InvokedInline + 1, Mso::Executors::GetInlineIfReadyCounters().InvokedInline);
+  }
+
+  TEST_METHOD(InlineIfReady_PostsPendingContinuation) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto countersBefore = Mso::Executors::GetInlineIfReadyCounters();
+    Mso::Promise<int> promise;
+    auto future = promise.AsFuture().Then(
+        Mso::Executors::InlineIfReady<Mso::Executors::Executor>{queue},
+        [&](int result) noexcept { return queue.HasThreadAccess() ? result : 0; });
+
+    promise.SetValue(5);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(future));
+    TestCheckEqual(countersBefore.Posted + 1, Mso::Executors::GetInlineIfReadyCounters().Posted);
+  }
+
+  TEST_METHOD(InlineIfReady_PostsContinuationOfPromiseSetInline) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    Mso::Promise<int> promise;
+    auto pending = promise.AsFuture().Then(
+        Mso::Executors::InlineIfReady<Mso::Executors::Executor>{queue},
+        [&](int result) noexcept { return queue.HasThreadAccess() ? result : 0; });
+
+    // The promise is completed by an inline continuation, but its own continuation is not ready at Then call.
+    auto future = Mso::MakeSucceededFuture().Then<Mso::Executors::InlineIfReady<>>(
+        [&]() noexcept { promise.SetValue(5); });
+
+    Mso::FutureWait(future);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(pending));
+  }
+
+  TEST_METHOD(InlineIfReady_LimitsInlineDepth) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    constexpr int chainLength = 100;
+    int depth = 0;
+    int maxDepth = 0;
+    int count = 0;
+    Mso::Promise<void> finished;
+    Mso::Functor<void()> step;
+    step = [&]() noexcept {
+      ++depth;
+      maxDepth = (std::max)(maxDepth, depth);
+      if (++count < chainLength) {
+        Mso::MakeSucceededFuture().Then(
+            Mso::Executors::InlineIfReady<Mso::Executors::Executor>{queue}, [&]() noexcept { step(); });
+      } else {
+        finished.SetValue();
+      }
+      --depth;
+    };
+
+    queue.Post([&]() noexcept { step(); });
+    Mso::FutureWait(finished.AsFuture());
+    queue.AwaitTermination();
+
+    TestCheckEqual(chainLength, count);
+    TestCheck(maxDepth > 1);
+    TestCheck(maxDepth <= 17);
+  }
 };
 
 } // namespace FutureTests
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "future/futureCoroutine.h"
+#include "future/futureWait.h"
+#include "motifCpp/libletAwareMemLeakDetection.h"
+#include "testCheck.h"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+namespace FutureTests {
+
+//! Sets the flag in destructor to verify that a coroutine frame is destroyed.
+struct FrameDestroyFlag {
+  FrameDestroyFlag(bool &isDestroyed) noexcept : m_isDestroyed{isDestroyed} {}
+
+  ~FrameDestroyFlag() noexcept {
+    m_isDestroyed = true;
+  }
+
+ private:
+  bool &m_isDestroyed;
+};
+
+TEST_CLASS_EX (FutureCoroutineTest, LibletAwareMemLeakDetection) {
+  // MemoryLeakDetectionHook::TrackPerTest m_trackLeakPerTest;
+
+  TEST_METHOD(Task_ReturnsValue) {
+    auto makeTask = []() -> Mso::Task<int> { co_return 5; };
+
+    Mso::Future<int> future = makeTask();
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(future));
+  }
+
+  TEST_METHOD(Task_ReturnsVoid) {
+    bool isInvoked = false;
+    auto makeTask = [&isInvoked]() -> Mso::Task<void> {
+      isInvoked = true;
+      co_return;
+    };
+
+    Mso::Future<void> future = makeTask();
+    TestCheck(Mso::FutureWaitIsSucceeded(future));
+    TestCheck(isInvoked);
+  }
+
+  TEST_METHOD(Task_ReturnsError) {
+    auto makeTask = []() -> Mso::Task<int> {
+      co_return Mso::Maybe<int>{Mso::CancellationErrorProvider().MakeErrorCode(true)};
+    };
+
+    Mso::Future<int> future = makeTask();
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(future)));
+  }
+
+  TEST_METHOD(Task_AwaitsCompletedFuture) {
+    auto makeTask = []() -> Mso::Task<int> {
+      int value = co_await Mso::MakeCompletedFuture(3);
+      co_return value + 1;
+    };
+
+    Mso::Future<int> future = makeTask();
+    TestCheckEqual(4, Mso::FutureWaitAndGetValue(future));
+  }
+
+  TEST_METHOD(Task_AwaitsPendingFuture) {
+    Mso::Promise<int> promise;
+    auto makeTask = [&promise]() -> Mso::Task<int> {
+      int value = co_await promise.AsFuture();
+      co_return value * 3;
+    };
+
+    Mso::Future<int> future = makeTask();
+    TestCheck(!Mso::GetIFuture(future)->IsDone());
+
+    promise.SetValue(5);
+    TestCheckEqual(15, Mso::FutureWaitAndGetValue(future));
+  }
+
+  TEST_METHOD(Task_AlignsFrame) {
+    struct alignas(16) AlignedValue {
+      float Values[4];
+    };
+
+    Mso::Promise<int> promise;
+    uintptr_t valueAddress{0};
+    auto makeTask = [&promise, &valueAddress]() -> Mso::Task<int> {
+      // The value lives across the suspension point and is stored in the coroutine frame.
+      AlignedValue value{{1, 2, 3, 4}};
+      int result = co_await promise.AsFuture();
+      valueAddress = reinterpret_cast<uintptr_t>(&value);
+      co_return result + static_cast<int>(value.Values[3]);
+    };
+
+    Mso::Future<int> future = makeTask();
+    promise.SetValue(1);
+    TestCheckEqual(5, Mso::FutureWaitAndGetValue(future));
+    TestCheck(valueAddress != 0);
+    TestCheck(valueAddress % alignof(AlignedValue) == 0);
+  }
+
+  TEST_METHOD(Task_AwaitsTask) {
+    Mso::Promise<int> promise;
+    auto makeInnerTask = [&promise]() -> Mso::Task<int> { co_return co_await promise.AsFuture() + 1; };
+    auto makeOuterTask = [&makeInnerTask]() -> Mso::Task<int> { co_return co_await makeInnerTask() * 2; };
+
+    Mso::Future<int> future = makeOuterTask();
+    promise.SetValue(4);
+    TestCheckEqual(10, Mso::FutureWaitAndGetValue(future));
+  }
+
+  TEST_METHOD(Task_PropagatesAwaitedError) {
+    Mso::Promise<int> promise;
+    bool isResumed = false;
+    bool isFrameDestroyed = false;
+    auto makeTask = [&]() -> Mso::Task<int> {
+      FrameDestroyFlag destroyFlag{isFrameDestroyed};
+      int value = co_await promise.AsFuture();
+      isResumed = true;
+      co_return value;
+    };
+
+    Mso::Future<int> future = makeTask();
+    promise.SetError(Mso::CancellationErrorProvider().MakeErrorCode(true));
+
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(future)));
+    TestCheck(!isResumed);
+    TestCheck(isFrameDestroyed);
+  }
+
+  TEST_METHOD(Task_ResumeOn) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto makeTask = [&queue]() -> Mso::Task<bool> {
+      const bool hadThreadAccess = queue.HasThreadAccess();
+      co_await Mso::ResumeOn(queue);
+      co_return !hadThreadAccess && queue.HasThreadAccess();
+    };
+
+    Mso::Future<bool> future = makeTask();
+    TestCheck(Mso::FutureWaitAndGetValue(future));
+  }
+
+  TEST_METHOD(Task_ResumeOn_CanceledOnShutdown) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    queue.Shutdown(Mso::PendingTaskAction::Cancel);
+
+    bool isResumed = false;
+    bool isFrameDestroyed = false;
+    auto makeTask = [&]() -> Mso::Task<void> {
+      FrameDestroyFlag destroyFlag{isFrameDestroyed};
+      co_await Mso::ResumeOn(queue);
+      isResumed = true;
+    };
+
+    Mso::Future<void> future = makeTask();
+    TestCheck(Mso::CancellationErrorProvider().IsOwnedErrorCode(Mso::FutureWaitAndGetError(future)));
+    TestCheck(!isResumed);
+    TestCheck(isFrameDestroyed);
+  }
+
+  TEST_METHOD(Task_Pipeline) {
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    auto makeStep = [&queue](int value) noexcept {
+      return Mso::PostFuture(queue, [value]() noexcept { return value + 1; });
+    };
+
+    auto makeTask = [&makeStep]() -> Mso::Task<int> {
+      int value = 0;
+      for (int i = 0; i < 10; ++i) {
+        value = co_await makeStep(value);
+      }
+
+      co_return value;
+    };
+
+    Mso::Future<int> future = makeTask();
+    TestCheckEqual(10, Mso::FutureWaitAndGetValue(future));
+  }
+};
+
+} // namespace FutureTests
+
+#endif // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
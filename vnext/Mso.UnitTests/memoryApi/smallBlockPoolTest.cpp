@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "memoryApi/smallBlockPool.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "functional/functor.h"
+#include "motifCpp/testCheck.h"
+
+namespace Mso::Memory::Test {
+
+TEST_CLASS (SmallBlockPoolTest) {
+  TEST_METHOD(SmallBlockPool_ReusesFreedBlock) {
+    void *block1 = AllocateSmallBlock(40);
+    TestCheck(block1 != nullptr);
+    FreeSmallBlock(block1);
+
+    void *block2 = AllocateSmallBlock(40);
+    TestCheck(block1 == block2);
+    FreeSmallBlock(block2);
+  }
+
+  TEST_METHOD(SmallBlockPool_AllocatesLargeBlock) {
+    constexpr size_t size = SmallBlockMaxSize * 4;
+    void *block = AllocateSmallBlock(size);
+    TestCheck(block != nullptr);
+    std::memset(block, 0xAB, size);
+    FreeSmallBlock(block);
+  }
+
+  TEST_METHOD(SmallBlockPool_AlignsBlocksAsOperatorNew) {
+    TestCheck(SmallBlockAlignment >= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+    std::vector<void *> blocks;
+    for (size_t size = 1; size <= SmallBlockMaxSize * 2; ++size) {
+      blocks.push_back(AllocateSmallBlock(size));
+    }
+
+    for (void *block : blocks) {
+      TestCheck(reinterpret_cast<uintptr_t>(block) % SmallBlockAlignment == 0);
+      FreeSmallBlock(block);
+    }
+  }
+
+  TEST_METHOD(SmallBlockPool_Functor_AlignsCapture) {
+    struct alignas(16) AlignedValue {
+      float Values[4];
+    };
+
+    AlignedValue value{{1, 2, 3, 4}};
+    uintptr_t captureAddress{0};
+    Mso::VoidFunctor functor{[value, &captureAddress]() noexcept {
+      captureAddress = reinterpret_cast<uintptr_t>(&value);
+    }};
+
+    functor();
+    TestCheck(captureAddress % alignof(AlignedValue) == 0);
+  }
+
+  TEST_METHOD(SmallBlockPool_ReusesBlocksFreedOnOtherThread) {
+    constexpr size_t blockCount = 100;
+    std::vector<void *> blocks(blockCount);
+    for (auto &block : blocks) {
+      block = AllocateSmallBlock(64);
+    }
+
+    std::thread([&blocks]() noexcept {
+      for (auto block : blocks) {
+        FreeSmallBlock(block);
+      }
+    }).join();
+
+    // The blocks go back to the cache of this thread and no new memory is requested.
+    const size_t backingAllocationCount = GetSmallBlockPoolBackingAllocationCount();
+    for (auto &block : blocks) {
+      block = AllocateSmallBlock(64);
+    }
+
+    TestCheckEqual(backingAllocationCount, GetSmallBlockPoolBackingAllocationCount());
+    for (auto block : blocks) {
+      FreeSmallBlock(block);
+    }
+  }
+
+  TEST_METHOD(SmallBlockPool_Functor_DoesNotAllocateInSteadyState) {
+    int32_t value = 0;
+    auto makeFunctor = [&value](int32_t i) noexcept {
+      return Mso::VoidFunctor([&value, i]() noexcept { value = i; });
+    };
+
+    makeFunctor(0)();
+    const size_t backingAllocationCount = GetSmallBlockPoolBackingAllocationCount();
+    for (int32_t i = 0; i < 10000; ++i) {
+      makeFunctor(i)();
+    }
+
+    TestCheckEqual(backingAllocationCount, GetSmallBlockPoolBackingAllocationCount());
+    TestCheckEqual(9999, value);
+  }
+
+  TEST_METHOD(SmallBlockPool_DispatchQueue_ReusesTaskMemory) {
+    constexpr int32_t taskCount = 10000;
+    auto queue = Mso::DispatchQueue::MakeSerialQueue();
+    int32_t value = 0;
+
+    const size_t backingAllocationCount = GetSmallBlockPoolBackingAllocationCount();
+    for (int32_t i = 0; i < taskCount; ++i) {
+      queue.Post([&value, i]() noexcept { value += i > 0 ? 1 : 0; });
+    }
+
+    queue.AwaitTermination();
+
+    // Tasks are allocated from slabs, and the blocks freed on the queue thread are reused by the posting thread.
+    // Without the pool each task would need its own allocation.
+    TestCheck(GetSmallBlockPoolBackingAllocationCount() - backingAllocationCount < taskCount / 10);
+    TestCheckEqual(taskCount - 1, value);
+  }
+
+  TEST_METHOD(SmallBlockPool_CountsOutstandingBlocks) {
+    constexpr size_t blockCount = 100;
+    const size_t outstandingCount = GetSmallBlockPoolOutstandingBlockCount();
+    std::vector<void *> blocks(blockCount);
+    for (size_t i = 0; i < blockCount; ++i) {
+      // Every tenth block is too large for the pool.
+      blocks[i] = AllocateSmallBlock(i % 10 == 0 ? SmallBlockMaxSize + 1 : 64);
+    }
+
+    TestCheckEqual(outstandingCount + blockCount, GetSmallBlockPoolOutstandingBlockCount());
+
+    std::thread([&blocks]() noexcept {
+      for (size_t i = 0; i < blockCount / 2; ++i) {
+        FreeSmallBlock(blocks[i]);
+      }
+    }).join();
+
+    TestCheckEqual(outstandingCount + blockCount / 2, GetSmallBlockPoolOutstandingBlockCount());
+    for (size_t i = blockCount / 2; i < blockCount; ++i) {
+      FreeSmallBlock(blocks[i]);
+    }
+
+    TestCheckEqual(outstandingCount, GetSmallBlockPoolOutstandingBlockCount());
+  }
+
+  TEST_METHOD(SmallBlockPool_BlockOutlivesThread) {
+    const size_t outstandingCount = GetSmallBlockPoolOutstandingBlockCount();
+    void *block{nullptr};
+    std::thread([&block]() noexcept {
+      // The freed block is drained with the thread cache. The kept block keeps the cache alive.
+      FreeSmallBlock(AllocateSmallBlock(32));
+      block = AllocateSmallBlock(32);
+    }).join();
+
+    TestCheckEqual(outstandingCount + 1, GetSmallBlockPoolOutstandingBlockCount());
+    std::memset(block, 0xAB, 32);
+    FreeSmallBlock(block);
+    TestCheckEqual(outstandingCount, GetSmallBlockPoolOutstandingBlockCount());
+  }
+};
+
+} // namespace Mso::Memory::Test
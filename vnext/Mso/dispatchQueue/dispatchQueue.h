@@ -5,6 +5,7 @@
 #ifndef MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 #define MSO_DISPATCHQUEUE_DISPATCHQUEUE_H
 
+#include <chrono>
 #include <optional>
 #include <thread>
 #include "functional/functor.h"
@@ -24,6 +25,7 @@ struct DispatchLocalValueGuard;
 struct DispatchQueue;
 struct DispatchSuspendGuard;
 struct DispatchTaskBatch;
+struct DispatchTimer;
 template <typename TInvoke, typename TCancel>
 struct DispatchTaskImpl;
 template <typename TInvoke>
@@ -33,6 +35,7 @@ struct IDispatchQueue;
 struct IDispatchQueueScheduler;
 struct IDispatchQueueService;
 struct IDispatchQueueStatic;
+struct IDispatchTimer;
 
 //! A reason for a task being invoked to yield.
 enum class TaskYieldReason {
@@ -87,6 +90,7 @@ struct DispatchLocalValueGuard {
 
 //! Serial or concurrent dispatch queue main API.
 //! Use Post or InvokeElsePost to post tasks for invocation.
+//! Use PostAt or PostDelayed to post tasks for invocation after a due time.
 //! Use BeginTaskBatching to start tasks batching in current thread for the dispatch queue.
 //! Use Suspend to temporary suspend task invocation.
 //! Use Shutdown to finish task processing.
@@ -141,6 +145,13 @@ struct DispatchQueue {
   //! Post the task to the end of the queue for asynchronous invocation.
   void Post(DispatchTask &&task) const noexcept;
 
+  //! Post the task to the end of the queue when the due time comes. A due time in the past posts the task immediately.
+  //! Use the returned DispatchTimer to cancel the task before it is posted. The delayed tasks are canceled on shutdown.
+  DispatchTimer PostAt(std::chrono::steady_clock::time_point dueTime, DispatchTask &&task) const noexcept;
+
+  //! Post the task to the end of the queue after the delay. See PostAt for details.
+  DispatchTimer PostDelayed(std::chrono::steady_clock::duration delay, DispatchTask &&task) const noexcept;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   void InvokeElsePost(DispatchTask &&task) const noexcept;
@@ -234,6 +245,31 @@ struct DispatchSuspendGuard {
   Mso::CntPtr<IDispatchQueueService> m_state;
 };
 
+//! A task posted with DispatchQueue::PostAt or DispatchQueue::PostDelayed that waits for its due time.
+//! DispatchTimer is just a shared pointer to internal state and has size of a pointer. It is OK to copy and move.
+//! Releasing the DispatchTimer does not cancel the task.
+struct DispatchTimer {
+  //! Create empty DispatchTimer.
+  DispatchTimer(std::nullptr_t = nullptr) noexcept;
+
+  //! Create new DispatchTimer with provided state.
+  DispatchTimer(Mso::CntPtr<IDispatchTimer> &&state) noexcept;
+
+  //! True if state is not empty.
+  explicit operator bool() const noexcept;
+
+  //! Cancel the task if it is not posted to the queue yet. The task's ICancellationListener::OnCancel is called.
+  //! Returns false if the state is empty, or if the task is already posted or canceled.
+  bool Cancel() const noexcept;
+
+  //! A 'back-door' to get pointer to the state pointer. I.e. IDispatchTimer**.
+  template <typename TObject>
+  friend auto GetRawState(TObject &&obj) noexcept;
+
+ private:
+  Mso::CntPtr<IDispatchTimer> m_state;
+};
+
 //! RAII class to end task batching from current thread to the target dispatch queue.
 //! It is created by DispatchQueue::StartTaskBatching() call.
 //! If Post, InvokeElsePost, DeferElsePost, or Cancel are not called explicitly, then it calls Post for the task.
@@ -287,6 +323,14 @@ struct ICancellationListener : IUnknown {
   virtual void OnCancel() noexcept = 0;
 };
 
+//! A dispatch queue task that waits for its due time. See IDispatchQueueService::PostAt.
+MSO_GUID(IDispatchTimer, "f9a0e8c7-f63e-46cd-85ec-d6f1eef759c2")
+struct IDispatchTimer : IUnknown {
+  //! Cancel the task if it is not posted to the queue yet. The task's ICancellationListener::OnCancel is called.
+  //! Returns false if the task is already posted or canceled.
+  virtual bool Cancel() noexcept = 0;
+};
+
 //! Simple dispatch queue interface that posts tasks for asynchronous invocation.
 MSO_GUID(IDispatchQueue, "45b16d36-d4d7-4fe2-8af0-626bc39e1d3b")
 struct IDispatchQueue : IUnknown {
@@ -324,6 +368,13 @@ struct IDispatchQueueService : IUnknown {
   //! Add task to the end of asynchronous queue for invocation.
   virtual void Post(DispatchTask &&task) noexcept = 0;
 
+  //! Add task to the end of asynchronous queue when the due time comes. A due time in the past adds it immediately.
+  //! The returned timer can cancel the task before it is added. It is null if the task is added immediately.
+  //! The delayed tasks are canceled on shutdown.
+  virtual Mso::CntPtr<IDispatchTimer> PostAt(
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTask &&task) noexcept = 0;
+
   //! Invoke the task immediately if the queue uses the current thread. Otherwise, post it.
   //! The immediate execution ignores the suspend or shutdown states.
   virtual void InvokeElsePost(DispatchTask &&task) noexcept = 0;
@@ -439,7 +490,10 @@ struct IDispatchQueueStatic : IUnknown {
 //! DispatchTask implementation based on invoke and cancel function objects.
 template <typename TInvoke, typename TOnCancel>
 struct DispatchTaskImpl final
-    : Mso::UnknownObject<Mso::QueryCastHidden<Mso::IVoidFunctor>, Mso::ICancellationListener> {
+    : Mso::UnknownObject<
+          Mso::SimpleRefCountPolicy<Mso::DefaultRefCountedDeleter, Mso::SmallBlockMakeAllocator>,
+          Mso::QueryCastHidden<Mso::IVoidFunctor>,
+          Mso::ICancellationListener> {
   template <typename TInvokeArg, typename TOnCancelArg>
   DispatchTaskImpl(TInvokeArg &&invoke, TOnCancelArg &&onCancel) noexcept;
   ~DispatchTaskImpl() noexcept override;
@@ -456,7 +510,10 @@ struct DispatchTaskImpl final
 //! Dispatch task implementation that runs the same lambda for Invoke() and OnCancel().
 template <typename TInvoke>
 struct DispatchCleanupTaskImpl final
-    : Mso::UnknownObject<Mso::QueryCastHidden<Mso::IVoidFunctor>, Mso::ICancellationListener> {
+    : Mso::UnknownObject<
+          Mso::SimpleRefCountPolicy<Mso::DefaultRefCountedDeleter, Mso::SmallBlockMakeAllocator>,
+          Mso::QueryCastHidden<Mso::IVoidFunctor>,
+          Mso::ICancellationListener> {
   template <typename TInvokeArg>
   DispatchCleanupTaskImpl(TInvokeArg &&invoke) noexcept;
   void Invoke() noexcept override;
@@ -570,6 +627,18 @@ inline void DispatchQueue::Post(DispatchTask &&task) const noexcept {
   m_state->Post(std::move(task));
 }
 
+inline DispatchTimer DispatchQueue::PostAt(
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTask &&task) const noexcept {
+  return m_state->PostAt(dueTime, std::move(task));
+}
+
+inline DispatchTimer DispatchQueue::PostDelayed(
+    std::chrono::steady_clock::duration delay,
+    DispatchTask &&task) const noexcept {
+  return m_state->PostAt(std::chrono::steady_clock::now() + delay, std::move(task));
+}
+
 inline void DispatchQueue::InvokeElsePost(DispatchTask &&task) const noexcept {
   m_state->InvokeElsePost(std::move(task));
 }
@@ -660,6 +729,22 @@ inline DispatchSuspendGuard::operator bool() const noexcept {
   return m_state != nullptr;
 }
 
+//=============================================================================
+// DispatchTimer inline implementation
+//=============================================================================
+
+inline DispatchTimer::DispatchTimer(std::nullptr_t) noexcept {}
+
+inline DispatchTimer::DispatchTimer(Mso::CntPtr<IDispatchTimer> &&state) noexcept : m_state{std::move(state)} {}
+
+inline DispatchTimer::operator bool() const noexcept {
+  return m_state != nullptr;
+}
+
+inline bool DispatchTimer::Cancel() const noexcept {
+  return m_state && m_state->Cancel();
+}
+
 //=============================================================================
 // DispatchTaskBatch inline implementation
 //=============================================================================
@@ -667,7 +752,11 @@ inline DispatchSuspendGuard::operator bool() const noexcept {
 inline DispatchTaskBatch::DispatchTaskBatch(std::nullptr_t) noexcept {}
 
 inline DispatchTaskBatch::DispatchTaskBatch(Mso::CntPtr<IDispatchQueueService> const &state) noexcept
-    : m_state{state} {}
+    : m_state{state} {
+  if (m_state) {
+    m_state->BeginTaskBatching();
+  }
+}
 
 inline DispatchTaskBatch::~DispatchTaskBatch() noexcept {
   if (m_state) {
@@ -10,7 +10,7 @@
   counting and is always non-throwing (even if it is wrapping a throwing function
   object). Mso::Functor has the following semantics:
   - Always performs a heap allocation when creating a new instance from a function object, unless the function object is
-  stateless.
+  stateless. Small function objects are allocated from the thread-caching pool in memoryApi/smallBlockPool.h.
   - Are small (size of a CntPtr).
   - Cheap to copy and move.
   - There will only be one outstanding copy of the function object given to the Mso::Functor.
@@ -153,7 +153,9 @@ struct ConstexprFunctorBase : public TIFunctor {
 //! Function object wrapper. It can be a lambda or a class implementing call operator().
 template <typename TFunc, typename TResult, typename... TArgs>
 class FunctionObjectWrapper final
-    : public Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, Mso::IFunctor<TResult, TArgs...>> {
+    : public Mso::UnknownObject<
+          Mso::RefCountStrategy::SimpleNoQueryWithAllocator<Mso::SmallBlockMakeAllocator>,
+          Mso::IFunctor<TResult, TArgs...>> {
  public:
   FunctionObjectWrapper() = delete;
   MSO_NO_COPY_CTOR_AND_ASSIGNMENT(FunctionObjectWrapper);
@@ -172,7 +174,9 @@ class FunctionObjectWrapper final
 //! Throwing function object wrapper. It can be a lambda or a class implementing call operator().
 template <typename TFunc, typename TResult, typename... TArgs>
 class FunctionObjectWrapperThrow final
-    : public Mso::UnknownObject<Mso::RefCountStrategy::SimpleNoQuery, Mso::IFunctorThrow<TResult, TArgs...>> {
+    : public Mso::UnknownObject<
+          Mso::RefCountStrategy::SimpleNoQueryWithAllocator<Mso::SmallBlockMakeAllocator>,
+          Mso::IFunctorThrow<TResult, TArgs...>> {
  public:
   FunctionObjectWrapperThrow() = delete;
   MSO_NO_COPY_CTOR_AND_ASSIGNMENT(FunctionObjectWrapperThrow);
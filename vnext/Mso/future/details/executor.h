@@ -247,6 +247,40 @@ struct Inline : Internal::ExecutorInvoker {
   LIBLET_PUBLICAPI void Post(DispatchTask &&Task) noexcept;
 };
 
+namespace Internal {
+
+//! Invokes the task inline if it is posted for a continuation of an already completed future and the thread has not
+//! reached the inline invocation depth limit. Returns false if the task must be posted.
+LIBLET_PUBLICAPI bool TryInvokeReadyTask(DispatchTask &task) noexcept;
+
+} // namespace Internal
+
+//! Counters of the continuations handled by the InlineIfReady executors.
+struct InlineIfReadyCounters {
+  uint64_t InvokedInline; //!< Continuations invoked inline because their future was already completed.
+  uint64_t Posted; //!< Continuations posted to the base executor.
+};
+
+//! Returns the counters of the continuations handled by the InlineIfReady executors in the process.
+LIBLET_PUBLICAPI InlineIfReadyCounters GetInlineIfReadyCounters() noexcept;
+
+//! Executor that invokes a continuation inline when it is added to an already completed future.
+//! It skips posting the continuation and lets the future chain complete synchronously.
+//! Continuations of not completed futures are posted to the base executor. To avoid stack overflow in long
+//! chains of completed futures, the inline invocations are nested only up to a fixed depth per thread,
+//! and then the continuation is posted to the base executor.
+template <class TBaseExecutor = Concurrent>
+struct InlineIfReady : TBaseExecutor {
+  using Throwing = Internal::ThrowingExecutor<InlineIfReady>;
+  using TBaseExecutor::TBaseExecutor;
+
+  void Post(DispatchTask &&task) noexcept {
+    if (!Internal::TryInvokeReadyTask(task)) {
+      TBaseExecutor::Post(std::move(task));
+    }
+  }
+};
+
 } // namespace Mso::Executors
 
 namespace Mso::Futures {
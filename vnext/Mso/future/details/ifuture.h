@@ -104,6 +104,10 @@ struct IFuture : IUnknown {
 LIBLET_PUBLICAPI Mso::CntPtr<IFuture>
 MakeFuture(const FutureTraits &traits, size_t taskSize = 0, _Out_opt_ ByteArrayView *taskBuffer = nullptr) noexcept;
 
+//! Returns true if it is called from a TaskPost callback of a continuation that is being added to an already
+//! completed future. Such continuation is posted synchronously from the IFuture::AddContinuation call.
+LIBLET_PUBLICAPI bool IsPostingReadyContinuation() noexcept;
+
 } // namespace Mso::Futures
 
 #endif // MSO_FUTURE_DETAILS_IFUTURE_H
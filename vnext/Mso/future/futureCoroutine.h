@@ -0,0 +1,246 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+#ifndef MSO_FUTURE_FUTURECOROUTINE_H
+#define MSO_FUTURE_FUTURECOROUTINE_H
+
+/** \file futureCoroutine.h
+
+C++20 coroutine support for Mso::Future. It is only available when the compiler supports coroutines.
+
+- Mso::Task<T> is a coroutine return type. The coroutine starts running inline when it is called, and its result
+  completes the Task<T> which is a Future<T>. A co_return of a value sets the value, and a co_return of an
+  Mso::Maybe<T> sets either the value or the error.
+
+- co_await of a Future<T> inside of a Task<T> coroutine suspends the coroutine until the future is completed and
+  returns its value. If the future fails, then the coroutine is destroyed without resuming, and its Task<T> fails with
+  the same error. It is the same error propagation as in a chain of Future::Then calls.
+
+- co_await Mso::ResumeOn(queue) inside of a Task<T> coroutine posts the rest of the coroutine to the queue. If the
+  queue cancels the task, then the coroutine is destroyed and its Task<T> is canceled.
+
+Unlike a chain of Future::Then calls that allocates a new future for each continuation, a coroutine allocates its
+frame once, and awaiting a completed future does not allocate at all. The coroutine frames are allocated from the
+small block pool, which aligns them the same way as the default operator new.
+*/
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <type_traits>
+#include "dispatchQueue/dispatchQueue.h"
+#include "future/future.h"
+#include "memoryApi/smallBlockPool.h"
+
+namespace Mso {
+
+template <class T>
+struct Task;
+
+namespace Futures {
+
+template <class T>
+struct TaskPromise;
+
+//! Identifies the Task<T> promise types.
+struct TaskPromiseTag {};
+
+//! Base of the Task<T> promise types: it allocates coroutine frames and completes the Task<T>.
+template <class T>
+struct TaskPromiseBase : TaskPromiseTag {
+  // Coroutine frames expect the alignment of the default operator new.
+  static_assert(
+      Mso::Memory::SmallBlockAlignment >= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+      "Coroutine frames need the default operator new alignment.");
+
+  static void *operator new(size_t size) noexcept {
+    void *frame = Mso::Memory::AllocateSmallBlock(size);
+    VerifyAllocElseCrashTag(frame, UNTAGGED);
+    return frame;
+  }
+
+  static void operator delete(void *frame) noexcept {
+    Mso::Memory::FreeSmallBlock(frame);
+  }
+
+  Task<T> get_return_object() noexcept {
+    return Task<T>{m_promise.AsFuture()};
+  }
+
+  std::suspend_never initial_suspend() const noexcept {
+    return {};
+  }
+
+  std::suspend_never final_suspend() const noexcept {
+    return {};
+  }
+
+  void unhandled_exception() const noexcept {
+    VerifyElseCrashSz(false, "Mso::Task coroutines must not throw exceptions.");
+  }
+
+  //! Destroys the suspended coroutine and fails its Task<T> with the error.
+  void Abort(Mso::ErrorCode &&error) noexcept {
+    // The Task<T> continuations must not observe the coroutine frame.
+    Mso::Promise<T> promise{std::move(m_promise)};
+    std::coroutine_handle<TaskPromise<T>>::from_promise(static_cast<TaskPromise<T> &>(*this)).destroy();
+    promise.SetError(std::move(error));
+  }
+
+  //! Destroys the suspended coroutine and cancels its Task<T>.
+  void Cancel() noexcept {
+    Mso::Promise<T> promise{std::move(m_promise)};
+    std::coroutine_handle<TaskPromise<T>>::from_promise(static_cast<TaskPromise<T> &>(*this)).destroy();
+    (void)promise.TryCancel();
+  }
+
+ protected:
+  Mso::Promise<T> m_promise;
+};
+
+template <class T>
+struct TaskPromise : TaskPromiseBase<T> {
+  void return_value(T &&value) noexcept {
+    this->m_promise.SetValue(std::move(value));
+  }
+
+  void return_value(const T &value) noexcept {
+    this->m_promise.SetValue(value);
+  }
+
+  void return_value(Mso::Maybe<T> &&value) noexcept {
+    this->m_promise.SetMaybe(std::move(value));
+  }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase<void> {
+  void return_void() noexcept {
+    m_promise.SetValue();
+  }
+};
+
+template <class TPromise>
+constexpr bool IsTaskPromise = std::is_base_of_v<TaskPromiseTag, TPromise>;
+
+//! The task of a future that resumes a Task<T> coroutine when the awaited future is completed.
+struct CoroutineResumeTask {
+  void *Frame;
+  void (*Abort)(void *frame, Mso::ErrorCode &&error) noexcept;
+
+  static void Invoke(const ByteArrayView &taskBuffer, IFuture *future, IFuture * /*parentFuture*/) noexcept {
+    // The awaiter reads the value from the awaited future.
+    (void)future->TrySetSuccess(/*crashIfFailed:*/ true);
+    std::coroutine_handle<>::from_address(taskBuffer.As<CoroutineResumeTask>()->Frame).resume();
+  }
+
+  static void Catch(const ByteArrayView &taskBuffer, IFuture *future, ErrorCode &&parentError) noexcept {
+    (void)future->TrySetError(Mso::ErrorCode{parentError}, /*crashIfFailed:*/ true);
+    auto task = taskBuffer.As<CoroutineResumeTask>();
+    task->Abort(task->Frame, std::move(parentError));
+  }
+
+  constexpr static FutureCatchCallback *CatchPtr = &Catch;
+};
+
+//! Awaiter for a Future<T> in a Task<T> coroutine.
+template <class T>
+struct FutureAwaiter {
+  explicit FutureAwaiter(Mso::Future<T> &&future) noexcept : m_future{std::move(future)} {
+    VerifyElseCrashSz(m_future, "Cannot await an empty future.");
+  }
+
+  bool await_ready() const noexcept {
+    return Mso::GetIFuture(m_future)->IsSucceeded();
+  }
+
+  template <class TPromise>
+  void await_suspend(std::coroutine_handle<TPromise> handle) noexcept {
+    static_assert(IsTaskPromise<TPromise>, "Mso::Future can only be awaited in Mso::Task coroutines.");
+
+    constexpr const auto &futureTraits = FutureTraitsProvider<
+        /*Options:    */ FutureOptions::UseParentValue,
+        /*ResultType: */ void,
+        /*TaskType:   */ CoroutineResumeTask,
+        /*PostType:   */ void,
+        /*InvokeType: */ CoroutineResumeTask,
+        /*CatchType:  */ CoroutineResumeTask>::Traits;
+
+    ByteArrayView taskBuffer;
+    Mso::CntPtr<IFuture> continuation = MakeFuture(futureTraits, sizeof(CoroutineResumeTask), &taskBuffer);
+    ::new (taskBuffer.VoidDataChecked(sizeof(CoroutineResumeTask))) CoroutineResumeTask{
+        handle.address(), [](void *frame, Mso::ErrorCode &&error) noexcept {
+          std::coroutine_handle<TPromise>::from_address(frame).promise().Abort(std::move(error));
+        }};
+
+    // The coroutine may be resumed or destroyed inline. The awaiter must not be used after this call.
+    Mso::GetIFuture(m_future)->AddContinuation(std::move(continuation));
+  }
+
+  T await_resume() const noexcept {
+    if constexpr (!std::is_void_v<T>) {
+      return std::move(*Mso::GetIFuture(m_future)->GetValue().template As<T>());
+    }
+  }
+
+ private:
+  Mso::Future<T> m_future;
+};
+
+//! Awaiter that posts the rest of a Task<T> coroutine to a dispatch queue.
+struct ResumeOnAwaiter {
+  explicit ResumeOnAwaiter(Mso::DispatchQueue const &queue) noexcept : m_queue{queue} {}
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  template <class TPromise>
+  void await_suspend(std::coroutine_handle<TPromise> handle) const noexcept {
+    static_assert(IsTaskPromise<TPromise>, "Mso::ResumeOn can only be awaited in Mso::Task coroutines.");
+
+    // The coroutine may be resumed and destroyed on the queue before Post returns. Do not use the awaiter after it.
+    auto queue = m_queue;
+    queue.Post(Mso::MakeDispatchTask(
+        [handle]() noexcept { handle.resume(); }, [handle]() noexcept { handle.promise().Cancel(); }));
+  }
+
+  void await_resume() const noexcept {}
+
+ private:
+  Mso::DispatchQueue m_queue;
+};
+
+} // namespace Futures
+
+//! A coroutine return type that is completed with the coroutine result. Task<T> is a Future<T>.
+template <class T>
+struct Task : Mso::Future<T> {
+  using promise_type = Mso::Futures::TaskPromise<T>;
+
+  explicit Task(Mso::Future<T> &&future) noexcept : Mso::Future<T>{std::move(future)} {}
+};
+
+//! Suspends a Task<T> coroutine until the future is completed.
+template <class T>
+Mso::Futures::FutureAwaiter<T> operator co_await(Mso::Future<T> const &future) noexcept {
+  return Mso::Futures::FutureAwaiter<T>{Mso::Future<T>{future}};
+}
+
+//! Suspends a Task<T> coroutine until the future is completed.
+template <class T>
+Mso::Futures::FutureAwaiter<T> operator co_await(Mso::Future<T> &&future) noexcept {
+  return Mso::Futures::FutureAwaiter<T>{std::move(future)};
+}
+
+//! Returns an awaiter that continues a Task<T> coroutine in the queue.
+inline Mso::Futures::ResumeOnAwaiter ResumeOn(Mso::DispatchQueue const &queue) noexcept {
+  return Mso::Futures::ResumeOnAwaiter{queue};
+}
+
+} // namespace Mso
+
+#endif // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#endif // MSO_FUTURE_FUTURECOROUTINE_H
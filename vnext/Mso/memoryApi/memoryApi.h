@@ -50,7 +50,9 @@ struct Destructor {
 };
 
 template <typename T>
-struct Destructor<T, typename std::enable_if<std::is_destructible<T>::value && !std::is_pod<T>::value>::type> {
+struct Destructor<
+    T,
+    typename std::enable_if<std::is_destructible<T>::value && !std::is_trivially_destructible<T>::value>::type> {
   static void Destruct(T &obj) noexcept {
     UNREFERENCED_PARAMETER(obj);
     obj.~T();
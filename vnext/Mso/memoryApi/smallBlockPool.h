@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+/**
+Small block pool for objects that are created and destroyed at a high rate, such as Mso::Functor closures and
+dispatch tasks.
+
+Requests up to SmallBlockMaxSize bytes are rounded up to a size class and served from free lists cached by the
+calling thread. The free lists are refilled from slabs that hold many blocks, so that the steady state does not call
+the underlying allocator at all. A block may be freed on any thread: it goes back to the cache of the thread that
+allocated it. Larger requests and requests made while a thread is exiting are forwarded to Mso::Memory::AllocateEx.
+
+All blocks are aligned to SmallBlockAlignment, the same alignment as the memory returned by the default operator new.
+
+When a thread exits with all its blocks freed, its slabs are returned to the system. Otherwise the thread cache
+is kept with its slabs and a thread that starts later takes it over.
+
+Slabs are allocated with AllocFlags::IgnoreLeak because they outlive the blocks carved from them. Use
+GetSmallBlockPoolOutstandingBlockCount to detect leaked blocks.
+*/
+#pragma once
+#ifndef MSO_MEMORYAPI_SMALLBLOCKPOOL_H
+#define MSO_MEMORYAPI_SMALLBLOCKPOOL_H
+
+#ifdef __cplusplus
+
+#include <cstddef>
+#include "compilerAdapters/functionDecorations.h"
+#include "oacr/oacr.h"
+
+namespace Mso {
+namespace Memory {
+
+//! The largest allocation size served from the small block pool.
+constexpr size_t SmallBlockMaxSize = 256;
+
+//! The alignment of all blocks returned by AllocateSmallBlock.
+constexpr size_t SmallBlockAlignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+/**
+Return a new allocation of the requested size (cb) from the small block pool
+Returns nullptr on failure
+*/
+_Ret_maybenull_ _Post_writable_byte_size_(cb) void *AllocateSmallBlock(size_t cb) noexcept;
+
+/**
+Release a block allocated by AllocateSmallBlock. It can be called on any thread.
+*/
+void FreeSmallBlock(_Pre_maybenull_ _Post_invalid_ void *pv) noexcept;
+
+/**
+Return the number of times the small block pool called Mso::Memory::AllocateEx.
+It is used by tests and diagnostics to verify that the pooled memory is reused.
+*/
+size_t GetSmallBlockPoolBackingAllocationCount() noexcept;
+
+/**
+Return the number of blocks allocated by AllocateSmallBlock and not released yet.
+Leak detection compares it before and after a test. Blocks freed concurrently may not be reflected yet.
+*/
+size_t GetSmallBlockPoolOutstandingBlockCount() noexcept;
+
+} // namespace Memory
+} // namespace Mso
+
+#endif // __cplusplus
+
+#endif // MSO_MEMORYAPI_SMALLBLOCKPOOL_H
@@ -7,6 +7,7 @@
 
 #include "compilerAdapters/cppMacrosDebug.h"
 #include "memoryApi/memoryApi.h"
+#include "memoryApi/smallBlockPool.h"
 #include "smartPtr/cntPtr.h"
 
 namespace Mso {
@@ -190,6 +191,20 @@ struct MakeAllocator {
   }
 };
 
+/**
+  Memory allocator for small ref counted objects that are created and destroyed at a high rate,
+  such as functors and dispatch tasks. It uses thread-caching pools. See memoryApi/smallBlockPool.h.
+*/
+struct SmallBlockMakeAllocator {
+  static void *Allocate(size_t size) noexcept {
+    return Mso::Memory::AllocateSmallBlock(size);
+  }
+
+  static void Deallocate(void *ptr) noexcept {
+    Mso::Memory::FreeSmallBlock(ptr);
+  }
+};
+
 #pragma warning(pop)
 
 } // namespace Mso
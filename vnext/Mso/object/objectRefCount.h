@@ -103,7 +103,9 @@ struct DefaultRefCountedDeleter {
 */
 namespace RefCountStrategy {
 using Simple = SimpleRefCountPolicy<DefaultRefCountedDeleter, MakeAllocator>;
-struct SimpleNoQuery;
+template <typename TAllocator>
+struct SimpleNoQueryWithAllocator;
+using SimpleNoQuery = SimpleNoQueryWithAllocator<MakeAllocator>;
 struct NoRefCount;
 struct NoRefCountNoQuery;
 }; // namespace RefCountStrategy
@@ -11,6 +11,8 @@ namespace Mso {
 // QueueService implementation.
 //=============================================================================
 
+/*static*/ thread_local uint32_t QueueService::tls_taskBatchCount{0};
+
 QueueService::QueueService(Mso::CntPtr<IDispatchQueueScheduler> &&scheduler) noexcept
     : m_scheduler{std::move(scheduler)} {
   m_scheduler->IntializeScheduler(this);
@@ -23,28 +25,47 @@ QueueService::~QueueService() noexcept {
 void QueueService::Post(DispatchTask &&task) noexcept {
   VerifyElseCrashSz(task, "The task is empty");
 
-  bool isShutdown = false;
-  bool shouldSchedule = false;
-
-  {
+  // Only a thread that started a task batch needs the lock to find its batch.
+  if (tls_taskBatchCount > 0) {
     std::lock_guard lock{m_mutex};
     auto it = m_taskBatches.find(std::this_thread::get_id());
     if (it != m_taskBatches.end()) {
       it->second->AddTask(std::move(task));
-    } else {
-      isShutdown = m_shutdownAction.has_value();
-      if (!isShutdown) {
-        m_queue.Enqueue(std::move(task));
-        shouldSchedule = (m_suspendCounter == 0);
-      }
+      return;
     }
   }
 
-  if (shouldSchedule) {
-    m_scheduler->Post();
-  } else if (isShutdown) {
+  if (m_isShutdown.load(std::memory_order_acquire)) {
     CancelTask(std::move(task));
+    return;
+  }
+
+  m_queue.Enqueue(std::move(task));
+
+  // Order the enqueue before reading the shutdown flag, the suspend counter and the scheduler state. Shutdown,
+  // Resume and the schedulers first change their state and then check the queue, so one of the two sides sees
+  // the change of the other.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_isShutdown.load(std::memory_order_relaxed)) {
+    // Shutdown could cancel the pending tasks before this task was enqueued.
+    CancelQueuedTasks(/*onlyIfShutdownCancels:*/ true);
+  }
+
+  if (m_suspendCounter.load(std::memory_order_relaxed) == 0) {
+    m_scheduler->Post();
+  }
+}
+
+Mso::CntPtr<IDispatchTimer> QueueService::PostAt(
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTask &&task) noexcept {
+  VerifyElseCrashSz(task, "The task is empty");
+  if (dueTime <= std::chrono::steady_clock::now()) {
+    Post(std::move(task));
+    return nullptr;
   }
+
+  return TimerWheel::Instance().Schedule(m_delayedTasks, this, dueTime, std::move(task));
 }
 
 bool QueueService::ShouldYield(TaskYieldReason *yieldReason) noexcept {
@@ -91,10 +112,12 @@ void QueueService::BeginTaskBatching() noexcept {
   auto taskBatch{Mso::Make<TaskBatch>()};
   std::lock_guard lock{m_mutex};
   auto result = m_taskBatches.try_emplace(std::this_thread::get_id(), std::move(taskBatch));
-  if (result.second) {
+  if (!result.second) {
     taskBatch->SetEnclosingBatch(std::move(result.first->second));
     result.first->second = std::move(taskBatch);
   }
+
+  ++tls_taskBatchCount;
 }
 
 DispatchTask QueueService::EndTaskBatching() noexcept {
@@ -108,6 +131,8 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
     } else {
       m_taskBatches.erase(it);
     }
+
+    --tls_taskBatchCount;
   } else {
     taskBatch = Mso::Make<TaskBatch>();
   }
@@ -116,6 +141,10 @@ DispatchTask QueueService::EndTaskBatching() noexcept {
 }
 
 bool QueueService::HasTaskBatching() noexcept {
+  if (tls_taskBatchCount == 0) {
+    return false;
+  }
+
   std::lock_guard lock{m_mutex};
   return m_taskBatches.find(std::this_thread::get_id()) != m_taskBatches.end();
 }
@@ -171,6 +200,7 @@ void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
   {
     std::lock_guard lock{m_mutex};
     m_shutdownAction = pendingTaskAction;
+    m_isShutdown.store(true, std::memory_order_seq_cst);
     if (pendingTaskAction == PendingTaskAction::Cancel) {
       m_queue.DequeueAll(/*out*/ tasksToCancel);
     }
@@ -180,12 +210,18 @@ void QueueService::Shutdown(PendingTaskAction pendingTaskAction) noexcept {
     CancelTask(std::move(task));
   }
 
+  // Delayed tasks are not due yet: they are canceled for both pending task actions.
+  TimerWheel::Instance().CloseList(m_delayedTasks);
+
   m_scheduler->Shutdown();
 }
 
 void QueueService::AwaitTermination() noexcept {
   Shutdown(PendingTaskAction::Complete);
   m_scheduler->AwaitTermination();
+
+  // The scheduler does not invoke the tasks posted concurrently with its termination.
+  CancelQueuedTasks(/*onlyIfShutdownCancels:*/ false);
 }
 
 bool QueueService::HasTasks() noexcept {
@@ -194,8 +230,24 @@ bool QueueService::HasTasks() noexcept {
 }
 
 bool QueueService::TryDequeTask(/*out*/ DispatchTask &task) noexcept {
-  std::lock_guard lock{m_mutex};
-  return m_suspendCounter == 0 && m_queue.TryDequeue(/*out*/ task);
+  std::vector<DispatchTask> tasksToCancel;
+
+  {
+    std::lock_guard lock{m_mutex};
+    if (m_shutdownAction != PendingTaskAction::Cancel) {
+      return m_suspendCounter == 0 && m_queue.TryDequeue(/*out*/ task);
+    }
+
+    // Post does not take the lock: a task posted concurrently with Shutdown may be enqueued after
+    // Shutdown has canceled the pending tasks. Post cancels it too, whoever comes first.
+    m_queue.DequeueAll(/*out*/ tasksToCancel);
+  }
+
+  for (auto &taskToCancel : tasksToCancel) {
+    CancelTask(std::move(taskToCancel));
+  }
+
+  return false;
 }
 
 void QueueService::InvokeTask(
@@ -210,6 +262,21 @@ void QueueService::InvokeTask(
   }
 }
 
+void QueueService::CancelQueuedTasks(bool onlyIfShutdownCancels) noexcept {
+  std::vector<DispatchTask> tasksToCancel;
+
+  {
+    std::lock_guard lock{m_mutex};
+    if (!onlyIfShutdownCancels || m_shutdownAction == PendingTaskAction::Cancel) {
+      m_queue.DequeueAll(/*out*/ tasksToCancel);
+    }
+  }
+
+  for (auto &task : tasksToCancel) {
+    CancelTask(std::move(task));
+  }
+}
+
 void QueueService::CancelTask(DispatchTask &&task) noexcept {
   DispatchTask taskToCancel{std::move(task)};
   if (auto cancellation = query_cast<ICancellationListener *>(taskToCancel.Get())) {
@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <thread>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "object/refCountedObject.h"
 #include "taskQueue.h"
+#include "timerWheel.h"
 
 namespace Mso {
 
@@ -31,6 +33,8 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
 
  public: // IDispatchQueueService
   void Post(DispatchTask &&task) noexcept override;
+  Mso::CntPtr<IDispatchTimer> PostAt(std::chrono::steady_clock::time_point dueTime, DispatchTask &&task) noexcept
+      override;
   bool ShouldYield(TaskYieldReason *yieldReason) noexcept override;
   bool IsCurrentQueue() noexcept override;
   bool IsSerial() noexcept override;
@@ -52,6 +56,10 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   void CancelTask(DispatchTask &&task) noexcept override;
 
  private:
+  // Cancels the tasks left in the queue. With onlyIfShutdownCancels it does nothing unless the queue is shut
+  // down with PendingTaskAction::Cancel.
+  void CancelQueuedTasks(bool onlyIfShutdownCancels) noexcept;
+
   bool TrySwapLocalValue(
       SwapDispatchLocalValueCallback swapLocalValue,
       void **tlsValue,
@@ -62,9 +70,15 @@ struct QueueService : Mso::UnknownObject<Mso::RefCountStrategy::WeakRef, IDispat
   ThreadMutex m_mutex;
   TaskQueue m_queue{static_cast<IDispatchQueue *>(this)};
   std::optional<PendingTaskAction> m_shutdownAction;
-  int32_t m_suspendCounter{0};
+  std::atomic<bool> m_isShutdown{false}; // Set with m_shutdownAction. Post reads it without the lock.
+  std::atomic<int32_t> m_suspendCounter{0}; // Changed under the lock. Post reads it without the lock.
   std::map<std::thread::id, Mso::CntPtr<TaskBatch>> m_taskBatches;
   std::map<ptrdiff_t, QueueLocalValueEntry> m_localValues;
+  DelayedTaskList m_delayedTasks; // Protected by the TimerWheel lock.
+
+  // Number of task batches started by the current thread in all queues.
+  // Post only looks up m_taskBatches when it is not zero.
+  static thread_local uint32_t tls_taskBatchCount;
 };
 
 // Stores a queue local value
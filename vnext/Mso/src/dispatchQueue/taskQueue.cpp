@@ -2,67 +2,62 @@
 // Licensed under the MIT license.
 
 #include "taskQueue.h"
+#include <memory>
 
 namespace Mso {
 
 //=============================================================================
-// TaskReadBuffer implementation.
+// TaskQueue implementation.
 //=============================================================================
 
-bool TaskReadBuffer::TryDequeue(DispatchTask &item) noexcept {
-  if (m_index < m_buffer.size()) {
-    item = std::move(m_buffer[m_index]);
-    ++m_index;
-    return true;
-  }
-
-  return false;
-}
-
-void TaskReadBuffer::SwapBuffer(std::vector<DispatchTask> &buffer) noexcept {
-  // Before swapping erase deleted items in the beginning of the buffer.
-  m_buffer.erase(m_buffer.begin(), m_buffer.begin() + m_index);
-  m_index = 0;
-  m_buffer.swap(buffer);
-}
+TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept
+    : m_back{new Node()}, m_front{m_back.load(std::memory_order_relaxed)}, m_weakOwnerPtr{std::move(weakOwnerPtr)} {}
 
-size_t TaskReadBuffer::Size() const noexcept {
-  return m_buffer.size() - m_index;
-}
-
-bool TaskReadBuffer::IsEmpty() const noexcept {
-  return m_index == m_buffer.size();
+TaskQueue::~TaskQueue() noexcept {
+  VerifyElseCrashSz(m_size.load() == 0, "Queue must be empty before destruction.");
+  delete m_front;
 }
 
-//=============================================================================
-// TaskQueue implementation.
-//=============================================================================
+void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
+  Node *node = new Node();
+  node->Task = std::move(task);
 
-TaskQueue::TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept : m_weakOwnerPtr{std::move(weakOwnerPtr)} {}
+  if (m_size.fetch_add(1) == 0) {
+    Mso::CntPtr<IUnknown> strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+    VerifyElseCrashSz(strongOwnerPtr, "Cannot post tasks to a queue being destroyed.");
+    m_strongOwnerPtr.store(strongOwnerPtr.Detach(), std::memory_order_relaxed);
+  }
 
-TaskQueue::~TaskQueue() noexcept {
-  VerifyElseCrashSz(IsEmpty(), "Queue must be empty before destruction.");
+  Node *prevBack = m_back.exchange(node, std::memory_order_acq_rel);
+  prevBack->Next.store(node, std::memory_order_release);
 }
 
-void TaskQueue::Enqueue(DispatchTask &&task) noexcept {
-  bool queueWasEmpty{IsEmpty()};
-  m_writeBuffer.push_back(std::move(task));
-  if (queueWasEmpty) {
-    m_strongOwnerPtr = m_weakOwnerPtr.GetStrongPtr();
+TaskQueue::Node *TaskQueue::TryTakeFront() noexcept {
+  Node *next = m_front->Next.load(std::memory_order_seq_cst);
+  if (!next) {
+    return nullptr;
   }
+
+  // The next node becomes the new stub.
+  Node *front = m_front;
+  front->Task = std::move(next->Task);
+  m_front = next;
+  return front;
 }
 
 bool TaskQueue::TryDequeue(/*out*/ DispatchTask &task) noexcept {
-  if (m_readBuffer.IsEmpty() && !m_writeBuffer.empty()) {
-    m_readBuffer.SwapBuffer(m_writeBuffer);
+  std::unique_ptr<Node> node{TryTakeFront()};
+  if (!node) {
+    return false;
   }
 
-  bool result = m_readBuffer.TryDequeue(/*out*/ task);
-  if (result && IsEmpty()) {
-    m_strongOwnerPtr = nullptr;
+  task = std::move(node->Task);
+  if (m_size.fetch_sub(1) == 1) {
+    // Release the reference added by the Enqueue call that made the queue non-empty.
+    m_strongOwnerPtr.load(std::memory_order_relaxed)->Release();
   }
 
-  return result;
+  return true;
 }
 
 bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
@@ -70,31 +65,22 @@ bool TaskQueue::DequeueAll(/*out*/ std::vector<DispatchTask> &tasks) noexcept {
     return false;
   }
 
-  tasks.reserve(tasks.size() + m_readBuffer.Size() + m_writeBuffer.size());
+  tasks.reserve(tasks.size() + Size());
 
-  if (!m_readBuffer.IsEmpty()) {
-    std::vector<DispatchTask> readBuffer;
-    m_readBuffer.SwapBuffer(readBuffer);
-    tasks.insert(tasks.end(), std::make_move_iterator(readBuffer.begin()), std::make_move_iterator(readBuffer.end()));
+  DispatchTask task;
+  while (TryDequeue(/*out*/ task)) {
+    tasks.push_back(std::move(task));
   }
 
-  if (!m_writeBuffer.empty()) {
-    tasks.insert(
-        tasks.end(), std::make_move_iterator(m_writeBuffer.begin()), std::make_move_iterator(m_writeBuffer.end()));
-    m_writeBuffer.clear();
-  }
-
-  m_strongOwnerPtr = nullptr;
-
   return true;
 }
 
 size_t TaskQueue::Size() const noexcept {
-  return m_readBuffer.Size() + m_writeBuffer.size();
+  return m_size.load();
 }
 
 bool TaskQueue::IsEmpty() const noexcept {
-  return m_readBuffer.IsEmpty() && m_writeBuffer.empty();
+  return m_front->Next.load(std::memory_order_seq_cst) == nullptr;
 }
 
 } // namespace Mso
@@ -3,36 +3,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "dispatchQueue/dispatchQueue.h"
 #include "threadMutex.h"
 
 namespace Mso {
 
-//! ReadBuffer is used by task queue to dequeue items.
-//! It moves read index instead of resizing buffer.
-struct TaskReadBuffer {
-  TaskReadBuffer() = default;
-
-  // Prohibit copy and move
-  TaskReadBuffer(TaskReadBuffer const &other) = delete;
-  TaskReadBuffer &operator=(TaskReadBuffer const &other) = delete;
-
-  bool TryDequeue(DispatchTask &task) noexcept;
-  void SwapBuffer(std::vector<DispatchTask> &buffer) noexcept;
-  size_t Size() const noexcept;
-  bool IsEmpty() const noexcept;
-
- private:
-  std::vector<DispatchTask> m_buffer;
-  size_t m_index{0};
-};
-
-//! Simple queue that uses two buffers: one for pushing items and another for popping them.
-//! Items are always enqueued under lock.
+//! Multi-producer single-consumer queue of tasks.
 //!
-//! Internally we have two vectors: one to enqueue items (write) and another to dequeue items (read).
-//! When the read queue is empty we swap them.
+//! Enqueue is lock-free and can be called concurrently from any thread: a producer allocates a node,
+//! exchanges it with the back of the queue, and links the previous back node to it. The consumer side
+//! (TryDequeue, DequeueAll) must be serialized by the caller. The front node is a stub with an empty
+//! task: a dequeued node becomes the new stub.
+//!
+//! A node becomes visible to the consumer only after the producer links it. Size() counts the enqueued
+//! tasks including the ones not linked yet, while IsEmpty() only checks for a task ready to be dequeued.
 struct TaskQueue {
   TaskQueue(Mso::WeakPtr<IUnknown> &&weakOwnerPtr) noexcept;
 
@@ -49,10 +35,22 @@ struct TaskQueue {
   bool IsEmpty() const noexcept;
 
  private:
-  std::vector<DispatchTask> m_writeBuffer; // To enqueue items.
-  TaskReadBuffer m_readBuffer; // To dequeue items.
+  struct Node {
+    std::atomic<Node *> Next{nullptr};
+    DispatchTask Task;
+  };
+
+  Node *TryTakeFront() noexcept;
+
+ private:
+  std::atomic<Node *> m_back; // Producers append nodes here.
+  Node *m_front; // The stub node. Only used by the consumer.
+  std::atomic<size_t> m_size{0};
   Mso::WeakPtr<IUnknown> m_weakOwnerPtr;
-  Mso::CntPtr<IUnknown> m_strongOwnerPtr; // Keep strong reference to the owner when queu is not empty;
+
+  // Keep strong reference to the owner when queue is not empty. The producer that changes the size from zero
+  // adds the reference, and the consumer that changes it to zero releases it.
+  std::atomic<IUnknown *> m_strongOwnerPtr{nullptr};
 };
 
 } // namespace Mso
@@ -0,0 +1,521 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// Portable thread pool scheduler. It is used on platforms without the Win32 thread pool,
+// and on Windows when MSO_PORTABLE_THREADPOOL is defined.
+#if defined(MS_TARGET_POSIX) || defined(MSO_PORTABLE_THREADPOOL)
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "queueService.h"
+
+using namespace std::chrono_literals;
+
+namespace Mso {
+
+struct ThreadPoolSchedulerPortable;
+
+//! Chase-Lev work-stealing deque of scheduler work items.
+//! Only the owning worker thread may call Push and Pop. Any thread may call Steal.
+//! Pointers are stored raw: a work item owns one reference to its scheduler.
+struct WorkStealingDeque {
+  WorkStealingDeque() noexcept;
+
+  WorkStealingDeque(WorkStealingDeque const &other) = delete;
+  WorkStealingDeque &operator=(WorkStealingDeque const &other) = delete;
+
+  void Push(ThreadPoolSchedulerPortable *item) noexcept;
+  ThreadPoolSchedulerPortable *Pop() noexcept;
+  ThreadPoolSchedulerPortable *Steal() noexcept;
+
+ private:
+  struct Buffer {
+    Buffer(int64_t capacity) noexcept;
+
+    ThreadPoolSchedulerPortable *Get(int64_t index) const noexcept;
+    void Put(int64_t index, ThreadPoolSchedulerPortable *item) noexcept;
+
+    const int64_t Capacity;
+
+   private:
+    std::unique_ptr<std::atomic<ThreadPoolSchedulerPortable *>[]> m_items;
+  };
+
+  Buffer *Grow(Buffer *buffer, int64_t bottom, int64_t top) noexcept;
+
+ private:
+  std::atomic<int64_t> m_top{0};
+  std::atomic<int64_t> m_bottom{0};
+  std::atomic<Buffer *> m_buffer{nullptr};
+
+  // Stealers may still read from a replaced buffer. Buffers are only released with the deque.
+  std::vector<std::unique_ptr<Buffer>> m_buffers;
+
+  constexpr static int64_t InitialCapacity{64};
+};
+
+//! Process-wide pool of worker threads shared by all ThreadPoolSchedulerPortable instances.
+//! Work posted from a worker goes to the worker's own deque. Work posted from any other thread
+//! goes to a shared injection queue. Idle workers steal from the other workers' deques.
+//! A monitor thread adds a worker when queued work makes no progress because all workers are blocked.
+struct WorkStealingThreadPool {
+  static WorkStealingThreadPool &Instance() noexcept;
+
+  void Submit(Mso::CntPtr<ThreadPoolSchedulerPortable> &&scheduler, bool isYielding) noexcept;
+
+ private:
+  struct Worker {
+    WorkStealingDeque Deque;
+    uint32_t RandomState;
+  };
+
+  WorkStealingThreadPool(uint32_t workerCount) noexcept;
+
+  void AddWorker() noexcept;
+  void RunWorker(Worker &worker) noexcept;
+  void RunMonitor() noexcept;
+  ThreadPoolSchedulerPortable *TryTakeWork(Worker &worker) noexcept;
+  ThreadPoolSchedulerPortable *TryTakeInjected() noexcept;
+  ThreadPoolSchedulerPortable *TrySteal(Worker &worker) noexcept;
+  void WakeUpWorker() noexcept;
+
+ private:
+  // Tasks may block waiting for other tasks. Keep enough workers even on machines with few cores.
+  constexpr static uint32_t MinWorkerCount{4};
+  constexpr static uint32_t MaxWorkerCount{256};
+  constexpr static std::chrono::milliseconds MonitorInterval{500};
+
+  // Workers are only added. Stealers read m_workerCount before accessing m_workers.
+  std::array<std::unique_ptr<Worker>, MaxWorkerCount> m_workers;
+  std::atomic<uint32_t> m_workerCount{0};
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeUp;
+  std::deque<ThreadPoolSchedulerPortable *> m_injected; // guarded by m_mutex
+  std::atomic<uint32_t> m_injectedCount{0};
+
+  // Number of work items in the injection queue and in all worker deques.
+  std::atomic<uint32_t> m_queuedItems{0};
+  std::atomic<uint32_t> m_idleWorkers{0};
+
+  // Number of work items completed by workers. The monitor uses it to detect that no work is progressing.
+  // A work item runs for up to 100ms before it yields, so a busy but unblocked worker keeps completing them.
+  std::atomic<uint64_t> m_completedItems{0};
+
+  static thread_local Worker *tls_worker;
+};
+
+struct ThreadPoolSchedulerPortable : Mso::UnknownObject<IDispatchQueueScheduler> {
+  ThreadPoolSchedulerPortable(uint32_t maxThreads) noexcept;
+  ~ThreadPoolSchedulerPortable() noexcept override;
+
+  //! Runs one work item: drains the queue for up to 100ms.
+  void RunWorkItem() noexcept;
+
+ public: // IDispatchQueueScheduler
+  void IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept override;
+  bool HasThreadAccess() noexcept override;
+  bool IsSerial() noexcept override;
+  void Post() noexcept override;
+  void Shutdown() noexcept override;
+  void AwaitTermination() noexcept override;
+
+ private:
+  bool TrySubmit(bool isYielding) noexcept;
+
+  struct ThreadAccessGuard {
+    ThreadAccessGuard(ThreadPoolSchedulerPortable *scheduler) noexcept;
+    ~ThreadAccessGuard() noexcept;
+
+    static bool HasThreadAccess(ThreadPoolSchedulerPortable *scheduler) noexcept;
+
+   private:
+    ThreadPoolSchedulerPortable *m_prevScheduler{nullptr};
+    static thread_local ThreadPoolSchedulerPortable *tls_scheduler;
+  };
+
+ private:
+  Mso::WeakPtr<IDispatchQueueService> m_queue;
+  const uint32_t m_maxThreads{1};
+  std::atomic<uint32_t> m_usedThreads{0};
+
+  // Number of submitted work items that are not completed yet. AwaitTermination waits for it to drop to zero.
+  std::mutex m_mutex;
+  std::condition_variable m_workCompleted;
+  uint32_t m_pendingWork{0}; // guarded by m_mutex
+
+  static thread_local ThreadPoolSchedulerPortable *tls_runningScheduler;
+
+  constexpr static uint32_t MaxConcurrentThreads{64};
+};
+
+//=============================================================================
+// WorkStealingDeque implementation
+//=============================================================================
+
+WorkStealingDeque::Buffer::Buffer(int64_t capacity) noexcept
+    : Capacity{capacity}, m_items{new std::atomic<ThreadPoolSchedulerPortable *>[static_cast<size_t>(capacity)]} {}
+
+ThreadPoolSchedulerPortable *WorkStealingDeque::Buffer::Get(int64_t index) const noexcept {
+  return m_items[static_cast<size_t>(index & (Capacity - 1))].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::Put(int64_t index, ThreadPoolSchedulerPortable *item) noexcept {
+  m_items[static_cast<size_t>(index & (Capacity - 1))].store(item, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque() noexcept {
+  m_buffers.push_back(std::make_unique<Buffer>(InitialCapacity));
+  m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Buffer *WorkStealingDeque::Grow(Buffer *buffer, int64_t bottom, int64_t top) noexcept {
+  m_buffers.push_back(std::make_unique<Buffer>(buffer->Capacity * 2));
+  Buffer *newBuffer = m_buffers.back().get();
+  for (int64_t i = top; i < bottom; ++i) {
+    newBuffer->Put(i, buffer->Get(i));
+  }
+
+  m_buffer.store(newBuffer, std::memory_order_release);
+  return newBuffer;
+}
+
+void WorkStealingDeque::Push(ThreadPoolSchedulerPortable *item) noexcept {
+  int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+  int64_t top = m_top.load(std::memory_order_acquire);
+  Buffer *buffer = m_buffer.load(std::memory_order_relaxed);
+  if (bottom - top > buffer->Capacity - 1) {
+    buffer = Grow(buffer, bottom, top);
+  }
+
+  buffer->Put(bottom, item);
+  m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+ThreadPoolSchedulerPortable *WorkStealingDeque::Pop() noexcept {
+  int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+  Buffer *buffer = m_buffer.load(std::memory_order_relaxed);
+  m_bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t top = m_top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty.
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  ThreadPoolSchedulerPortable *item = buffer->Get(bottom);
+  if (top == bottom) {
+    // The last item: race with the stealers for it.
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      item = nullptr;
+    }
+
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  return item;
+}
+
+ThreadPoolSchedulerPortable *WorkStealingDeque::Steal() noexcept {
+  int64_t top = m_top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t bottom = m_bottom.load(std::memory_order_acquire);
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  ThreadPoolSchedulerPortable *item = m_buffer.load(std::memory_order_acquire)->Get(top);
+  if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Lost the race to the owner or to another stealer.
+    return nullptr;
+  }
+
+  return item;
+}
+
+//=============================================================================
+// WorkStealingThreadPool implementation
+//=============================================================================
+
+/*static*/ thread_local WorkStealingThreadPool::Worker *WorkStealingThreadPool::tls_worker{nullptr};
+
+/*static*/ WorkStealingThreadPool &WorkStealingThreadPool::Instance() noexcept {
+  // The pool is never destroyed: its worker threads may still run while static objects are destroyed.
+  static WorkStealingThreadPool *s_instance =
+      new WorkStealingThreadPool((std::max)(std::thread::hardware_concurrency(), MinWorkerCount));
+  return *s_instance;
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(uint32_t workerCount) noexcept {
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    AddWorker();
+  }
+
+  std::thread([this]() noexcept { RunMonitor(); }).detach();
+}
+
+void WorkStealingThreadPool::AddWorker() noexcept {
+  // Workers are added by the constructor and then only by the monitor thread: there is a single writer.
+  const uint32_t index = m_workerCount.load(std::memory_order_relaxed);
+  if (index == MaxWorkerCount) {
+    return;
+  }
+
+  m_workers[index] = std::make_unique<Worker>();
+  m_workers[index]->RandomState = index + 1;
+  Worker *worker = m_workers[index].get();
+  m_workerCount.store(index + 1, std::memory_order_release);
+
+  std::thread([this, worker]() noexcept { RunWorker(*worker); }).detach();
+}
+
+void WorkStealingThreadPool::RunMonitor() noexcept {
+  // Tasks may block on events set by other queued tasks. If there is queued work, no worker is idle,
+  // and no work item was completed during the last interval, then all workers are blocked: add a worker.
+  uint64_t prevCompletedItems = m_completedItems.load(std::memory_order_relaxed);
+  for (;;) {
+    std::this_thread::sleep_for(MonitorInterval);
+
+    const uint64_t completedItems = m_completedItems.load(std::memory_order_relaxed);
+    if (completedItems == prevCompletedItems && m_queuedItems.load(std::memory_order_seq_cst) > 0 &&
+        m_idleWorkers.load(std::memory_order_seq_cst) == 0) {
+      AddWorker();
+    }
+
+    prevCompletedItems = completedItems;
+  }
+}
+
+void WorkStealingThreadPool::Submit(Mso::CntPtr<ThreadPoolSchedulerPortable> &&scheduler, bool isYielding) noexcept {
+  // A work item that yields after its time quota goes to the back of the shared queue.
+  // Otherwise it would be picked up again by the same worker ahead of the older work.
+  if (tls_worker && !isYielding) {
+    tls_worker->Deque.Push(scheduler.Detach());
+  } else {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_injected.push_back(scheduler.Detach());
+    m_injectedCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Paired with the m_idleWorkers increment in RunWorker: either the idle worker sees the new item
+  // before it goes to sleep, or we see the idle worker and wake it up.
+  m_queuedItems.fetch_add(1, std::memory_order_seq_cst);
+  if (m_idleWorkers.load(std::memory_order_seq_cst) > 0) {
+    WakeUpWorker();
+  }
+}
+
+void WorkStealingThreadPool::WakeUpWorker() noexcept {
+  // Notify under the lock to avoid missed signals when a worker is between checking the
+  // predicate and starting to wait.
+  std::lock_guard<std::mutex> lock{m_mutex};
+  m_wakeUp.notify_one();
+}
+
+void WorkStealingThreadPool::RunWorker(Worker &worker) noexcept {
+  tls_worker = &worker;
+
+  for (;;) {
+    if (ThreadPoolSchedulerPortable *item = TryTakeWork(worker)) {
+      m_queuedItems.fetch_sub(1, std::memory_order_relaxed);
+      Mso::CntPtr<ThreadPoolSchedulerPortable>{item, AttachTag}->RunWorkItem();
+      m_completedItems.fetch_add(1, std::memory_order_relaxed);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_idleWorkers.fetch_add(1, std::memory_order_seq_cst);
+    m_wakeUp.wait(lock, [this]() noexcept { return m_queuedItems.load(std::memory_order_seq_cst) > 0; });
+    m_idleWorkers.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+ThreadPoolSchedulerPortable *WorkStealingThreadPool::TryTakeWork(Worker &worker) noexcept {
+  if (ThreadPoolSchedulerPortable *item = worker.Deque.Pop()) {
+    return item;
+  }
+
+  if (ThreadPoolSchedulerPortable *item = TryTakeInjected()) {
+    return item;
+  }
+
+  return TrySteal(worker);
+}
+
+ThreadPoolSchedulerPortable *WorkStealingThreadPool::TryTakeInjected() noexcept {
+  if (m_injectedCount.load(std::memory_order_relaxed) == 0) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  if (m_injected.empty()) {
+    return nullptr;
+  }
+
+  ThreadPoolSchedulerPortable *item = m_injected.front();
+  m_injected.pop_front();
+  m_injectedCount.fetch_sub(1, std::memory_order_relaxed);
+  return item;
+}
+
+ThreadPoolSchedulerPortable *WorkStealingThreadPool::TrySteal(Worker &worker) noexcept {
+  // Start from a random victim so that the thieves do not all contend on the same deque.
+  uint32_t random = worker.RandomState;
+  random ^= random << 13;
+  random ^= random >> 17;
+  random ^= random << 5;
+  worker.RandomState = random;
+
+  const uint32_t workerCount = m_workerCount.load(std::memory_order_acquire);
+  const uint32_t start = random % workerCount;
+  for (uint32_t i = 0; i < workerCount; ++i) {
+    Worker &victim = *m_workers[(start + i) % workerCount];
+    if (&victim == &worker) {
+      continue;
+    }
+
+    if (ThreadPoolSchedulerPortable *item = victim.Deque.Steal()) {
+      return item;
+    }
+  }
+
+  return nullptr;
+}
+
+//=============================================================================
+// ThreadPoolSchedulerPortable implementation
+//=============================================================================
+
+/*static*/ thread_local ThreadPoolSchedulerPortable *ThreadPoolSchedulerPortable::tls_runningScheduler{nullptr};
+
+ThreadPoolSchedulerPortable::ThreadPoolSchedulerPortable(uint32_t maxThreads) noexcept
+    : m_maxThreads{maxThreads == 0 ? MaxConcurrentThreads : maxThreads} {}
+
+ThreadPoolSchedulerPortable::~ThreadPoolSchedulerPortable() noexcept {
+  AwaitTermination();
+}
+
+void ThreadPoolSchedulerPortable::RunWorkItem() noexcept {
+  // The work item holds a reference to the scheduler. It is alive until the work item is completed.
+  ThreadPoolSchedulerPortable *prevRunningScheduler = tls_runningScheduler;
+  tls_runningScheduler = this;
+
+  if (auto queue = m_queue.GetStrongPtr()) {
+    auto endTime = std::chrono::steady_clock::now() + 100ms;
+    bool isYielding = false;
+    DispatchTask task;
+    while (queue->TryDequeTask(task)) {
+      ThreadAccessGuard guard{this};
+      queue->InvokeTask(std::move(task), endTime);
+
+      if (std::chrono::steady_clock::now() > endTime) {
+        isYielding = true;
+        break;
+      }
+    }
+
+    --m_usedThreads; // We finished using this thread.
+
+    if (queue->HasTasks()) {
+      TrySubmit(isYielding);
+    }
+  }
+
+  tls_runningScheduler = prevRunningScheduler;
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  if (--m_pendingWork <= 1) {
+    m_workCompleted.notify_all();
+  }
+}
+
+void ThreadPoolSchedulerPortable::IntializeScheduler(Mso::WeakPtr<IDispatchQueueService> &&queue) noexcept {
+  m_queue = std::move(queue);
+}
+
+bool ThreadPoolSchedulerPortable::HasThreadAccess() noexcept {
+  return ThreadAccessGuard::HasThreadAccess(this);
+}
+
+bool ThreadPoolSchedulerPortable::IsSerial() noexcept {
+  return m_maxThreads == 1;
+}
+
+void ThreadPoolSchedulerPortable::Post() noexcept {
+  TrySubmit(/*isYielding:*/ false);
+}
+
+bool ThreadPoolSchedulerPortable::TrySubmit(bool isYielding) noexcept {
+  //! Submit a work item if number of used threads is below m_maxThreads
+  uint32_t usedThreads = m_usedThreads.load(std::memory_order_relaxed);
+  do {
+    if (usedThreads == m_maxThreads) {
+      return false;
+    }
+  } while (!m_usedThreads.compare_exchange_weak(
+      usedThreads, usedThreads + 1, std::memory_order_release, std::memory_order_relaxed));
+
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++m_pendingWork;
+  }
+
+  WorkStealingThreadPool::Instance().Submit(Mso::CntPtr<ThreadPoolSchedulerPortable>{this}, isYielding);
+  return true;
+}
+
+void ThreadPoolSchedulerPortable::Shutdown() noexcept {
+  // It is not used by this scheduler
+}
+
+void ThreadPoolSchedulerPortable::AwaitTermination() noexcept {
+  // When called from our own work item, e.g. when the last queue reference is released by a task,
+  // we cannot wait for that work item to complete.
+  const uint32_t ownWork = (tls_runningScheduler == this) ? 1 : 0;
+
+  std::unique_lock<std::mutex> lock{m_mutex};
+  m_workCompleted.wait(lock, [this, ownWork]() noexcept { return m_pendingWork <= ownWork; });
+}
+
+//=============================================================================
+// ThreadPoolSchedulerPortable::ThreadAccessGuard implementation
+//=============================================================================
+
+/*static*/ thread_local ThreadPoolSchedulerPortable
+    *ThreadPoolSchedulerPortable::ThreadAccessGuard::tls_scheduler{nullptr};
+
+ThreadPoolSchedulerPortable::ThreadAccessGuard::ThreadAccessGuard(ThreadPoolSchedulerPortable *scheduler) noexcept
+    : m_prevScheduler{tls_scheduler} {
+  tls_scheduler = scheduler;
+}
+
+ThreadPoolSchedulerPortable::ThreadAccessGuard::~ThreadAccessGuard() noexcept {
+  tls_scheduler = m_prevScheduler;
+}
+
+/*static*/ bool ThreadPoolSchedulerPortable::ThreadAccessGuard::HasThreadAccess(
+    ThreadPoolSchedulerPortable *scheduler) noexcept {
+  return tls_scheduler == scheduler;
+}
+
+//=============================================================================
+// DispatchQueueStatic::MakeThreadPoolScheduler implementation
+//=============================================================================
+
+/*static*/ Mso::CntPtr<IDispatchQueueScheduler> DispatchQueueStatic::MakeThreadPoolScheduler(
+    uint32_t maxThreads) noexcept {
+  return Mso::Make<ThreadPoolSchedulerPortable, IDispatchQueueScheduler>(maxThreads);
+}
+
+} // namespace Mso
+
+#endif // defined(MS_TARGET_POSIX) || defined(MSO_PORTABLE_THREADPOOL)
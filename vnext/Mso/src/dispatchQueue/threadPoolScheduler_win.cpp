@@ -1,6 +1,9 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT license.
 
+// The Win32 thread pool scheduler. Define MSO_PORTABLE_THREADPOOL to use threadPoolScheduler_portable.cpp instead.
+#if !defined(MS_TARGET_POSIX) && !defined(MSO_PORTABLE_THREADPOOL)
+
 #include "dispatchQueue/dispatchQueue.h"
 #include "queueService.h"
 
@@ -161,3 +164,5 @@ ThreadPoolSchedulerWin::ThreadAccessGuard::~ThreadAccessGuard() noexcept {
 }
 
 } // namespace Mso
+
+#endif // !defined(MS_TARGET_POSIX) && !defined(MSO_PORTABLE_THREADPOOL)
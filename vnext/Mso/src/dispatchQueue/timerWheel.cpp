@@ -0,0 +1,365 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "timerWheel.h"
+#include <thread>
+#include "queueService.h"
+
+namespace Mso {
+
+//=============================================================================
+// TimerLink implementation.
+//=============================================================================
+
+TimerLink::TimerLink(DelayedTask *owner) noexcept : Owner{owner} {}
+
+bool TimerLink::IsLinked() const noexcept {
+  return Next != this;
+}
+
+void TimerLink::LinkBefore(TimerLink &next) noexcept {
+  Prev = next.Prev;
+  Next = &next;
+  next.Prev->Next = this;
+  next.Prev = this;
+}
+
+void TimerLink::Unlink() noexcept {
+  Prev->Next = Next;
+  Next->Prev = Prev;
+  Prev = this;
+  Next = this;
+}
+
+//=============================================================================
+// DelayedTask implementation.
+//=============================================================================
+
+DelayedTask::DelayedTask(QueueService *queue, DispatchTask &&task, uint64_t dueTick) noexcept
+    : m_queue{queue}, m_task{std::move(task)}, m_dueTick{dueTick} {}
+
+bool DelayedTask::Cancel() noexcept {
+  return TimerWheel::Instance().Cancel(*this);
+}
+
+//=============================================================================
+// TimerWheel implementation.
+//=============================================================================
+
+/*static*/ TimerWheel &TimerWheel::Instance() noexcept {
+  // The wheel is never destroyed because its thread may still run during the static objects destruction.
+  static TimerWheel *instance{new TimerWheel()};
+  return *instance;
+}
+
+TimerWheel::TimerWheel() noexcept : m_startTime{std::chrono::steady_clock::now()} {}
+
+Mso::CntPtr<IDispatchTimer> TimerWheel::Schedule(
+    DelayedTaskList &list,
+    QueueService *queue,
+    std::chrono::steady_clock::time_point dueTime,
+    DispatchTask &&task) noexcept {
+  // Round the due tick up to never post a task before its due time.
+  uint64_t dueTick = ToTick(dueTime);
+  if (ToTime(dueTick) < dueTime) {
+    ++dueTick;
+  }
+
+  auto delayedTask = Mso::Make<DelayedTask>(queue, std::move(task), dueTick);
+  bool isClosed{false};
+  bool isWakeUpNeeded{false};
+
+  {
+    std::lock_guard lock{m_mutex};
+    isClosed = list.IsClosed;
+    if (!isClosed) {
+      if (!m_isThreadStarted) {
+        m_isThreadStarted = true;
+        std::thread([this]() noexcept { Run(); }).detach();
+      }
+
+      // The wheel may have already processed the due tick. Then the task is posted on the next tick.
+      delayedTask->m_dueTick = (std::max)(delayedTask->m_dueTick, m_currentTick);
+      AddToWheel(*delayedTask);
+      delayedTask->m_queueLink.LinkBefore(list.Head);
+      ++m_pendingCount;
+      isWakeUpNeeded = delayedTask->m_dueTick < m_wakeUpTick;
+
+      // The wheel owns one reference while the task is pending.
+      Mso::CntPtr<DelayedTask>{delayedTask}.Detach();
+    }
+  }
+
+  if (isClosed) {
+    CancelTask(std::move(delayedTask->m_task));
+    return nullptr;
+  }
+
+  if (isWakeUpNeeded) {
+    m_wakeUp.notify_one();
+  }
+
+  return delayedTask;
+}
+
+bool TimerWheel::Cancel(DelayedTask &delayedTask) noexcept {
+  DispatchTask task;
+
+  {
+    std::lock_guard lock{m_mutex};
+    if (!delayedTask.m_wheelLink.IsLinked()) {
+      return false;
+    }
+
+    RemovePending(delayedTask);
+    --m_pendingCount;
+    task = std::move(delayedTask.m_task);
+  }
+
+  CancelTask(std::move(task));
+
+  // Release the reference owned by the wheel.
+  Mso::CntPtr<DelayedTask>{&delayedTask, AttachTag};
+  return true;
+}
+
+void TimerWheel::CloseList(DelayedTaskList &list) noexcept {
+  std::vector<Mso::CntPtr<DelayedTask>> tasksToCancel;
+
+  {
+    std::lock_guard lock{m_mutex};
+    list.IsClosed = true;
+    while (list.Head.IsLinked()) {
+      DelayedTask &delayedTask = *list.Head.Next->Owner;
+      RemovePending(delayedTask);
+      --m_pendingCount;
+      tasksToCancel.emplace_back(&delayedTask, AttachTag);
+    }
+  }
+
+  for (auto &delayedTask : tasksToCancel) {
+    CancelTask(std::move(delayedTask->m_task));
+  }
+}
+
+/*static*/ void TimerWheel::CancelTask(DispatchTask &&task) noexcept {
+  DispatchTask taskToCancel{std::move(task)};
+  if (auto cancellation = query_cast<ICancellationListener *>(taskToCancel.Get())) {
+    cancellation->OnCancel();
+  }
+}
+
+void TimerWheel::Run() noexcept {
+  std::vector<Mso::CntPtr<DelayedTask>> dueTasks;
+  std::unique_lock lock{m_mutex};
+  for (;;) {
+    TakeDueTasks(ToTick(std::chrono::steady_clock::now()), /*out*/ dueTasks);
+    if (!dueTasks.empty()) {
+      lock.unlock();
+      for (auto &delayedTask : dueTasks) {
+        if (auto queue = delayedTask->m_queue.GetStrongPtr()) {
+          queue->Post(std::move(delayedTask->m_task));
+        } else {
+          CancelTask(std::move(delayedTask->m_task));
+        }
+      }
+
+      dueTasks.clear();
+      lock.lock();
+      continue;
+    }
+
+    m_wakeUpTick = GetWakeUpTick();
+    if (m_wakeUpTick == UINT64_MAX) {
+      m_wakeUp.wait(lock);
+    } else {
+      m_wakeUp.wait_until(lock, ToTime(m_wakeUpTick));
+    }
+  }
+}
+
+uint64_t TimerWheel::ToTick(std::chrono::steady_clock::time_point time) const noexcept {
+  if (time <= m_startTime) {
+    return 0;
+  }
+
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time - m_startTime).count());
+}
+
+std::chrono::steady_clock::time_point TimerWheel::ToTime(uint64_t tick) const noexcept {
+  return m_startTime + std::chrono::milliseconds(tick);
+}
+
+size_t TimerWheel::GetSlotIndex(uint64_t dueTick) const noexcept {
+  const uint64_t delay = dueTick - m_currentTick;
+  if (delay < FirstLevelSize) {
+    return static_cast<size_t>(dueTick & (FirstLevelSize - 1));
+  }
+
+  // Tasks beyond the last level are placed to its farthest slot. They are redistributed again when the slot
+  // is cascaded.
+  constexpr uint32_t maxDelayBits{FirstLevelBits + (LevelCount - 1) * LevelBits};
+  if (delay >= (uint64_t{1} << maxDelayBits)) {
+    dueTick = m_currentTick + (uint64_t{1} << maxDelayBits) - 1;
+  }
+
+  size_t level{1};
+  uint32_t shift{FirstLevelBits};
+  while (delay >= (uint64_t{1} << (shift + LevelBits)) && level < LevelCount - 1) {
+    shift += LevelBits;
+    ++level;
+  }
+
+  return static_cast<size_t>(FirstLevelSize + (level - 1) * LevelSize + ((dueTick >> shift) & (LevelSize - 1)));
+}
+
+void TimerWheel::AddToWheel(DelayedTask &delayedTask) noexcept {
+  delayedTask.m_slotIndex = GetSlotIndex(delayedTask.m_dueTick);
+  delayedTask.m_wheelLink.LinkBefore(m_slots[delayedTask.m_slotIndex]);
+  SetSlotOccupied(delayedTask.m_slotIndex, true);
+}
+
+void TimerWheel::Cascade(size_t level, uint64_t tick) noexcept {
+  const uint32_t shift{FirstLevelBits + static_cast<uint32_t>(level - 1) * LevelBits};
+  const size_t slotIndex = FirstLevelSize + (level - 1) * LevelSize + ((tick >> shift) & (LevelSize - 1));
+  TimerLink &slot = m_slots[slotIndex];
+
+  // Detach the slot list first because the tasks may be added back to the same slot.
+  TimerLink tasks;
+  if (slot.IsLinked()) {
+    tasks.LinkBefore(slot);
+    slot.Unlink();
+    SetSlotOccupied(slotIndex, false);
+  }
+
+  while (tasks.IsLinked()) {
+    DelayedTask &delayedTask = *tasks.Next->Owner;
+    delayedTask.m_wheelLink.Unlink();
+    AddToWheel(delayedTask);
+  }
+}
+
+void TimerWheel::TakeDueTasks(uint64_t nowTick, std::vector<Mso::CntPtr<DelayedTask>> &dueTasks) noexcept {
+  while (m_pendingCount > 0) {
+    // Skip the ticks that have neither due tasks nor cascades.
+    const uint64_t tick = GetNextEventTick();
+    if (tick > nowTick) {
+      break;
+    }
+
+    m_currentTick = tick;
+    if ((tick & (FirstLevelSize - 1)) == 0) {
+      // Cascade the next level when the previous level completes its round.
+      for (size_t level = 1; level < LevelCount; ++level) {
+        Cascade(level, tick);
+        const uint32_t shift{FirstLevelBits + static_cast<uint32_t>(level - 1) * LevelBits};
+        if (((tick >> shift) & (LevelSize - 1)) != 0) {
+          break;
+        }
+      }
+    }
+
+    TimerLink &slot = m_slots[tick & (FirstLevelSize - 1)];
+    while (slot.IsLinked()) {
+      DelayedTask &delayedTask = *slot.Next->Owner;
+      RemovePending(delayedTask);
+      --m_pendingCount;
+      dueTasks.emplace_back(&delayedTask, AttachTag);
+    }
+
+    ++m_currentTick;
+  }
+
+  // All ticks up to now are processed.
+  if (m_currentTick <= nowTick) {
+    m_currentTick = nowTick + 1;
+  }
+}
+
+uint64_t TimerWheel::GetWakeUpTick() const noexcept {
+  if (m_pendingCount == 0) {
+    return UINT64_MAX;
+  }
+
+  return GetNextEventTick();
+}
+
+uint64_t TimerWheel::GetNextEventTick() const noexcept {
+  // The first level slot of a tick is processed at that tick. A slot of the next levels is cascaded at the first
+  // tick of its time span. Slots before the current position of a level are processed in the next round.
+  uint64_t nextTick{UINT64_MAX};
+  for (size_t level = 0; level < LevelCount; ++level) {
+    const uint32_t shift{level == 0 ? 0 : FirstLevelBits + static_cast<uint32_t>(level - 1) * LevelBits};
+    const uint32_t bits{level == 0 ? FirstLevelBits : LevelBits};
+    const size_t firstSlot{level == 0 ? 0 : static_cast<size_t>(FirstLevelSize + (level - 1) * LevelSize)};
+    const size_t slotCount{size_t{1} << bits};
+
+    size_t startIndex = static_cast<size_t>((m_currentTick >> shift) & (slotCount - 1));
+    if ((m_currentTick & ((uint64_t{1} << shift) - 1)) != 0) {
+      // The current slot of this level is already cascaded.
+      ++startIndex;
+    }
+
+    const size_t index = FindOccupiedSlot(firstSlot, slotCount, startIndex);
+    if (index != SIZE_MAX) {
+      const uint64_t roundStart = (m_currentTick >> (shift + bits)) << (shift + bits);
+      nextTick = (std::min)(nextTick, roundStart + (uint64_t{index} << shift));
+    }
+  }
+
+  return nextTick;
+}
+
+size_t TimerWheel::FindOccupiedSlot(size_t firstSlot, size_t slotCount, size_t startIndex) const noexcept {
+  // Returns the index of the first occupied slot at or after the start index, or the index of the first occupied
+  // slot plus the slot count if it is only found before the start index. Returns SIZE_MAX if all slots are empty.
+  auto findFrom = [this, firstSlot, slotCount](size_t index) noexcept -> size_t {
+    while (index < slotCount) {
+      const size_t slot = firstSlot + index;
+      const uint64_t word = m_occupiedSlots[slot / 64] >> (slot % 64);
+      if (word == 0) {
+        index += 64 - slot % 64;
+        continue;
+      }
+
+      uint64_t bit = word;
+      while ((bit & 1) == 0) {
+        bit >>= 1;
+        ++index;
+      }
+
+      return index < slotCount ? index : SIZE_MAX;
+    }
+
+    return SIZE_MAX;
+  };
+
+  size_t index = findFrom(startIndex);
+  if (index == SIZE_MAX && startIndex > 0) {
+    index = findFrom(0);
+    if (index != SIZE_MAX) {
+      index += slotCount;
+    }
+  }
+
+  return index;
+}
+
+void TimerWheel::SetSlotOccupied(size_t slotIndex, bool isOccupied) noexcept {
+  const uint64_t mask = uint64_t{1} << (slotIndex % 64);
+  if (isOccupied) {
+    m_occupiedSlots[slotIndex / 64] |= mask;
+  } else {
+    m_occupiedSlots[slotIndex / 64] &= ~mask;
+  }
+}
+
+void TimerWheel::RemovePending(DelayedTask &delayedTask) noexcept {
+  delayedTask.m_wheelLink.Unlink();
+  delayedTask.m_queueLink.Unlink();
+  if (!m_slots[delayedTask.m_slotIndex].IsLinked()) {
+    SetSlotOccupied(delayedTask.m_slotIndex, false);
+  }
+}
+
+} // namespace Mso
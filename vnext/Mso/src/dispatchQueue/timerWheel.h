@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include "dispatchQueue/dispatchQueue.h"
+#include "object/weakPtr.h"
+
+namespace Mso {
+
+struct DelayedTask;
+struct QueueService;
+
+//! Intrusive link of a circular doubly linked list. An unlinked link points to itself.
+struct TimerLink {
+  TimerLink() noexcept = default;
+  TimerLink(DelayedTask *owner) noexcept;
+
+  TimerLink(TimerLink const &other) = delete;
+  TimerLink &operator=(TimerLink const &other) = delete;
+
+  bool IsLinked() const noexcept;
+  void LinkBefore(TimerLink &next) noexcept;
+  void Unlink() noexcept;
+
+  TimerLink *Prev{this};
+  TimerLink *Next{this};
+  DelayedTask *const Owner{nullptr};
+};
+
+//! Delayed tasks of a dispatch queue. They are canceled together on queue shutdown.
+//! The list is only accessed under the timer wheel lock.
+struct DelayedTaskList {
+  TimerLink Head;
+  bool IsClosed{false};
+};
+
+//! A task that waits in the timer wheel for its due time and then is posted to its queue.
+//! The timer wheel owns one reference to the DelayedTask while it is pending.
+struct DelayedTask final : Mso::UnknownObject<IDispatchTimer> {
+  DelayedTask(QueueService *queue, DispatchTask &&task, uint64_t dueTick) noexcept;
+
+ public: // IDispatchTimer
+  bool Cancel() noexcept override;
+
+ private:
+  friend struct TimerWheel;
+
+  const Mso::WeakPtr<QueueService> m_queue;
+  DispatchTask m_task;
+  uint64_t m_dueTick;
+  size_t m_slotIndex{0};
+  TimerLink m_wheelLink{this};
+  TimerLink m_queueLink{this};
+};
+
+//! Process-wide hierarchical timer wheel shared by all dispatch queues.
+//!
+//! The wheel has a resolution of one millisecond tick. The first level has a slot for each of the next 256 ticks.
+//! Each of the next three levels has 64 slots that cover 64 times longer time spans than the slots of the previous
+//! level. When the first level completes its round, the tasks of the next slot of the second level are redistributed
+//! to the lower levels, and so on. It makes adding and canceling a task O(1), independent of the number of pending
+//! tasks. Due tasks are posted to their queues from a dedicated thread.
+//!
+//! A bitmask of non-empty slots lets the wheel jump over the ticks without due tasks or cascades, so the wheel
+//! thread does not walk the ticks one by one after it was not scheduled for a long time.
+struct TimerWheel {
+  static TimerWheel &Instance() noexcept;
+
+  //! Schedule the task to be posted to the queue at the due time. If the list is closed, then the task is canceled.
+  Mso::CntPtr<IDispatchTimer> Schedule(
+      DelayedTaskList &list,
+      QueueService *queue,
+      std::chrono::steady_clock::time_point dueTime,
+      DispatchTask &&task) noexcept;
+
+  //! Remove the pending task from the wheel and cancel it. Returns false if the task is not pending.
+  bool Cancel(DelayedTask &delayedTask) noexcept;
+
+  //! Cancel all pending tasks in the list and cancel the tasks scheduled to the list later.
+  void CloseList(DelayedTaskList &list) noexcept;
+
+  //! Cancel the task by calling its ICancellationListener::OnCancel if the task implements it.
+  static void CancelTask(DispatchTask &&task) noexcept;
+
+ private:
+  TimerWheel() noexcept;
+
+  void Run() noexcept;
+  uint64_t ToTick(std::chrono::steady_clock::time_point time) const noexcept;
+  std::chrono::steady_clock::time_point ToTime(uint64_t tick) const noexcept;
+  size_t GetSlotIndex(uint64_t dueTick) const noexcept;
+  void AddToWheel(DelayedTask &delayedTask) noexcept;
+  void Cascade(size_t level, uint64_t tick) noexcept;
+  void TakeDueTasks(uint64_t nowTick, std::vector<Mso::CntPtr<DelayedTask>> &dueTasks) noexcept;
+  uint64_t GetWakeUpTick() const noexcept;
+  uint64_t GetNextEventTick() const noexcept;
+  size_t FindOccupiedSlot(size_t firstSlot, size_t slotCount, size_t startIndex) const noexcept;
+  void SetSlotOccupied(size_t slotIndex, bool isOccupied) noexcept;
+  void RemovePending(DelayedTask &delayedTask) noexcept;
+
+ private:
+  constexpr static uint32_t FirstLevelBits{8};
+  constexpr static uint32_t LevelBits{6};
+  constexpr static size_t LevelCount{4};
+  constexpr static uint64_t FirstLevelSize{uint64_t{1} << FirstLevelBits};
+  constexpr static uint64_t LevelSize{uint64_t{1} << LevelBits};
+  constexpr static size_t SlotCount{FirstLevelSize + (LevelCount - 1) * LevelSize};
+  static_assert(SlotCount % 64 == 0, "Each level of the wheel must fill whole words of the slot bitmask.");
+
+  const std::chrono::steady_clock::time_point m_startTime;
+  std::mutex m_mutex;
+  std::condition_variable m_wakeUp;
+  std::array<TimerLink, SlotCount> m_slots;
+  std::array<uint64_t, SlotCount / 64> m_occupiedSlots{}; // A bit for each non-empty slot.
+  uint64_t m_currentTick{0}; // The next tick to process.
+  uint64_t m_wakeUpTick{UINT64_MAX}; // The tick the wheel thread waits for.
+  size_t m_pendingCount{0};
+  bool m_isThreadStarted{false};
+};
+
+} // namespace Mso
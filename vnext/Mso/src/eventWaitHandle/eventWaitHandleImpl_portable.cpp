@@ -0,0 +1,264 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// Portable event wait handle. It is used on platforms without the Win32 synchronization APIs,
+// and on Windows when MSO_PORTABLE_EVENTWAITHANDLE is defined.
+#if defined(MS_TARGET_POSIX) || defined(MSO_PORTABLE_EVENTWAITHANDLE)
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include "eventWaitHandle/eventWaitHandle.h"
+#include "object/refCountedObject.h"
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <ctime>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
+namespace Mso {
+
+namespace {
+
+//! Hints the processor that the thread is in a spin loop.
+inline void CpuRelax() noexcept {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  _mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
+#if defined(__linux__)
+
+//! Parks threads on the address of a 32-bit atomic word using the Linux futex.
+//! The kernel keeps the wait queue. A wake-up does not access the word memory, and it is safe to call it after
+//! the word is freed.
+struct ParkingLot {
+  //! Blocks while the word has the expected value, until woken up or until the deadline.
+  //! Returns false if the deadline is reached. Spurious returns are possible.
+  static bool WaitUntil(
+      std::atomic<uint32_t> &word,
+      uint32_t expected,
+      const std::chrono::steady_clock::time_point *deadline) noexcept {
+    timespec timeout{};
+    if (deadline) {
+      auto timeLeft = *deadline - std::chrono::steady_clock::now();
+      if (timeLeft <= std::chrono::steady_clock::duration::zero()) {
+        return false;
+      }
+
+      auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeLeft);
+      timeout.tv_sec = static_cast<time_t>(seconds.count());
+      timeout.tv_nsec = static_cast<long>(std::chrono::nanoseconds(timeLeft - seconds).count());
+    }
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The futex word must be a plain 32-bit integer");
+    if (syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t *>(&word),
+            FUTEX_WAIT_PRIVATE,
+            expected,
+            deadline ? &timeout : nullptr,
+            nullptr,
+            0) != 0) {
+      VerifyElseCrashSz(errno == EAGAIN || errno == EINTR || errno == ETIMEDOUT, "futex wait failed.");
+      return errno != ETIMEDOUT;
+    }
+
+    return true;
+  }
+
+  static void WakeOne(std::atomic<uint32_t> &word) noexcept {
+    Wake(word, 1);
+  }
+
+  static void WakeAll(std::atomic<uint32_t> &word) noexcept {
+    Wake(word, (std::numeric_limits<int>::max)());
+  }
+
+ private:
+  static void Wake(std::atomic<uint32_t> &word, int count) noexcept {
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+  }
+};
+
+#else
+
+//! Parks threads on the address of a 32-bit atomic word using a process-wide table of mutexes and condition
+//! variables indexed by the word address. The buckets are only used by the threads that park and by the wake-ups
+//! for the parked threads. A wake-up does not access the word memory, and it is safe to call it after the word is
+//! freed.
+struct ParkingLot {
+  //! Blocks while the word has the expected value, until woken up or until the deadline.
+  //! Returns false if the deadline is reached. Spurious returns are possible.
+  static bool WaitUntil(
+      std::atomic<uint32_t> &word,
+      uint32_t expected,
+      const std::chrono::steady_clock::time_point *deadline) noexcept {
+    Bucket &bucket = GetBucket(&word);
+    std::unique_lock<std::mutex> lock{bucket.Mutex};
+    if (word.load(std::memory_order_relaxed) != expected) {
+      return true;
+    }
+
+    if (!deadline) {
+      bucket.Condition.wait(lock);
+      return true;
+    }
+
+    return bucket.Condition.wait_until(lock, *deadline) == std::cv_status::no_timeout;
+  }
+
+  static void WakeOne(std::atomic<uint32_t> &word) noexcept {
+    // The bucket may be shared by other words. Thus, all its threads are woken up.
+    WakeAll(word);
+  }
+
+  static void WakeAll(std::atomic<uint32_t> &word) noexcept {
+    // Take the lock to not miss a thread that checked the word but has not started waiting yet.
+    Bucket &bucket = GetBucket(&word);
+    std::lock_guard<std::mutex> lock{bucket.Mutex};
+    bucket.Condition.notify_all();
+  }
+
+ private:
+  struct Bucket {
+    std::mutex Mutex;
+    std::condition_variable Condition;
+  };
+
+  static Bucket &GetBucket(const void *address) noexcept {
+    constexpr size_t bucketCount{64};
+    // The buckets are never destroyed because threads may still use them during the static objects destruction.
+    static Bucket *s_buckets{new Bucket[bucketCount]};
+    return s_buckets[(reinterpret_cast<uintptr_t>(address) / sizeof(uint32_t)) % bucketCount];
+  }
+};
+
+#endif
+
+//! Implementation of the IEventWaitHandle interface based on a single atomic word.
+//!
+//! The lowest bit of the word is the signaled state, and the rest of the word counts parked threads.
+//! Set and Reset are a single atomic operation, and Set only makes a system call when there are parked threads.
+//! Wait first spins for a short time because the event is often set soon by a thread running on another core.
+class EventWaitHandle final : public Mso::RefCountedObject<IEventWaitHandle> {
+ public:
+  EventWaitHandle(bool isAutoReset, EventWaitHandleState state) noexcept
+      : m_isAutoReset{isAutoReset}, m_word{state == EventWaitHandleState::IsSet ? IsSetBit : 0u} {}
+
+ public: // IEventWaitHandle
+  void Set() const noexcept override {
+    // A released thread may destroy the event as soon as it observes the signaled state.
+    // Thus, after the fetch_or the event memory is not accessed: the wake-up only uses the word address.
+    const bool isAutoReset = m_isAutoReset;
+    std::atomic<uint32_t> &wordRef = m_word;
+    const uint32_t word = m_word.fetch_or(IsSetBit, std::memory_order_release);
+    if (word >= WaiterIncrement) {
+      if (isAutoReset) {
+        ParkingLot::WakeOne(wordRef);
+      } else {
+        ParkingLot::WakeAll(wordRef);
+      }
+    }
+  }
+
+  void Reset() const noexcept override {
+    m_word.fetch_and(~IsSetBit, std::memory_order_relaxed);
+  }
+
+  bool Wait() const noexcept override {
+    return WaitUntil(nullptr);
+  }
+
+  bool WaitFor(const std::chrono::milliseconds &waitDuration) const noexcept override {
+    VerifyElseCrashSz(
+        waitDuration.count() < std::numeric_limits<uint32_t>::max(),
+        "waitDuration must not exceed uint32_t size for milliseconds.");
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto deadline = now + waitDuration;
+    VerifyElseCrashSz(deadline >= now, "waitDuration causes clock overflow");
+
+    return WaitUntil(&deadline);
+  }
+
+ private:
+  //! Consumes the signal for the auto reset event. Returns true if the event is set.
+  bool TryAcquire() const noexcept {
+    uint32_t word = m_word.load(std::memory_order_acquire);
+    while (word & IsSetBit) {
+      if (!m_isAutoReset ||
+          m_word.compare_exchange_weak(word, word & ~IsSetBit, std::memory_order_acquire, std::memory_order_acquire)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool WaitUntil(const std::chrono::steady_clock::time_point *deadline) const noexcept {
+    // Spinning only helps when the thread that sets the event can run at the same time.
+    static const uint32_t s_spinCount{std::thread::hardware_concurrency() > 1 ? MaxSpinCount : 0};
+    for (uint32_t i = 0; i < s_spinCount; ++i) {
+      if (TryAcquire()) {
+        return true;
+      }
+
+      CpuRelax();
+    }
+
+    for (;;) {
+      if (TryAcquire()) {
+        return true;
+      }
+
+      // Register as a parked thread. Set wakes up parked threads only when it sees them in the word.
+      const uint32_t word = m_word.fetch_add(WaiterIncrement, std::memory_order_acquire) + WaiterIncrement;
+      bool isTimedOut = false;
+      if (!(word & IsSetBit)) {
+        isTimedOut = !ParkingLot::WaitUntil(m_word, word, deadline);
+      }
+
+      m_word.fetch_sub(WaiterIncrement, std::memory_order_relaxed);
+      if (isTimedOut) {
+        return TryAcquire();
+      }
+    }
+  }
+
+ private:
+  constexpr static uint32_t IsSetBit{1};
+  constexpr static uint32_t WaiterIncrement{2};
+  constexpr static uint32_t MaxSpinCount{128};
+
+  const bool m_isAutoReset;
+  mutable std::atomic<uint32_t> m_word;
+};
+
+} // namespace
+
+LIBLET_PUBLICAPI ManualResetEvent::ManualResetEvent(EventWaitHandleState state) noexcept
+    : m_handle{Mso::Make<EventWaitHandle>(/*isAutoReset:*/ false, state)} {}
+
+LIBLET_PUBLICAPI AutoResetEvent::AutoResetEvent(EventWaitHandleState state) noexcept
+    : m_handle{Mso::Make<EventWaitHandle>(/*isAutoReset:*/ true, state)} {}
+
+} // namespace Mso
+
+#endif // defined(MS_TARGET_POSIX) || defined(MSO_PORTABLE_EVENTWAITHANDLE)
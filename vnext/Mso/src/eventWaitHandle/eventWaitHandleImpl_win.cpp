@@ -1,6 +1,9 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT license.
 
+// The Win32 event wait handle. Define MSO_PORTABLE_EVENTWAITHANDLE to use eventWaitHandleImpl_portable.cpp instead.
+#if !defined(MS_TARGET_POSIX) && !defined(MSO_PORTABLE_EVENTWAITHANDLE)
+
 #include <synchapi.h>
 #include <algorithm>
 #include "eventWaitHandleImpl.h"
@@ -81,3 +84,5 @@ LIBLET_PUBLICAPI AutoResetEvent::AutoResetEvent(EventWaitHandleState state) noex
     : m_handle{Mso::Make<EventWaitHandle<SRWMutex, ConditionVariable>>(/*isAutoReset:*/ true, state)} {}
 
 } // namespace Mso
+
+#endif // !defined(MS_TARGET_POSIX) && !defined(MSO_PORTABLE_EVENTWAITHANDLE)
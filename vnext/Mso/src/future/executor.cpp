@@ -2,9 +2,22 @@
 // Licensed under the MIT license.
 
 #include "future/details/executor.h"
+#include <atomic>
+#include "future/details/ifuture.h"
 
 namespace Mso::Executors {
 
+namespace {
+
+// Max number of nested inline invocations of ready continuations in a thread.
+constexpr uint32_t MaxInlineDepth{16};
+
+thread_local uint32_t s_inlineDepth{0};
+std::atomic<uint64_t> s_invokedInlineCount{0};
+std::atomic<uint64_t> s_postedCount{0};
+
+} // namespace
+
 Executor::Executor(DispatchQueue const &queue) noexcept : m_queue{queue} {}
 
 Executor::Executor(DispatchQueue &&queue) noexcept : m_queue{std::move(queue)} {}
@@ -26,4 +39,22 @@ void Inline::Post(DispatchTask &&task) noexcept {
   task = nullptr;
 }
 
+bool Internal::TryInvokeReadyTask(DispatchTask &task) noexcept {
+  if (s_inlineDepth >= MaxInlineDepth || !Mso::Futures::IsPostingReadyContinuation()) {
+    s_postedCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  s_invokedInlineCount.fetch_add(1, std::memory_order_relaxed);
+  ++s_inlineDepth;
+  task.Get()->Invoke();
+  task = nullptr;
+  --s_inlineDepth;
+  return true;
+}
+
+InlineIfReadyCounters GetInlineIfReadyCounters() noexcept {
+  return {s_invokedInlineCount.load(std::memory_order_relaxed), s_postedCount.load(std::memory_order_relaxed)};
+}
+
 } // namespace Mso::Executors
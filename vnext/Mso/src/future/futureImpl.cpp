@@ -3,6 +3,7 @@
 
 #include "futureImpl.h"
 #include <thread>
+#include <utility>
 #include "eventWaitHandle/eventWaitHandle.h"
 #include "future/future.h"
 
@@ -176,6 +177,9 @@ bool FuturePackedData::IsFailed() const noexcept {
 
 static thread_local FutureImpl *s_currentFutureTls;
 
+// The continuation that is posted synchronously from AddContinuation because its parent is already completed.
+static thread_local const FutureImpl *s_readyContinuationTls;
+
 struct CurrentFutureImpl {
   explicit CurrentFutureImpl(FutureImpl &current) noexcept : m_previous(s_currentFutureTls) {
     s_currentFutureTls = &current;
@@ -193,6 +197,10 @@ struct CurrentFutureImpl {
   FutureImpl *m_previous;
 };
 
+LIBLET_PUBLICAPI bool IsPostingReadyContinuation() noexcept {
+  return s_readyContinuationTls != nullptr && s_readyContinuationTls == s_currentFutureTls;
+}
+
 //=============================================================================
 //
 // FutureImpl implementation
@@ -365,7 +373,10 @@ void FutureImpl::AddContinuation(Mso::CntPtr<IFuture> &&continuation) noexcept {
             contFuture->m_link.IsEmpty(),
             "All existing continuations must be already executed",
             0x014441c2 /* tag_brehc */);
+        // Let the executor know that the continuation is posted from the AddContinuation call.
+        const FutureImpl *previousReadyContinuation = std::exchange(s_readyContinuationTls, contFuturePtr);
         PostContinuation(std::move(contFuture));
+        s_readyContinuationTls = previousReadyContinuation;
       } else {
         // m_stateAndContinuation now owns the reference.
         contFuture.Detach();
@@ -0,0 +1,364 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "memoryApi/smallBlockPool.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include "memoryApi/memoryApi.h"
+
+namespace Mso {
+namespace Memory {
+
+namespace {
+
+struct ThreadCache;
+
+//! Header stored in front of every block. It is never changed while the block is in use or on a free list.
+struct alignas(SmallBlockAlignment) BlockHeader {
+  //! The cache that carved the block from its slab, or null for blocks allocated with AllocateEx.
+  ThreadCache *Owner;
+  uint32_t SizeClass;
+};
+
+//! Free list link. It is stored in the block payload.
+struct FreeBlock {
+  FreeBlock *Next;
+};
+
+//! Header stored in front of every slab. The slabs of a cache are linked to free them when the cache is drained.
+struct alignas(SmallBlockAlignment) SlabHeader {
+  SlabHeader *Next;
+};
+
+constexpr size_t SizeClassGranularity{16};
+constexpr size_t SizeClassCount{SmallBlockMaxSize / SizeClassGranularity};
+constexpr size_t SlabSize{16 * 1024};
+
+static_assert(SmallBlockMaxSize % SizeClassGranularity == 0, "SmallBlockMaxSize must be a multiple of granularity");
+static_assert(SizeClassGranularity % SmallBlockAlignment == 0, "Block strides must keep the blocks aligned");
+static_assert(sizeof(BlockHeader) % SmallBlockAlignment == 0, "Block payload must be aligned");
+static_assert(sizeof(SlabHeader) % SmallBlockAlignment == 0, "Slab blocks must be aligned");
+static_assert(sizeof(FreeBlock) <= SizeClassGranularity, "Free list link must fit the smallest block");
+
+constexpr size_t BlockStride(uint32_t sizeClass) noexcept {
+  return sizeof(BlockHeader) + (sizeClass + 1) * SizeClassGranularity;
+}
+
+FreeBlock *ToFreeBlock(BlockHeader *header) noexcept {
+  return reinterpret_cast<FreeBlock *>(header + 1);
+}
+
+BlockHeader *ToHeader(void *block) noexcept {
+  return static_cast<BlockHeader *>(block) - 1;
+}
+
+std::atomic<size_t> s_backingAllocationCount{0};
+
+// Blocks that did not fit a size class or were allocated while a thread was exiting.
+std::atomic<size_t> s_outstandingLargeBlockCount{0};
+
+//! Allocates memory for slabs, caches, and large blocks. The slabs and caches outlive the blocks carved from them and
+//! are not leaks by themselves: leaks of pooled blocks are detected with GetSmallBlockPoolOutstandingBlockCount.
+//! AllocateEx uses malloc, which returns memory aligned at least as the default operator new, and the headers keep
+//! the blocks at SmallBlockAlignment.
+void *AllocateBacking(size_t size, uint32_t allocFlags = Mso::Memory::AllocFlags::IgnoreLeak) noexcept {
+  s_backingAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  return Mso::Memory::AllocateEx(size, allocFlags);
+}
+
+//! Per-thread block cache. Only the owning thread uses the local free lists.
+//! Other threads return blocks to the remote free list which the owner takes as a whole.
+struct ThreadCache {
+  void *Allocate(uint32_t sizeClass) noexcept;
+  void FreeLocal(BlockHeader *header) noexcept;
+  void FreeRemote(BlockHeader *header) noexcept;
+
+  //! Number of blocks allocated from the cache and not freed yet. It can be called on any thread.
+  size_t GetOutstandingBlockCount() const noexcept;
+
+  //! Frees the slabs if no block is in use. It must be called by the owning thread when the thread exits.
+  //! Returns true if the cache is empty and can be deleted.
+  bool TryDrain() noexcept;
+
+  //! Next cache in the list of caches that wait for a new thread.
+  ThreadCache *NextReleased{nullptr};
+
+  //! Previous and next caches in the list of all caches.
+  ThreadCache *PrevCache{nullptr};
+  ThreadCache *NextCache{nullptr};
+
+ private:
+  void PushFree(BlockHeader *header) noexcept;
+  bool TakeRemoteBlocks() noexcept;
+  bool AllocateSlab(uint32_t sizeClass) noexcept;
+
+ private:
+  FreeBlock *m_localFree[SizeClassCount]{};
+  SlabHeader *m_slabs{nullptr};
+
+  // Blocks allocated minus blocks freed on the owning thread. Only the owning thread changes it.
+  std::atomic<size_t> m_allocatedCount{0};
+
+  // Blocks are only pushed to the remote list and the owner always takes the whole list.
+  // It avoids the ABA problem of a lock-free stack with a pop operation.
+  std::atomic<FreeBlock *> m_remoteFree{nullptr};
+
+  // Blocks freed by other threads. It is incremented after the block is pushed, as the last access to the cache.
+  std::atomic<size_t> m_remoteFreeCount{0};
+};
+
+void *ThreadCache::Allocate(uint32_t sizeClass) noexcept {
+  FreeBlock *block = m_localFree[sizeClass];
+  if (!block) {
+    if (!TakeRemoteBlocks() || !m_localFree[sizeClass]) {
+      if (!AllocateSlab(sizeClass)) {
+        return nullptr;
+      }
+    }
+
+    block = m_localFree[sizeClass];
+  }
+
+  m_localFree[sizeClass] = block->Next;
+  m_allocatedCount.store(m_allocatedCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  return block;
+}
+
+void ThreadCache::FreeLocal(BlockHeader *header) noexcept {
+  PushFree(header);
+  m_allocatedCount.store(m_allocatedCount.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+}
+
+void ThreadCache::PushFree(BlockHeader *header) noexcept {
+  FreeBlock *block = ToFreeBlock(header);
+  block->Next = m_localFree[header->SizeClass];
+  m_localFree[header->SizeClass] = block;
+}
+
+void ThreadCache::FreeRemote(BlockHeader *header) noexcept {
+  FreeBlock *block = ToFreeBlock(header);
+  FreeBlock *head = m_remoteFree.load(std::memory_order_relaxed);
+  do {
+    block->Next = head;
+  } while (!m_remoteFree.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+
+  m_remoteFreeCount.fetch_add(1, std::memory_order_release);
+}
+
+size_t ThreadCache::GetOutstandingBlockCount() const noexcept {
+  // Read the remote count first: a block freed in between makes the result larger, never negative.
+  const size_t remoteFreeCount = m_remoteFreeCount.load(std::memory_order_acquire);
+  return m_allocatedCount.load(std::memory_order_relaxed) - remoteFreeCount;
+}
+
+bool ThreadCache::TryDrain() noexcept {
+  // If all blocks are free, then no other thread can access this cache anymore:
+  // a remote free increments m_remoteFreeCount as its last access.
+  if (GetOutstandingBlockCount() != 0) {
+    return false;
+  }
+
+  while (SlabHeader *slab = m_slabs) {
+    m_slabs = slab->Next;
+    Mso::Memory::Free(slab);
+  }
+
+  return true;
+}
+
+bool ThreadCache::TakeRemoteBlocks() noexcept {
+  FreeBlock *block = m_remoteFree.exchange(nullptr, std::memory_order_acquire);
+  if (!block) {
+    return false;
+  }
+
+  while (block) {
+    FreeBlock *next = block->Next;
+    PushFree(ToHeader(block));
+    block = next;
+  }
+
+  return true;
+}
+
+bool ThreadCache::AllocateSlab(uint32_t sizeClass) noexcept {
+  const size_t stride = BlockStride(sizeClass);
+  const size_t blockCount = SlabSize / stride;
+  SlabHeader *slab = static_cast<SlabHeader *>(AllocateBacking(sizeof(SlabHeader) + blockCount * stride));
+  if (!slab) {
+    return false;
+  }
+
+  slab->Next = m_slabs;
+  m_slabs = slab;
+
+  // Link the blocks in address order.
+  uint8_t *blocks = reinterpret_cast<uint8_t *>(slab + 1);
+  for (size_t i = blockCount; i > 0; --i) {
+    BlockHeader *header = reinterpret_cast<BlockHeader *>(blocks + (i - 1) * stride);
+    header->Owner = this;
+    header->SizeClass = sizeClass;
+    PushFree(header);
+  }
+
+  return true;
+}
+
+//! Keeps the list of all caches and the caches of the exited threads.
+//! A cache is deleted when its thread exits with no blocks in use. Otherwise its blocks may still be in use
+//! on other threads, and a new thread takes over the released cache with all its blocks.
+struct ThreadCacheRegistry {
+  static ThreadCacheRegistry &Instance() noexcept {
+    // The registry is never destroyed: threads may exit after the static objects destruction.
+    static ThreadCacheRegistry *s_instance{new ThreadCacheRegistry()};
+    return *s_instance;
+  }
+
+  ThreadCache *AcquireCache() noexcept {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      if (ThreadCache *cache = m_releasedCaches) {
+        m_releasedCaches = cache->NextReleased;
+        cache->NextReleased = nullptr;
+        return cache;
+      }
+    }
+
+    void *memory = AllocateBacking(sizeof(ThreadCache));
+    if (!memory) {
+      return nullptr;
+    }
+
+    ThreadCache *cache = ::new (memory) ThreadCache();
+    std::lock_guard<std::mutex> lock{m_mutex};
+    cache->NextCache = m_caches;
+    if (m_caches) {
+      m_caches->PrevCache = cache;
+    }
+
+    m_caches = cache;
+    return cache;
+  }
+
+  void ReleaseCache(ThreadCache *cache) noexcept {
+    if (cache->TryDrain()) {
+      DeleteCache(cache);
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    cache->NextReleased = m_releasedCaches;
+    m_releasedCaches = cache;
+  }
+
+  size_t GetOutstandingBlockCount() noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    size_t count{0};
+    for (ThreadCache *cache = m_caches; cache; cache = cache->NextCache) {
+      count += cache->GetOutstandingBlockCount();
+    }
+
+    return count;
+  }
+
+ private:
+  void DeleteCache(ThreadCache *cache) noexcept {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      (cache->PrevCache ? cache->PrevCache->NextCache : m_caches) = cache->NextCache;
+      if (cache->NextCache) {
+        cache->NextCache->PrevCache = cache->PrevCache;
+      }
+    }
+
+    cache->~ThreadCache();
+    Mso::Memory::Free(cache);
+  }
+
+ private:
+  std::mutex m_mutex;
+  ThreadCache *m_caches{nullptr}; // All caches, including the released ones.
+  ThreadCache *m_releasedCaches{nullptr};
+};
+
+thread_local ThreadCache *tls_threadCache{nullptr};
+thread_local bool tls_isThreadCacheReleased{false};
+
+//! Drains the thread cache or returns it to the registry on thread exit.
+struct ThreadCacheHolder {
+  ~ThreadCacheHolder() noexcept {
+    if (tls_threadCache) {
+      ThreadCacheRegistry::Instance().ReleaseCache(tls_threadCache);
+      tls_threadCache = nullptr;
+    }
+
+    // Blocks allocated by destructors of other thread local variables go to AllocateEx.
+    tls_isThreadCacheReleased = true;
+  }
+
+  bool IsRegistered{false};
+};
+
+thread_local ThreadCacheHolder tls_threadCacheHolder;
+
+ThreadCache *GetThreadCache() noexcept {
+  if (!tls_threadCache && !tls_isThreadCacheReleased) {
+    tls_threadCache = ThreadCacheRegistry::Instance().AcquireCache();
+    // Accessing the holder registers its destructor for the current thread.
+    tls_threadCacheHolder.IsRegistered = true;
+  }
+
+  return tls_threadCache;
+}
+
+} // namespace
+
+_Use_decl_annotations_ void *AllocateSmallBlock(size_t cb) noexcept {
+  if (cb <= SmallBlockMaxSize) {
+    if (ThreadCache *cache = GetThreadCache()) {
+      const uint32_t sizeClass = static_cast<uint32_t>(cb > 0 ? (cb - 1) / SizeClassGranularity : 0);
+      return cache->Allocate(sizeClass);
+    }
+  }
+
+  // Large blocks are owned by the caller: keep them visible to the leak detection.
+  BlockHeader *header = static_cast<BlockHeader *>(AllocateBacking(sizeof(BlockHeader) + cb, /*allocFlags:*/ 0));
+  if (!header) {
+    return nullptr;
+  }
+
+  s_outstandingLargeBlockCount.fetch_add(1, std::memory_order_relaxed);
+  header->Owner = nullptr;
+  header->SizeClass = 0;
+  return header + 1;
+}
+
+_Use_decl_annotations_ void FreeSmallBlock(void *pv) noexcept {
+  if (!pv) {
+    return;
+  }
+
+  BlockHeader *header = ToHeader(pv);
+  if (!header->Owner) {
+    s_outstandingLargeBlockCount.fetch_sub(1, std::memory_order_relaxed);
+    Mso::Memory::Free(header);
+  } else if (header->Owner == tls_threadCache) {
+    header->Owner->FreeLocal(header);
+  } else {
+    header->Owner->FreeRemote(header);
+  }
+}
+
+size_t GetSmallBlockPoolBackingAllocationCount() noexcept {
+  return s_backingAllocationCount.load(std::memory_order_relaxed);
+}
+
+size_t GetSmallBlockPoolOutstandingBlockCount() noexcept {
+  return ThreadCacheRegistry::Instance().GetOutstandingBlockCount() +
+      s_outstandingLargeBlockCount.load(std::memory_order_relaxed);
+}
+
+} // namespace Memory
+} // namespace Mso
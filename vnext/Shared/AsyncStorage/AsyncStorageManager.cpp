@@ -3,6 +3,8 @@
 
 #include <AsyncStorage/AsyncStorageManager.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace folly;
 using namespace facebook::xplat;
@@ -42,15 +44,98 @@ void AsyncStorageManager::consumeSetRequest() noexcept {
     std::unique_lock<std::mutex> uniqueMutex(m_setQueueMutex);
     m_storageQueueConditionVariable.wait(uniqueMutex, [this] { return m_stopConsumer || !m_asyncQueue.empty(); });
 
-    if (!m_asyncQueue.empty()) {
-      std::unique_ptr<AsyncRequestQueueArguments> arguments = std::move(m_asyncQueue.front());
-      m_asyncQueue.pop();
+    // Drain everything queued so far and apply it in one pass.
+    std::queue<std::unique_ptr<AsyncRequestQueueArguments>> requests;
+    requests.swap(m_asyncQueue);
+
+    uniqueMutex.unlock();
+
+    AsyncRequestBatch writeBatch;
+    while (!requests.empty()) {
+      std::unique_ptr<AsyncRequestQueueArguments> arguments = std::move(requests.front());
+      requests.pop();
+
+      switch (arguments->m_operation) {
+        case AsyncStorageOperation::multiSet:
+        case AsyncStorageOperation::multiRemove:
+        case AsyncStorageOperation::multiMerge:
+          writeBatch.push_back(std::move(arguments));
+          break;
+
+        default:
+          // Any other operation is a barrier: writes queued before it must be
+          // applied first so that the requests still complete in order.
+          executeWriteBatch(writeBatch);
+          executeAsyncKVOperation(arguments->m_operation, arguments->m_args, arguments->m_jsCallback);
+          break;
+      }
+    }
+
+    executeWriteBatch(writeBatch);
+  }
+}
 
-      uniqueMutex.unlock();
+void AsyncStorageManager::executeWriteBatch(AsyncRequestBatch &batch) noexcept {
+  if (batch.empty())
+    return;
 
-      executeAsyncKVOperation(arguments->m_operation, arguments->m_args, arguments->m_jsCallback);
+  std::vector<std::vector<folly::dynamic>> results(batch.size(), noErrorVector);
+  try {
+    m_aofKVStorage->beginBatch();
+
+    for (size_t i = 0; i < batch.size(); i++) {
+      try {
+        const dynamic &args = batch[i]->m_args;
+        switch (batch[i]->m_operation) {
+          case AsyncStorageOperation::multiSet:
+            m_aofKVStorage->multiSet(FollyDynamicConverter::jsArgAsTupleStringVector(args));
+            break;
+          case AsyncStorageOperation::multiMerge:
+            m_aofKVStorage->multiMerge(FollyDynamicConverter::jsArgAsTupleStringVector(args));
+            break;
+          default:
+            m_aofKVStorage->multiRemove(FollyDynamicConverter::jsArgAsStringVector(args));
+            break;
+        }
+      } catch (std::exception &e) {
+        results[i] = {makeError(e.what())};
+      }
     }
+
+    m_aofKVStorage->commitBatch();
+    recordWriteBatch(batch.size(), batch.front()->m_queuedTime);
+  } catch (std::exception &e) {
+    // Nothing in the batch is known to be durable. KeyValueStorage keeps the
+    // batch open and writes its records again with the next batch.
+    for (auto &result : results)
+      result = {makeError(e.what())};
   }
+
+  for (size_t i = 0; i < batch.size(); i++)
+    batch[i]->m_jsCallback(results[i]);
+
+  batch.clear();
+}
+
+void AsyncStorageManager::recordWriteBatch(
+    size_t batchSize,
+    std::chrono::steady_clock::time_point oldestQueuedTime) noexcept {
+  using namespace std::chrono;
+
+  const auto timeToDurable = duration_cast<microseconds>(steady_clock::now() - oldestQueuedTime);
+
+  std::lock_guard<std::mutex> lockGuard(m_metricsMutex);
+  m_writeBatchMetrics.batchCount++;
+  m_writeBatchMetrics.requestCount += batchSize;
+  m_writeBatchMetrics.lastBatchSize = batchSize;
+  m_writeBatchMetrics.maxBatchSize = (std::max)(m_writeBatchMetrics.maxBatchSize, batchSize);
+  m_writeBatchMetrics.lastTimeToDurable = timeToDurable;
+  m_writeBatchMetrics.maxTimeToDurable = (std::max)(m_writeBatchMetrics.maxTimeToDurable, timeToDurable);
+}
+
+AsyncStorageManager::WriteBatchMetrics AsyncStorageManager::getWriteBatchMetrics() noexcept {
+  std::lock_guard<std::mutex> lockGuard(m_metricsMutex);
+  return m_writeBatchMetrics;
 }
 
 folly::dynamic AsyncStorageManager::makeError(std::string &&strErrorMessage) noexcept {
@@ -87,22 +172,10 @@ void AsyncStorageManager::executeAsyncKVOperation(
     const module::CxxModule::Callback &jsCallback) noexcept {
   try {
     switch (operation) {
-      case AsyncStorageOperation::multiSet:
-        multiSetInternal(args, jsCallback);
-        break;
-
-      case AsyncStorageOperation::multiRemove:
-        multiRemoveInternal(args, jsCallback);
-        break;
-
       case AsyncStorageOperation::clear:
         clearInternal(args, jsCallback);
         break;
 
-      case AsyncStorageOperation::multiMerge:
-        multiMergeInternal(args, jsCallback);
-        break;
-
       default:
         jsCallback({makeError("Invalid AsyncStorage operation")});
         break;
@@ -119,27 +192,12 @@ void AsyncStorageManager::multiGetInternal(const dynamic &args, const module::Cx
   jsCallback({noError, jsRetVal});
 }
 
-void AsyncStorageManager::multiSetInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  m_aofKVStorage->multiSet(FollyDynamicConverter::jsArgAsTupleStringVector(args));
-  jsCallback(noErrorVector);
-}
-
-void AsyncStorageManager::multiRemoveInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  m_aofKVStorage->multiRemove(FollyDynamicConverter::jsArgAsStringVector(args));
-  jsCallback(noErrorVector);
-}
-
 void AsyncStorageManager::clearInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
   UNREFERENCED_PARAMETER(args);
   m_aofKVStorage->clear();
   jsCallback(noErrorVector);
 }
 
-void AsyncStorageManager::multiMergeInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
-  m_aofKVStorage->multiMerge(FollyDynamicConverter::jsArgAsTupleStringVector(args));
-  jsCallback(noErrorVector);
-}
-
 void AsyncStorageManager::getAllKeysInternal(const dynamic &args, const module::CxxModule::Callback &jsCallback) {
   std::vector<std::string> keys = m_aofKVStorage->getAllKeys();
   folly::dynamic jsRetVal = FollyDynamicConverter::stringVectorAsRetVal(keys);
@@ -8,9 +8,11 @@
 #include <cxxreact/CxxModule.h>
 #include <folly/dynamic.h>
 
+#include <chrono>
 #include <condition_variable>
 #include <future>
 #include <queue>
+#include <vector>
 
 namespace facebook {
 namespace react {
@@ -25,18 +27,37 @@ class AsyncStorageManager {
       const folly::dynamic &args,
       const xplat::module::CxxModule::Callback &jsCallback) noexcept;
 
+  // Queued multiSet, multiRemove and multiMerge requests are written to the
+  // storage file in batches with a single sync. Time to durable is measured
+  // from the moment the oldest request of a batch was queued until the batch
+  // was synced.
+  struct WriteBatchMetrics {
+    uint64_t batchCount{0};
+    uint64_t requestCount{0};
+    size_t lastBatchSize{0};
+    size_t maxBatchSize{0};
+    std::chrono::microseconds lastTimeToDurable{0};
+    std::chrono::microseconds maxTimeToDurable{0};
+  };
+  WriteBatchMetrics getWriteBatchMetrics() noexcept;
+
  private:
   struct AsyncRequestQueueArguments {
     AsyncRequestQueueArguments(
         AsyncStorageOperation paramOperation,
         const folly::dynamic &&paramArgs,
         const xplat::module::CxxModule::Callback &&paramJsCallback) noexcept
-        : m_operation(paramOperation), m_args(std::move(paramArgs)), m_jsCallback(std::move(paramJsCallback)) {}
+        : m_operation(paramOperation),
+          m_args(std::move(paramArgs)),
+          m_jsCallback(std::move(paramJsCallback)),
+          m_queuedTime(std::chrono::steady_clock::now()) {}
 
     AsyncStorageOperation m_operation;
     folly::dynamic m_args;
     xplat::module::CxxModule::Callback m_jsCallback;
+    std::chrono::steady_clock::time_point m_queuedTime;
   };
+  using AsyncRequestBatch = std::vector<std::unique_ptr<AsyncRequestQueueArguments>>;
 
  private:
   std::atomic_bool m_stopConsumer;
@@ -45,6 +66,8 @@ class AsyncStorageManager {
   std::future<void> m_consumerTask;
   std::queue<std::unique_ptr<AsyncStorageManager::AsyncRequestQueueArguments>> m_asyncQueue;
   std::unique_ptr<KeyValueStorage> m_aofKVStorage;
+  std::mutex m_metricsMutex;
+  WriteBatchMetrics m_writeBatchMetrics;
 
  private:
   folly::dynamic makeError(std::string &&strErrorMessage) noexcept;
@@ -55,16 +78,15 @@ class AsyncStorageManager {
       const xplat::module::CxxModule::Callback &jsCallback) noexcept;
 
   void consumeSetRequest() noexcept;
+  void executeWriteBatch(AsyncRequestBatch &batch) noexcept;
+  void recordWriteBatch(size_t batchSize, std::chrono::steady_clock::time_point oldestQueuedTime) noexcept;
   void putRequestOnQueue(
       AsyncStorageOperation operation,
       const folly::dynamic &args,
       const xplat::module::CxxModule::Callback &jsCallback) noexcept;
 
   void multiGetInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
-  void multiSetInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
-  void multiRemoveInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
   void clearInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
-  void multiMergeInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
   void getAllKeysInternal(const folly::dynamic &args, const xplat::module::CxxModule::Callback &jsCallback);
 };
 } // namespace react
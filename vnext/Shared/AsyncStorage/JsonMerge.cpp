@@ -0,0 +1,449 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <AsyncStorage/JsonMerge.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const size_t MaxNestingDepth = 512;
+const size_t NotAnObject = SIZE_MAX;
+
+struct Member {
+  std::string name; // decoded member name
+  std::string_view rawName; // member name as written, including the quotes
+  std::string_view value; // member value as written
+  size_t object{NotAnObject}; // index of the value in JsonObjects if it is an object
+};
+
+// Members of the objects that can be merged: the root object, at index 0, and
+// the objects nested in it through object members. Objects in arrays are
+// never merged and are not indexed.
+using JsonObjects = std::vector<std::vector<Member>>;
+
+// Validating JSON scanner. It indexes the mergeable objects of a document in
+// a single pass. Values are slices of the input; only the member names of the
+// indexed objects are decoded.
+class JsonScanner {
+ public:
+  JsonScanner(std::string_view text, const char *documentName) noexcept
+      : m_text{text}, m_documentName{documentName} {}
+
+  JsonObjects scanObjectDocument() {
+    skipWhitespace();
+    if (peek() != '{')
+      fail("expected an object");
+
+    scanObject();
+
+    skipWhitespace();
+    if (m_pos != m_text.size())
+      fail("unexpected character after the object");
+
+    return std::move(m_objects);
+  }
+
+ private:
+  std::string_view m_text;
+  const char *m_documentName;
+  size_t m_pos{0};
+  size_t m_depth{0};
+  JsonObjects m_objects;
+
+  [[noreturn]] void fail(const char *reason) const {
+    const std::string message =
+        std::string("Invalid JSON in ") + m_documentName + ": " + reason + " at offset " + std::to_string(m_pos) + ".";
+    throw std::exception(message.c_str());
+  }
+
+  char peek() const noexcept {
+    return m_pos < m_text.size() ? m_text[m_pos] : '\0';
+  }
+
+  void skipWhitespace() noexcept {
+    while (m_pos < m_text.size() &&
+           (m_text[m_pos] == ' ' || m_text[m_pos] == '\t' || m_text[m_pos] == '\n' || m_text[m_pos] == '\r'))
+      m_pos++;
+  }
+
+  void expect(char c, const char *reason) {
+    if (peek() != c)
+      fail(reason);
+    m_pos++;
+  }
+
+  void enterContainer() {
+    if (++m_depth > MaxNestingDepth)
+      fail("nesting is too deep");
+    m_pos++;
+  }
+
+  // Returns the index of the object in m_objects.
+  size_t scanObject() {
+    const size_t index = m_objects.size();
+    m_objects.emplace_back();
+
+    std::vector<Member> members;
+    enterContainer();
+
+    skipWhitespace();
+    if (peek() == '}') {
+      m_pos++;
+      m_depth--;
+      return index;
+    }
+
+    while (true) {
+      skipWhitespace();
+      if (peek() != '"')
+        fail("expected a member name");
+
+      Member member;
+      member.rawName = scanString(&member.name);
+
+      skipWhitespace();
+      expect(':', "expected ':'");
+      skipWhitespace();
+      member.value = scanValue(&member.object);
+      members.push_back(std::move(member));
+
+      skipWhitespace();
+      if (peek() == ',') {
+        m_pos++;
+        continue;
+      }
+      expect('}', "expected ',' or '}'");
+      break;
+    }
+
+    m_depth--;
+    // Nested objects were added while scanning the members, so the object is
+    // filled in by index.
+    m_objects[index] = UniqueMembers(std::move(members));
+    return index;
+  }
+
+  // Indexes an object value if objectIndex is not null.
+  std::string_view scanValue(size_t *objectIndex) {
+    const size_t start = m_pos;
+    switch (peek()) {
+      case '{':
+        if (objectIndex)
+          *objectIndex = scanObject();
+        else
+          skipObject();
+        break;
+      case '[':
+        skipArray();
+        break;
+      case '"':
+        scanString(nullptr);
+        break;
+      case 't':
+        skipLiteral("true");
+        break;
+      case 'f':
+        skipLiteral("false");
+        break;
+      case 'n':
+        skipLiteral("null");
+        break;
+      default:
+        skipNumber();
+        break;
+    }
+    return m_text.substr(start, m_pos - start);
+  }
+
+  void skipObject() {
+    enterContainer();
+
+    skipWhitespace();
+    if (peek() != '}') {
+      while (true) {
+        skipWhitespace();
+        if (peek() != '"')
+          fail("expected a member name");
+        scanString(nullptr);
+
+        skipWhitespace();
+        expect(':', "expected ':'");
+        skipWhitespace();
+        scanValue(nullptr);
+
+        skipWhitespace();
+        if (peek() != ',')
+          break;
+        m_pos++;
+      }
+    }
+
+    expect('}', "expected ',' or '}'");
+    m_depth--;
+  }
+
+  void skipArray() {
+    enterContainer();
+
+    skipWhitespace();
+    if (peek() != ']') {
+      while (true) {
+        skipWhitespace();
+        scanValue(nullptr);
+
+        skipWhitespace();
+        if (peek() != ',')
+          break;
+        m_pos++;
+      }
+    }
+
+    expect(']', "expected ',' or ']'");
+    m_depth--;
+  }
+
+  void skipLiteral(const char *literal) {
+    const std::string_view expected{literal};
+    if (m_text.substr(m_pos, expected.size()) != expected)
+      fail("unexpected character");
+    m_pos += expected.size();
+  }
+
+  void skipDigits() {
+    if (peek() < '0' || peek() > '9')
+      fail("expected a digit");
+    while (peek() >= '0' && peek() <= '9')
+      m_pos++;
+  }
+
+  void skipNumber() {
+    if (peek() == '-')
+      m_pos++;
+
+    if (peek() == '0')
+      m_pos++;
+    else
+      skipDigits();
+
+    if (peek() == '.') {
+      m_pos++;
+      skipDigits();
+    }
+
+    if (peek() == 'e' || peek() == 'E') {
+      m_pos++;
+      if (peek() == '+' || peek() == '-')
+        m_pos++;
+      skipDigits();
+    }
+  }
+
+  unsigned scanHex4() {
+    unsigned codeUnit = 0;
+    for (int i = 0; i < 4; i++, m_pos++) {
+      const char c = peek();
+      codeUnit <<= 4;
+      if (c >= '0' && c <= '9')
+        codeUnit |= c - '0';
+      else if (c >= 'a' && c <= 'f')
+        codeUnit |= c - 'a' + 10;
+      else if (c >= 'A' && c <= 'F')
+        codeUnit |= c - 'A' + 10;
+      else
+        fail("invalid unicode escape");
+    }
+    return codeUnit;
+  }
+
+  static void appendUtf8(std::string &out, unsigned codePoint) {
+    if (codePoint < 0x80) {
+      out += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+      out += static_cast<char>(0xC0 | (codePoint >> 6));
+      out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+      out += static_cast<char>(0xE0 | (codePoint >> 12));
+      out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+      out += static_cast<char>(0xF0 | (codePoint >> 18));
+      out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+      out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+  }
+
+  // Returns the string as written. Decodes it into decoded unless it is null.
+  std::string_view scanString(std::string *decoded) {
+    const size_t start = m_pos;
+    m_pos++; // opening quote
+
+    while (true) {
+      const char c = peek();
+      if (m_pos == m_text.size())
+        fail("unterminated string");
+      if (static_cast<unsigned char>(c) < 0x20)
+        fail("control character in string");
+
+      if (c == '"') {
+        m_pos++;
+        break;
+      }
+
+      if (c != '\\') {
+        if (decoded)
+          *decoded += c;
+        m_pos++;
+        continue;
+      }
+
+      m_pos++;
+      const char escaped = peek();
+      m_pos++;
+      char replacement;
+      switch (escaped) {
+        case '"':
+        case '\\':
+        case '/':
+          replacement = escaped;
+          break;
+        case 'b':
+          replacement = '\b';
+          break;
+        case 'f':
+          replacement = '\f';
+          break;
+        case 'n':
+          replacement = '\n';
+          break;
+        case 'r':
+          replacement = '\r';
+          break;
+        case 't':
+          replacement = '\t';
+          break;
+        case 'u': {
+          unsigned codePoint = scanHex4();
+          // Combine a surrogate pair. A lone surrogate is kept as is.
+          if (codePoint >= 0xD800 && codePoint < 0xDC00 && m_text.substr(m_pos, 2) == "\\u") {
+            const size_t lowStart = m_pos;
+            m_pos += 2;
+            const unsigned low = scanHex4();
+            if (low >= 0xDC00 && low < 0xE000)
+              codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+            else
+              m_pos = lowStart;
+          }
+          if (decoded)
+            appendUtf8(*decoded, codePoint);
+          continue;
+        }
+        default:
+          m_pos--;
+          fail("invalid escape sequence");
+      }
+
+      if (decoded)
+        *decoded += replacement;
+    }
+
+    return m_text.substr(start, m_pos - start);
+  }
+
+  // Like JSON.parse, a member name that occurs more than once keeps the
+  // position of its first occurrence and the value of its last.
+  static std::vector<Member> UniqueMembers(std::vector<Member> &&members) {
+    std::unordered_map<std::string_view, size_t> indexByName;
+    std::vector<Member> unique;
+    unique.reserve(members.size());
+
+    for (auto &member : members) {
+      auto it = indexByName.find(member.name);
+      if (it != indexByName.end()) {
+        unique[it->second].value = member.value;
+        unique[it->second].object = member.object;
+      } else {
+        // The names are viewed in unique, which does not reallocate.
+        unique.push_back(std::move(member));
+        indexByName.emplace(unique.back().name, unique.size() - 1);
+      }
+    }
+
+    return unique;
+  }
+};
+
+void AppendMember(std::string &out, bool &first, std::string_view rawName) {
+  if (!first)
+    out += ',';
+  first = false;
+  out += rawName;
+  out += ':';
+}
+
+void MergeObjects(
+    const JsonObjects &target,
+    size_t targetIndex,
+    const JsonObjects &patch,
+    size_t patchIndex,
+    std::string &out) {
+  const auto &targetMembers = target[targetIndex];
+  const auto &patchMembers = patch[patchIndex];
+
+  std::unordered_map<std::string_view, size_t> patchIndexByName;
+  for (size_t i = 0; i < patchMembers.size(); i++)
+    patchIndexByName.emplace(patchMembers[i].name, i);
+
+  std::vector<bool> patchMemberUsed(patchMembers.size(), false);
+  bool first = true;
+  out += '{';
+
+  for (auto const &member : targetMembers) {
+    AppendMember(out, first, member.rawName);
+
+    auto it = patchIndexByName.find(member.name);
+    if (it == patchIndexByName.end()) {
+      out += member.value;
+      continue;
+    }
+
+    const auto &patchMember = patchMembers[it->second];
+    patchMemberUsed[it->second] = true;
+    if (member.object != NotAnObject && patchMember.object != NotAnObject)
+      MergeObjects(target, member.object, patch, patchMember.object, out);
+    else
+      out += patchMember.value;
+  }
+
+  for (size_t i = 0; i < patchMembers.size(); i++) {
+    if (!patchMemberUsed[i]) {
+      AppendMember(out, first, patchMembers[i].rawName);
+      out += patchMembers[i].value;
+    }
+  }
+
+  out += '}';
+}
+
+} // namespace
+
+namespace facebook {
+namespace react {
+
+std::string JsonMerge::deepMerge(std::string_view target, std::string_view patch) {
+  const auto targetObjects = JsonScanner(target, "the stored value").scanObjectDocument();
+  const auto patchObjects = JsonScanner(patch, "the merged value").scanObjectDocument();
+
+  std::string merged;
+  merged.reserve(target.size() + patch.size());
+  MergeObjects(targetObjects, 0, patchObjects, 0, merged);
+  return merged;
+}
+
+} // namespace react
+} // namespace facebook
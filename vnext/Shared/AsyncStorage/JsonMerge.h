@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace facebook {
+namespace react {
+
+// Deep merge of JSON objects with the semantics of AsyncStorage.mergeItem:
+// members of patch replace the members of target with the same name, except
+// that two objects are merged recursively. Arrays are replaced, not merged.
+//
+// Both inputs are scanned once into an index of their objects, and the result
+// is assembled from slices of the input: no value is ever re-encoded.
+class JsonMerge {
+ public:
+  // Both target and patch must be JSON objects. Throws std::exception if
+  // either is not.
+  static std::string deepMerge(std::string_view target, std::string_view patch);
+};
+
+} // namespace react
+} // namespace facebook
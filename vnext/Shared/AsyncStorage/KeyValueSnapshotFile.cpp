@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <AsyncStorage/KeyValueSnapshotFile.h>
+#include <AsyncStorage/StorageFileIO.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+const char SnapshotMagic[4] = {'R', 'N', 'K', 'V'};
+
+struct SnapshotHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t entryCount;
+};
+
+void AppendUInt32(std::string &buffer, uint32_t value) {
+  buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+} // namespace
+
+namespace facebook {
+namespace react {
+
+KeyValueSnapshotFile::FileView::FileView(const std::wstring &filePath) {
+  HANDLE fileHandle = CreateFile2(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE) {
+    // The storage file references a snapshot file that does not exist.
+    if (GetLastError() == ERROR_FILE_NOT_FOUND)
+      throw StorageCorruptionException("Corrupt storage file. Snapshot file not found.");
+
+    StorageFileIO::throwLastErrorMessage();
+  }
+
+  std::unique_ptr<void, decltype(&CloseHandle)> file{fileHandle, &CloseHandle};
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(fileHandle, &fileSize))
+    StorageFileIO::throwLastErrorMessage();
+
+  // An empty file cannot be mapped.
+  if (fileSize.QuadPart < static_cast<LONGLONG>(sizeof(SnapshotHeader)))
+    throw StorageCorruptionException("Corrupt storage snapshot. File is too small.");
+  if (fileSize.HighPart != 0)
+    throw StorageCorruptionException("Corrupt storage snapshot. File is too large.");
+
+  m_fileMapping = CreateFileMappingFromApp(fileHandle, nullptr, PAGE_READONLY, fileSize.QuadPart, nullptr);
+  if (!m_fileMapping)
+    StorageFileIO::throwLastErrorMessage();
+
+  data = static_cast<const char *>(MapViewOfFileFromApp(m_fileMapping, FILE_MAP_READ, 0, 0));
+  if (!data) {
+    CloseHandle(m_fileMapping);
+    StorageFileIO::throwLastErrorMessage();
+  }
+
+  size = fileSize.LowPart;
+}
+
+KeyValueSnapshotFile::FileView::~FileView() {
+  UnmapViewOfFile(data);
+  CloseHandle(m_fileMapping);
+}
+
+KeyValueSnapshotFile::KeyValueSnapshotFile(std::wstring filePath) : m_filePath{std::move(filePath)} {
+  m_view = std::make_unique<FileView>(m_filePath);
+
+  const auto data = m_view->data;
+  const auto size = m_view->size;
+
+  SnapshotHeader header;
+  memcpy(&header, data, sizeof(header));
+  if (memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+    throw StorageCorruptionException("Corrupt storage snapshot. Unexpected file signature.");
+  if (header.version != FormatVersion)
+    throw std::exception("Unsupported storage snapshot version.");
+
+  const size_t indexSize = static_cast<size_t>(header.entryCount) * sizeof(IndexEntry);
+  if (indexSize > size - sizeof(header))
+    throw StorageCorruptionException("Corrupt storage snapshot. Index exceeds the file size.");
+
+  m_entryCount = header.entryCount;
+  m_index = reinterpret_cast<const IndexEntry *>(data + sizeof(header));
+  m_heap = data + sizeof(header) + indexSize;
+  m_heapSize = size - sizeof(header) - indexSize;
+}
+
+KeyValueSnapshotFile::~KeyValueSnapshotFile() {
+  // The mapping has to be closed before the file can be deleted.
+  m_view.reset();
+
+  if (m_deleteOnClose)
+    DeleteFileW(m_filePath.c_str());
+}
+
+void KeyValueSnapshotFile::deleteOnClose() noexcept {
+  m_deleteOnClose = true;
+}
+
+// Index entries are validated on access rather than on open, so that opening
+// a snapshot does not touch every page of it.
+std::string_view KeyValueSnapshotFile::heapView(uint32_t offset, uint32_t length) const {
+  if (offset > m_heapSize || length > m_heapSize - offset)
+    throw StorageCorruptionException("Corrupt storage snapshot. Entry exceeds the file size.");
+
+  return std::string_view(m_heap + offset, length);
+}
+
+std::string_view KeyValueSnapshotFile::keyAt(size_t index) const {
+  return heapView(m_index[index].keyOffset, m_index[index].keyLength);
+}
+
+std::string_view KeyValueSnapshotFile::valueAt(size_t index) const {
+  return heapView(m_index[index].valueOffset, m_index[index].valueLength);
+}
+
+std::optional<size_t> KeyValueSnapshotFile::find(std::string_view key) const {
+  size_t low = 0;
+  size_t high = m_entryCount;
+  while (low < high) {
+    const size_t mid = low + (high - low) / 2;
+    const int order = keyAt(mid).compare(key);
+    if (order == 0)
+      return mid;
+
+    if (order < 0)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+
+  return std::nullopt;
+}
+
+std::string KeyValueSnapshotFile::serialize(
+    const std::vector<std::pair<std::string_view, std::string_view>> &sortedEntries) {
+  size_t heapSize = 0;
+  for (auto const &entry : sortedEntries)
+    heapSize += entry.first.size() + entry.second.size();
+
+  const size_t indexSize = sortedEntries.size() * sizeof(IndexEntry);
+  if (sizeof(SnapshotHeader) + indexSize + heapSize > (std::numeric_limits<uint32_t>::max)())
+    throw std::exception("Storage snapshot exceeds the maximum file size.");
+
+  std::string file;
+  file.reserve(sizeof(SnapshotHeader) + indexSize + heapSize);
+
+  file.append(SnapshotMagic, sizeof(SnapshotMagic));
+  AppendUInt32(file, FormatVersion);
+  AppendUInt32(file, static_cast<uint32_t>(sortedEntries.size()));
+
+  uint32_t heapOffset = 0;
+  for (auto const &entry : sortedEntries) {
+    AppendUInt32(file, heapOffset);
+    AppendUInt32(file, static_cast<uint32_t>(entry.first.size()));
+    heapOffset += static_cast<uint32_t>(entry.first.size());
+    AppendUInt32(file, heapOffset);
+    AppendUInt32(file, static_cast<uint32_t>(entry.second.size()));
+    heapOffset += static_cast<uint32_t>(entry.second.size());
+  }
+
+  for (auto const &entry : sortedEntries) {
+    file.append(entry.first);
+    file.append(entry.second);
+  }
+
+  return file;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <Windows.h>
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// Read-only, memory-mapped binary snapshot of an AsyncStorage table.
+//
+// The file is laid out as
+//   header: magic "RNKV", format version, entry count (all uint32_t)
+//   index:  entry count x {key offset, key length, value offset, value length},
+//           sorted by key, offsets relative to the start of the heap
+//   heap:   raw key and value bytes
+//
+// Opening a snapshot only maps it. Lookups binary-search the index and values
+// are copied out of the mapping on access, so the cost of a read does not
+// depend on the size of the table.
+class KeyValueSnapshotFile {
+ public:
+  static const uint32_t FormatVersion = 1;
+
+  // Throws StorageCorruptionException if the file is missing or is not a
+  // snapshot, and std::exception if it cannot be mapped or has an unsupported
+  // version.
+  explicit KeyValueSnapshotFile(std::wstring filePath);
+  ~KeyValueSnapshotFile();
+
+  KeyValueSnapshotFile(const KeyValueSnapshotFile &) = delete;
+  KeyValueSnapshotFile &operator=(const KeyValueSnapshotFile &) = delete;
+
+  size_t size() const noexcept {
+    return m_entryCount;
+  }
+
+  std::string_view keyAt(size_t index) const;
+  std::string_view valueAt(size_t index) const;
+  std::optional<size_t> find(std::string_view key) const;
+
+  // The file is deleted once the last reader releases the snapshot.
+  void deleteOnClose() noexcept;
+
+  // Serializes entries, which must be sorted by key and unique, into the
+  // snapshot file format.
+  static std::string serialize(const std::vector<std::pair<std::string_view, std::string_view>> &sortedEntries);
+
+ private:
+  struct IndexEntry {
+    uint32_t keyOffset;
+    uint32_t keyLength;
+    uint32_t valueOffset;
+    uint32_t valueLength;
+  };
+
+  // Read-only view of the whole file. Unlike MemoryMappedBuffer, the view is
+  // not registered with Windows Error Reporting, so that stored values are
+  // not copied into crash dumps.
+  struct FileView {
+    explicit FileView(const std::wstring &filePath);
+    ~FileView();
+
+    FileView(const FileView &) = delete;
+    FileView &operator=(const FileView &) = delete;
+
+    const char *data{nullptr};
+    size_t size{0};
+
+   private:
+    HANDLE m_fileMapping{nullptr};
+  };
+
+  std::wstring m_filePath;
+  std::unique_ptr<FileView> m_view;
+  const IndexEntry *m_index{nullptr};
+  const char *m_heap{nullptr};
+  size_t m_heapSize{0};
+  uint32_t m_entryCount{0};
+  std::atomic_bool m_deleteOnClose{false};
+
+  std::string_view heapView(uint32_t offset, uint32_t length) const;
+};
+
+} // namespace react
+} // namespace facebook
@@ -3,15 +3,22 @@
 
 #include "pch.h"
 
+#include <AsyncStorage/JsonMerge.h>
 #include <AsyncStorage/KeyValueStorage.h>
 
+#include <algorithm>
+#include <limits>
+
 using namespace std;
 
 namespace facebook {
 namespace react {
 
-KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName)
-    : m_fileIOHelper{make_unique<StorageFileIO>(storageFileName)}, m_kvMap{map<string, string>()} {
+KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName, float compactionThreshold)
+    : KeyValueStorage(make_unique<StorageFileIO>(storageFileName), compactionThreshold) {}
+
+KeyValueStorage::KeyValueStorage(unique_ptr<StorageFileIO> fileIOHelper, float compactionThreshold)
+    : m_fileIOHelper{std::move(fileIOHelper)}, m_compactionThreshold{compactionThreshold} {
   // start the load procedure
   m_storageFileLoaded = CreateEventEx(nullptr, nullptr, CREATE_EVENT_MANUAL_RESET, SYNCHRONIZE | EVENT_MODIFY_STATE);
   if (m_storageFileLoaded == NULL)
@@ -20,17 +27,65 @@ KeyValueStorage::KeyValueStorage(const WCHAR *storageFileName)
   m_storageFileLoader = async(launch::async, &KeyValueStorage::load, this);
 }
 
+KeyValueStorage::~KeyValueStorage() {
+  if (m_storageFileLoader.valid())
+    m_storageFileLoader.wait();
+
+  {
+    // A batch left open by a failed commitBatch is dropped, so that a
+    // compaction waiting for it can finish. Its writes were reported as failed.
+    lock_guard<mutex> lock(m_storageMutex);
+    m_batchActive = false;
+    m_batchCommitted.notify_all();
+  }
+
+  if (m_compactionTask.valid())
+    m_compactionTask.wait();
+
+  CloseHandle(m_storageFileLoaded);
+}
+
 void KeyValueStorage::setStorageLoadedEvent() {
   if (!SetEvent(m_storageFileLoaded))
     StorageFileIO::throwLastErrorMessage();
 }
 
 void KeyValueStorage::load() {
-  bool saveRequired = false; // this flag is used to indicate whether the file
-                             // needs to be cleaned up.
+  try {
+    loadStorageFile();
+  } catch (const StorageCorruptionException &) {
+    // Storage that cannot be parsed is discarded, so that the next session
+    // starts from an empty table.
+    resetTable();
+    m_fileIOHelper->clear();
+    m_fileIOHelper->deleteStaleSnapshotFiles(0);
+    setStorageLoadedEvent();
+    throw;
+  } catch (...) {
+    // Other errors, such as a sharing violation, may not happen in a later
+    // session. The files are left untouched, and every call fails.
+    m_loadError = current_exception();
+    setStorageLoadedEvent();
+    throw;
+  }
+
+  // Remove snapshot files that the storage file does not reference anymore.
+  m_fileIOHelper->deleteStaleSnapshotFiles(m_baseGeneration);
 
+  {
+    lock_guard<mutex> lock(m_storageMutex);
+    publishSnapshot();
+    scheduleCompactionIfNeeded();
+  }
+  setStorageLoadedEvent();
+}
+
+// Maps the snapshot file named by the storage file, then replays the changes
+// logged on top of it. Only the log is parsed: reading the snapshot file is
+// deferred to the lookups.
+void KeyValueStorage::loadStorageFile() {
   string currentKey;
-  string unescapedLine;
+  bool firstRecord = true;
 
   std::string line;
   line.reserve(EstimatedValueSize);
@@ -41,57 +96,342 @@ void KeyValueStorage::load() {
     if (line.size() > 0) {
       char prefix = line.at(0);
       line.erase(0, 1);
-      unescapeString(line); // get the line without the prefix ($, %, R) and
+      unescapeString(line); // get the line without the prefix ($, %, R, B) and
                             // unescapes the \n and \ chars
       switch (prefix) { // switch on first char in line
+        case BasePrefix: {
+          // The generation is a decimal uint32_t. The digits are checked first,
+          // so that stoull does not throw.
+          const bool isNumber =
+              !line.empty() && line.size() <= 10 && line.find_first_not_of("0123456789") == string::npos;
+          const unsigned long long generation = isNumber ? stoull(line) : 0;
+          if (!firstRecord || generation == 0 || generation > (numeric_limits<uint32_t>::max)())
+            throw StorageCorruptionException("Corrupt storage file. Unexpected snapshot record. Storage file cleared.");
+
+          m_baseGeneration = m_lastGeneration = static_cast<uint32_t>(generation);
+          m_baseFile = make_shared<KeyValueSnapshotFile>(m_fileIOHelper->snapshotFilePath(m_baseGeneration));
+          break;
+        }
+
         case KeyPrefix:
           currentKey = line;
           break;
 
         case ValuePrefix:
-          if (m_kvMap.count(currentKey))
-            saveRequired = true;
-          m_kvMap[currentKey] = line;
+          // A value equal to the current one makes the previous record dead.
+          if (!setValue(currentKey, line))
+            m_deadRecordCount++;
+          m_logRecordCount++;
           break;
 
         case RemovePrefix:
-          saveRequired = true;
-          m_kvMap.erase(currentKey);
+          // The removal record itself is dead, and so is the value it removed.
+          if (!removeValue(currentKey))
+            m_deadRecordCount++;
+          m_logRecordCount++;
           break;
 
         default:
-          m_fileIOHelper->clear();
-          setStorageLoadedEvent();
-          throw std::exception("Corrupt storage file. Unexpected prefix on line. Storage file cleared.");
+          throw StorageCorruptionException("Corrupt storage file. Unexpected prefix on line. Storage file cleared.");
           break;
       }
+
+      firstRecord = false;
     }
   }
 
-  if (saveRequired) // cleanup the AOF by dumping the in memory map
-  {
-    saveTable();
+  // Storage files written before snapshot files existed hold the whole table.
+  m_migrationRequired = !m_baseFile && m_logRecordCount > 0;
+}
+
+// Must be called with m_storageMutex held, or before the storage is loaded.
+void KeyValueStorage::resetTable() {
+  if (m_baseFile)
+    m_baseFile->deleteOnClose();
+  m_baseFile.reset();
+  m_baseGeneration = 0;
+
+  m_kvMap.clear();
+  m_batchRecords.clear();
+  m_logRecordCount = 0;
+  m_deadRecordCount = 0;
+  m_migrationRequired = false;
+  m_compactionRetryLogRecordCount = 0;
+  m_compactionRetryInterval = MinRecordsForCompaction;
+}
+
+void KeyValueStorage::appendRecord(string &buffer, char prefix, string content) {
+  escapeString(content);
+  buffer += prefix;
+  buffer += content;
+  buffer += '\n';
+}
+
+optional<string_view> KeyValueStorage::findInSnapshot(const Snapshot &snapshot, const string &key) {
+  const auto &entries = snapshot.entries;
+  auto it = lower_bound(entries.begin(), entries.end(), key, [](const shared_ptr<const Entry> &entry, const string &k) {
+    return entry->first < k;
+  });
+  if (it != entries.end() && (*it)->first == key) {
+    if (!(*it)->second)
+      return nullopt;
+    return string_view(*(*it)->second);
   }
-  setStorageLoadedEvent();
+
+  if (snapshot.base) {
+    if (auto index = snapshot.base->find(key))
+      return snapshot.base->valueAt(*index);
+  }
+
+  return nullopt;
 }
 
-void KeyValueStorage::saveTable() {
-  m_fileIOHelper->clear();
-  stringstream cleanedUpFile;
+// Merges the changes of a snapshot into the entries of its snapshot file. The
+// result is sorted by key and refers to memory owned by the snapshot.
+vector<pair<string_view, string_view>> KeyValueStorage::mergeSnapshot(const Snapshot &snapshot) {
+  const size_t baseSize = snapshot.base ? snapshot.base->size() : 0;
+  size_t baseIndex = 0;
 
-  for (auto const &entry : m_kvMap) // convert in memory map to a string
-  {
-    string key = entry.first;
-    string value = entry.second;
+  vector<pair<string_view, string_view>> merged;
+  merged.reserve(baseSize + snapshot.entries.size());
+
+  for (auto const &entry : snapshot.entries) {
+    for (; baseIndex < baseSize && snapshot.base->keyAt(baseIndex) < entry->first; baseIndex++)
+      merged.emplace_back(snapshot.base->keyAt(baseIndex), snapshot.base->valueAt(baseIndex));
+
+    if (baseIndex < baseSize && snapshot.base->keyAt(baseIndex) == entry->first)
+      baseIndex++; // the entry was updated or removed
+
+    if (entry->second)
+      merged.emplace_back(entry->first, *entry->second);
+  }
+
+  for (; baseIndex < baseSize; baseIndex++)
+    merged.emplace_back(snapshot.base->keyAt(baseIndex), snapshot.base->valueAt(baseIndex));
+
+  return merged;
+}
+
+shared_ptr<const KeyValueStorage::Snapshot> KeyValueStorage::currentSnapshot() const noexcept {
+  return atomic_load(&m_snapshot);
+}
+
+// Must be called with m_storageMutex held.
+optional<string_view> KeyValueStorage::findValue(const string &key) const {
+  auto it = m_kvMap.find(key);
+  if (it != m_kvMap.end()) {
+    if (!it->second)
+      return nullopt;
+    return string_view(*it->second);
+  }
+
+  if (m_baseFile) {
+    if (auto index = m_baseFile->find(key))
+      return m_baseFile->valueAt(*index);
+  }
+
+  return nullopt;
+}
+
+// Must be called with m_storageMutex held.
+// Returns false if the key already has that value.
+bool KeyValueStorage::setValue(const string &key, const string &value) {
+  auto current = findValue(key);
+  if (current && *current == value)
+    return false;
+
+  if (current)
+    m_deadRecordCount++;
+
+  m_kvMap[key] = value;
+  m_unpublishedKeys.insert(key);
+  if (m_compactionInProgress)
+    m_compactionChangedKeys.insert(key);
+  return true;
+}
+
+// Must be called with m_storageMutex held.
+// Returns false if the key does not exist.
+bool KeyValueStorage::removeValue(const string &key) {
+  if (!findValue(key))
+    return false;
+
+  // Both the removed value and the removal record are dead.
+  m_deadRecordCount += 2;
+
+  // Keys of the snapshot file are removed by a change without a value.
+  if (m_baseFile && m_baseFile->find(key))
+    m_kvMap[key] = nullopt;
+  else
+    m_kvMap.erase(key);
+
+  m_unpublishedKeys.insert(key);
+  if (m_compactionInProgress)
+    m_compactionChangedKeys.insert(key);
+  return true;
+}
+
+// Must be called with m_storageMutex held.
+// Merges the keys changed since the last snapshot into a copy of it. Entries
+// of unchanged keys are shared between both snapshots.
+void KeyValueStorage::publishSnapshot() {
+  auto current = currentSnapshot();
+  auto next = make_shared<Snapshot>();
+  next->version = current->version + 1;
+  next->base = m_baseFile;
+  next->entries.reserve(m_kvMap.size());
+
+  if (current->entries.empty() || current->base != m_baseFile) {
+    // Initial load, or the snapshot file changed: no entry to share.
+    for (auto const &kv : m_kvMap)
+      next->entries.push_back(make_shared<const Entry>(kv));
+  } else {
+    auto currentIt = current->entries.begin();
+    const auto currentEnd = current->entries.end();
+    for (auto const &key : m_unpublishedKeys) {
+      while (currentIt != currentEnd && (*currentIt)->first < key)
+        next->entries.push_back(*currentIt++);
+
+      if (currentIt != currentEnd && (*currentIt)->first == key)
+        ++currentIt; // the entry was updated or removed
+
+      auto kvIt = m_kvMap.find(key);
+      if (kvIt != m_kvMap.end())
+        next->entries.push_back(make_shared<const Entry>(*kvIt));
+    }
+    next->entries.insert(next->entries.end(), currentIt, currentEnd);
+  }
 
-    escapeString(key);
-    escapeString(value);
+  m_unpublishedKeys.clear();
+  atomic_store(&m_snapshot, shared_ptr<const Snapshot>(std::move(next)));
+}
 
-    cleanedUpFile << KeyPrefix << key << '\n' << ValuePrefix << value << '\n';
+// Must be called with m_storageMutex held.
+void KeyValueStorage::appendRecords(const string &records) {
+  if (m_batchActive) {
+    m_batchRecords += records;
+    return;
   }
 
-  m_fileIOHelper->append(cleanedUpFile.str());
-  m_fileIOHelper->flush();
+  writeRecords(records, false /*durable*/);
+}
+
+// Must be called with m_storageMutex held.
+void KeyValueStorage::writeRecords(const string &records, bool durable) {
+  m_fileIOHelper->append(records);
+  if (durable)
+    m_fileIOHelper->sync();
+  else
+    m_fileIOHelper->flush();
+
+  if (m_compactionInProgress)
+    m_compactionTail += records;
+}
+
+// Must be called with m_storageMutex held.
+void KeyValueStorage::scheduleCompactionIfNeeded() {
+  // The table already contains the changes of an open batch, but the file
+  // does not. Wait for the batch to be committed before taking a snapshot.
+  if (m_batchActive || m_compactionInProgress)
+    return;
+
+  // Back off after a failed compaction instead of retrying on every write.
+  if (m_logRecordCount < m_compactionRetryLogRecordCount)
+    return;
+
+  const size_t baseEntryCount = m_baseFile ? m_baseFile->size() : 0;
+  const bool tooManyDeadRecords = m_deadRecordCount >= MinRecordsForCompaction &&
+      m_deadRecordCount >= m_compactionThreshold * (baseEntryCount + m_logRecordCount);
+  const bool logLargerThanBase = m_logRecordCount >= MinRecordsForCompaction && m_logRecordCount > baseEntryCount;
+  if (!m_migrationRequired && !tooManyDeadRecords && !logLargerThanBase)
+    return;
+
+  m_compactionInProgress = true;
+  m_compactionCancelled = false;
+  m_compactionTail.clear();
+  m_compactionChangedKeys.clear();
+
+  // Outside of a batch the published snapshot matches m_kvMap.
+  m_compactionTask = async(
+      launch::async,
+      [this,
+       snapshot = currentSnapshot(),
+       generation = ++m_lastGeneration,
+       logRecordCountAtSnapshot = m_logRecordCount,
+       deadRecordCountAtSnapshot = m_deadRecordCount]() noexcept {
+        compact(snapshot, generation, logRecordCountAtSnapshot, deadRecordCountAtSnapshot);
+      });
+}
+
+// Writes a snapshot of the table to a new snapshot file, then replaces the
+// storage file with one that references it. Records appended after the
+// snapshot was taken are collected in m_compactionTail and carried over to
+// the new storage file. Replacing the storage file is the commit point: until
+// then the previous snapshot file and log stay in use.
+void KeyValueStorage::compact(
+    const shared_ptr<const Snapshot> &snapshot,
+    uint32_t generation,
+    size_t logRecordCountAtSnapshot,
+    size_t deadRecordCountAtSnapshot) noexcept {
+  shared_ptr<KeyValueSnapshotFile> baseFile;
+  bool committed = false;
+
+  try {
+    m_fileIOHelper->writeSnapshotFile(generation, KeyValueSnapshotFile::serialize(mergeSnapshot(*snapshot)));
+    baseFile = make_shared<KeyValueSnapshotFile>(m_fileIOHelper->snapshotFilePath(generation));
+
+    unique_lock<mutex> lock(m_storageMutex);
+
+    // Republishing below must not expose the changes of an open batch.
+    m_batchCommitted.wait(lock, [this]() { return !m_batchActive; });
+
+    if (m_compactionCancelled) {
+      baseFile->deleteOnClose();
+    } else {
+      string baseRecord;
+      appendRecord(baseRecord, BasePrefix, to_string(generation));
+      m_fileIOHelper->writeReplacement(baseRecord);
+      m_fileIOHelper->commitReplacement(m_compactionTail);
+      committed = true;
+
+      // Express the changes made since the snapshot relative to the new
+      // snapshot file.
+      map<string, optional<string>> changes;
+      for (auto const &key : m_compactionChangedKeys) {
+        if (auto value = findValue(key))
+          changes.emplace(key, string(*value));
+        else if (baseFile->find(key))
+          changes.emplace(key, nullopt);
+      }
+
+      if (m_baseFile)
+        m_baseFile->deleteOnClose(); // once readers of older snapshots are done
+      m_baseFile = baseFile;
+      m_baseGeneration = generation;
+      m_kvMap = std::move(changes);
+      m_logRecordCount -= logRecordCountAtSnapshot;
+      m_deadRecordCount -= deadRecordCountAtSnapshot;
+      m_migrationRequired = false;
+      m_compactionRetryLogRecordCount = 0;
+      m_compactionRetryInterval = MinRecordsForCompaction;
+      publishSnapshot();
+    }
+  } catch (const std::exception &) {
+    // The storage file is left untouched if compaction fails. It is retried
+    // once enough records have been appended since the failure.
+    if (baseFile && !committed)
+      baseFile->deleteOnClose();
+
+    lock_guard<mutex> lock(m_storageMutex);
+    m_compactionRetryLogRecordCount = m_logRecordCount + m_compactionRetryInterval;
+    m_compactionRetryInterval *= 2;
+  }
+
+  lock_guard<mutex> lock(m_storageMutex);
+  m_compactionInProgress = false;
+  m_compactionCancelled = false;
+  m_compactionTail.clear();
+  m_compactionChangedKeys.clear();
 }
 
 void KeyValueStorage::waitForStorageLoadComplete() {
@@ -102,18 +442,24 @@ void KeyValueStorage::waitForStorageLoadComplete() {
   if (WaitForSingleObject(m_storageFileLoaded, dwMilliseconds) != WAIT_OBJECT_0)
     StorageFileIO::throwLastErrorMessage();
 
-  if (m_storageFileLoader.valid())
+  // Only the first caller observes an exception thrown by load(). Readers and
+  // the writer can get here concurrently, so the future is consumed only once.
+  if (!m_storageFileLoaderDone.exchange(true))
     m_storageFileLoader.get();
+
+  if (m_loadError)
+    rethrow_exception(m_loadError);
 }
 
 vector<tuple<string, string>> KeyValueStorage::multiGet(const vector<string> &keys) {
   waitForStorageLoadComplete();
 
+  auto snapshot = currentSnapshot();
+
   vector<tuple<string, string>> result;
   for (auto const &k : keys) {
-    if (m_kvMap.find(k) != m_kvMap.end()) {
-      result.emplace_back(k, m_kvMap[k]);
-    }
+    if (auto value = findInSnapshot(*snapshot, k))
+      result.emplace_back(k, string(*value));
   }
 
   return result;
@@ -122,59 +468,148 @@ vector<tuple<string, string>> KeyValueStorage::multiGet(const vector<string> &ke
 void KeyValueStorage::multiSet(const vector<tuple<string, string>> &keyValuePairs) {
   waitForStorageLoadComplete();
 
-  stringstream appendEntry;
-  bool fUpdateStorageFile = false;
+  lock_guard<mutex> lock(m_storageMutex);
+  setValues(keyValuePairs);
+}
+
+// Must be called with m_storageMutex held.
+void KeyValueStorage::setValues(const vector<tuple<string, string>> &keyValuePairs) {
+  string appendEntry;
 
   for (auto const &kvTuple : keyValuePairs) {
-    string key = get<0>(kvTuple);
-    string value = get<1>(kvTuple);
-
-    // check if we need to modify the storage file
-    // 1. if key does not exist
-    // 2. if keys exists and value is different
-    if (m_kvMap.find(key) == m_kvMap.end() || m_kvMap[key] != value) {
-      // update the in-memory map
-      m_kvMap[key] = value;
-      fUpdateStorageFile = true;
-      escapeString(key);
-      escapeString(value);
-      appendEntry << KeyPrefix << key << '\n' << ValuePrefix << value << '\n';
-    }
+    const string &key = get<0>(kvTuple);
+    const string &value = get<1>(kvTuple);
+
+    // only modify the storage file if the key does not exist or its value is
+    // different
+    if (!setValue(key, value))
+      continue;
+
+    appendRecord(appendEntry, KeyPrefix, key);
+    appendRecord(appendEntry, ValuePrefix, value);
+    m_logRecordCount++;
   }
 
-  if (fUpdateStorageFile) {
-    // write the new keys to the file
-    saveTable();
+  if (!appendEntry.empty()) {
+    // write only the changed records to the file
+    appendRecords(appendEntry);
+    if (!m_batchActive)
+      publishSnapshot();
+    scheduleCompactionIfNeeded();
   }
 }
 
 void KeyValueStorage::multiRemove(const vector<string> &keys) {
   waitForStorageLoadComplete();
 
+  lock_guard<mutex> lock(m_storageMutex);
+  string appendEntry;
+
   for (auto const &k : keys) {
-    m_kvMap.erase(k);
+    if (removeValue(k)) {
+      appendRecord(appendEntry, KeyPrefix, k);
+      appendRecord(appendEntry, RemovePrefix, string());
+      m_logRecordCount++;
+    }
   }
 
-  saveTable();
+  if (!appendEntry.empty()) {
+    appendRecords(appendEntry);
+    if (!m_batchActive)
+      publishSnapshot();
+    scheduleCompactionIfNeeded();
+  }
 }
 
 void KeyValueStorage::multiMerge(const vector<tuple<string, string>> &keyValuePairs) {
-  throw std::exception("Error: not implemented.");
+  waitForStorageLoadComplete();
+
+  lock_guard<mutex> lock(m_storageMutex);
+
+  // Merge all values before changing the table, so that an invalid value
+  // leaves it untouched. A key merged more than once merges into the result
+  // of the previous merge.
+  map<string, string> mergedValues;
+  for (auto const &kvTuple : keyValuePairs) {
+    const string &key = get<0>(kvTuple);
+    auto merged = mergedValues.find(key);
+    auto current = merged != mergedValues.end() ? optional<string_view>(merged->second) : findValue(key);
+    mergedValues[key] = JsonMerge::deepMerge(current ? *current : "{}", get<1>(kvTuple));
+  }
+
+  vector<tuple<string, string>> keyValues;
+  keyValues.reserve(mergedValues.size());
+  for (auto &kv : mergedValues)
+    keyValues.emplace_back(kv.first, std::move(kv.second));
+
+  setValues(keyValues);
 }
 
 void KeyValueStorage::clear() {
   waitForStorageLoadComplete();
 
-  m_kvMap.clear();
+  lock_guard<mutex> lock(m_storageMutex);
+  if (m_compactionInProgress)
+    m_compactionCancelled = true;
+
+  resetTable();
   m_fileIOHelper->clear();
+
+  auto cleared = make_shared<Snapshot>();
+  cleared->version = currentSnapshot()->version + 1;
+  m_unpublishedKeys.clear();
+  atomic_store(&m_snapshot, shared_ptr<const Snapshot>(std::move(cleared)));
+}
+
+void KeyValueStorage::beginBatch() {
+  waitForStorageLoadComplete();
+
+  // The records of a batch that failed to commit are kept, and they are
+  // written together with the records of this batch.
+  lock_guard<mutex> lock(m_storageMutex);
+  m_batchActive = true;
+}
+
+void KeyValueStorage::commitBatch() {
+  lock_guard<mutex> lock(m_storageMutex);
+
+  // The batch stays open until its records are durable. If they cannot be
+  // written, readers do not see the changes, and the next commitBatch writes
+  // the records again. A failed write may leave a partial record at the end
+  // of the file: the retry starts with an empty line, so that the partial
+  // record is replayed on its own and then overwritten by the full one.
+  if (!m_batchRecords.empty()) {
+    try {
+      writeRecords(m_batchRecords, true /*durable*/);
+    } catch (...) {
+      if (m_batchRecords.front() != '\n')
+        m_batchRecords.insert(0, 1, '\n');
+      throw;
+    }
+
+    m_batchRecords.clear();
+  }
+
+  m_batchActive = false;
+  m_batchCommitted.notify_all();
+
+  // Readers see the changes of a batch only once it is durable.
+  if (!m_unpublishedKeys.empty()) {
+    publishSnapshot();
+    scheduleCompactionIfNeeded();
+  }
 }
 
 vector<string> KeyValueStorage::getAllKeys() {
   waitForStorageLoadComplete();
 
+  auto snapshot = currentSnapshot();
+  auto entries = mergeSnapshot(*snapshot);
+
   vector<string> keys;
-  for (auto const &i : m_kvMap) {
-    keys.push_back(i.first);
+  keys.reserve(entries.size());
+  for (auto const &entry : entries) {
+    keys.emplace_back(entry.first);
   }
   return keys;
 }
@@ -237,7 +672,7 @@ void KeyValueStorage::unescapeString(string &escapedString) {
         *write = '\n';
         break;
       default:
-        throw std::exception("Corrupt storage file. Found unexpected backslash.");
+        throw StorageCorruptionException("Corrupt storage file. Found unexpected backslash.");
     }
   }
   *write = '\0';
@@ -3,18 +3,33 @@
 
 #pragma once
 
+#include <atomic>
 #include <future>
 #include <map>
 #include <memory>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <vector>
 
+#include <AsyncStorage/KeyValueSnapshotFile.h>
 #include <AsyncStorage/StorageFileIO.h>
 
 namespace facebook {
 namespace react {
 class KeyValueStorage {
  public:
-  KeyValueStorage(const WCHAR *storageFileName);
+  // The table is stored as a memory-mapped binary snapshot (see
+  // KeyValueSnapshotFile) plus a text log of the changes made since. The log
+  // is compacted into a new snapshot in the background once the ratio of dead
+  // records (overwritten values and removals) to all records exceeds
+  // compactionThreshold, or once the log holds more records than the snapshot.
+  static constexpr float DefaultCompactionThreshold = 0.5f;
+
+  KeyValueStorage(const WCHAR *storageFileName, float compactionThreshold = DefaultCompactionThreshold);
+  KeyValueStorage(std::unique_ptr<StorageFileIO> fileIOHelper, float compactionThreshold = DefaultCompactionThreshold);
+  ~KeyValueStorage();
 
   std::vector<std::tuple<std::string, std::string>> multiGet(const std::vector<std::string> &keys);
   void multiSet(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
@@ -23,28 +38,98 @@ class KeyValueStorage {
   void clear();
   std::vector<std::string> getAllKeys();
 
+  // Writes made between beginBatch and commitBatch are applied to the table
+  // right away, but reach the storage file with a single append and sync in
+  // commitBatch. Batches must be driven from the single writer thread.
+  // If commitBatch throws, the batch stays open and its changes stay hidden
+  // from readers until a later commitBatch writes them.
+  void beginBatch();
+  void commitBatch();
+
  private:
   static const uint32_t EstimatedKeySize = 100; // in chars
   static const uint32_t EstimatedValueSize = 200;
+  static const uint32_t MinRecordsForCompaction = 64;
+  static const char BasePrefix = 'B'; // first record of the log, names the snapshot generation it applies to
   static const char KeyPrefix = '$';
   static const char ValuePrefix = '%';
   static const char RemovePrefix = 'R'; // Keep RemovePrefix to be backward compatible for the storage file format
 
+  // Immutable view of the table: the snapshot file plus the changes made on
+  // top of it, sorted by key. A change without a value removes the key from
+  // the snapshot file. Readers load the current snapshot atomically and never
+  // take m_storageMutex. Writers publish a new snapshot that shares all
+  // unchanged entries with the previous one.
+  using Entry = std::pair<std::string, std::optional<std::string>>;
+  struct Snapshot {
+    uint64_t version{0};
+    std::shared_ptr<KeyValueSnapshotFile> base;
+    std::vector<std::shared_ptr<const Entry>> entries;
+  };
+
  private:
-  std::map<std::string, std::string> m_kvMap;
+  std::map<std::string, std::optional<std::string>> m_kvMap; // changes on top of m_baseFile
+  std::shared_ptr<KeyValueSnapshotFile> m_baseFile;
+  uint32_t m_baseGeneration{0}; // generation named by the log, 0 if there is no snapshot file
+  uint32_t m_lastGeneration{0}; // last generation written, snapshot files are never reused
   std::unique_ptr<StorageFileIO> m_fileIOHelper;
   HANDLE m_storageFileLoaded;
   std::future<void> m_storageFileLoader;
+  std::atomic_bool m_storageFileLoaderDone{false};
+  std::exception_ptr m_loadError; // set before m_storageFileLoaded if the files could not be read
+
+  // Use std::atomic_load and std::atomic_store to access m_snapshot.
+  std::shared_ptr<const Snapshot> m_snapshot{std::make_shared<const Snapshot>()};
+  std::set<std::string> m_unpublishedKeys; // keys changed since the last published snapshot
+
+  // Guards the writer state (m_kvMap, m_baseFile, m_unpublishedKeys,
+  // m_fileIOHelper and the batch and compaction state below) against the
+  // background compaction task.
+  std::mutex m_storageMutex;
+  float m_compactionThreshold;
+  size_t m_logRecordCount{0}; // values and removals in the log
+  size_t m_deadRecordCount{0};
+  bool m_migrationRequired{false}; // the log was written in the text-only format
+  bool m_batchActive{false};
+  std::condition_variable m_batchCommitted;
+  std::string m_batchRecords; // records of the open batch that are not in the storage file yet
+  bool m_compactionInProgress{false};
+  bool m_compactionCancelled{false};
+  // A failed compaction is retried once the log has grown by
+  // m_compactionRetryInterval records. The interval doubles on each failure.
+  size_t m_compactionRetryLogRecordCount{0};
+  size_t m_compactionRetryInterval{MinRecordsForCompaction};
+  std::string m_compactionTail; // records appended while a compaction is in progress
+  std::set<std::string> m_compactionChangedKeys; // keys changed while a compaction is in progress
+  std::future<void> m_compactionTask;
 
  private:
   static void escapeString(std::string &unescapedString);
   static void unescapeString(std::string &escapedString);
+  static void appendRecord(std::string &buffer, char prefix, std::string content);
+  static std::optional<std::string_view> findInSnapshot(const Snapshot &snapshot, const std::string &key);
+  static std::vector<std::pair<std::string_view, std::string_view>> mergeSnapshot(const Snapshot &snapshot);
 
  private:
   void load();
   void waitForStorageLoadComplete();
   void setStorageLoadedEvent();
-  void saveTable();
+  void loadStorageFile();
+  void resetTable();
+  std::optional<std::string_view> findValue(const std::string &key) const;
+  bool setValue(const std::string &key, const std::string &value);
+  bool removeValue(const std::string &key);
+  void setValues(const std::vector<std::tuple<std::string, std::string>> &keyValuePairs);
+  void appendRecords(const std::string &records);
+  void writeRecords(const std::string &records, bool durable);
+  void publishSnapshot();
+  std::shared_ptr<const Snapshot> currentSnapshot() const noexcept;
+  void scheduleCompactionIfNeeded();
+  void compact(
+      const std::shared_ptr<const Snapshot> &snapshot,
+      uint32_t generation,
+      size_t logRecordCountAtSnapshot,
+      size_t deadRecordCountAtSnapshot) noexcept;
 };
 } // namespace react
 } // namespace facebook
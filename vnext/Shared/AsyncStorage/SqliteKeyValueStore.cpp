@@ -0,0 +1,263 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include <AsyncStorage/SqliteKeyValueStore.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+// Resets a cached statement and clears its bindings when it goes out of
+// scope, so that it can be reused by the next call.
+class StatementReset final {
+  sqlite3_stmt *m_stmt;
+
+ public:
+  explicit StatementReset(sqlite3_stmt *stmt) noexcept : m_stmt(stmt) {}
+  StatementReset(const StatementReset &) = delete;
+  StatementReset &operator=(const StatementReset &) = delete;
+
+  ~StatementReset() {
+    sqlite3_reset(m_stmt);
+    sqlite3_clear_bindings(m_stmt);
+  }
+};
+
+int LargestPowerOfTwoAtMost(int value) {
+  int result = 1;
+  while (result <= value / 2) {
+    result *= 2;
+  }
+  return result;
+}
+
+int SmallestPowerOfTwoAtLeast(int value) {
+  int result = 1;
+  while (result < value) {
+    result *= 2;
+  }
+  return result;
+}
+
+} // namespace
+
+namespace facebook {
+namespace react {
+
+SqliteKeyValueStore::SqliteKeyValueStore(const char *dbPath) {
+  if (sqlite3_open_v2(dbPath, &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr) !=
+      SQLITE_OK) {
+    auto exception = std::runtime_error(sqlite3_errmsg(m_db));
+    sqlite3_close(m_db);
+    throw exception;
+  }
+
+  try {
+    int userVersion = 0;
+    {
+      auto stmt = prepareCached("PRAGMA user_version");
+      StatementReset reset(stmt);
+      if (sqlite3_step(stmt) == SQLITE_ROW)
+        userVersion = sqlite3_column_int(stmt, 0);
+    }
+
+    if (userVersion == 0) {
+      execute("CREATE TABLE IF NOT EXISTS AsyncLocalStorage(key TEXT PRIMARY KEY, value TEXT NOT NULL)");
+      execute("PRAGMA user_version=1");
+    }
+  } catch (...) {
+    m_statements.clear();
+    sqlite3_close(m_db);
+    throw;
+  }
+
+  m_variableLimit = sqlite3_limit(m_db, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+}
+
+SqliteKeyValueStore::~SqliteKeyValueStore() {
+  try {
+    close();
+  } catch (const std::exception &) {
+    // sqlite3_close_v2 closes the connection once nothing uses it anymore.
+    sqlite3_close_v2(m_db);
+  }
+}
+
+void SqliteKeyValueStore::close() {
+  if (!m_db)
+    return;
+
+  // Statements must be finalized before the connection can be closed.
+  m_statements.clear();
+  check(sqlite3_close(m_db));
+  m_db = nullptr;
+}
+
+void SqliteKeyValueStore::throwLastError() const {
+  throw std::runtime_error(sqlite3_errmsg(m_db));
+}
+
+void SqliteKeyValueStore::check(int sqliteResult) const {
+  if (sqliteResult != SQLITE_OK)
+    throwLastError();
+}
+
+sqlite3_stmt *SqliteKeyValueStore::prepareCached(const std::string &sql) {
+  auto it = m_statements.find(sql);
+  if (it != m_statements.end())
+    return it->second.get();
+
+  sqlite3_stmt *pStmt{nullptr};
+  check(sqlite3_prepare_v2(m_db, sql.c_str(), -1, &pStmt, nullptr));
+  return m_statements.emplace(sql, Statement{pStmt, &sqlite3_finalize}).first->second.get();
+}
+
+// Returns the cached statement "<prefix>(?,?,...)" with variableCount variables.
+sqlite3_stmt *SqliteKeyValueStore::prepareKeyList(const char *prefix, int variableCount) {
+  std::string sql(prefix);
+  sql.reserve(sql.size() + (variableCount * 2) + 1);
+  sql += '(';
+  for (int x = 0; x < variableCount - 1; x++) {
+    sql += "?,";
+  }
+  sql += "?)";
+  return prepareCached(sql);
+}
+
+void SqliteKeyValueStore::bindText(sqlite3_stmt *stmt, int index, const std::string &text) {
+  // The bound strings outlive the step, and StatementReset clears the bindings
+  // afterwards, so SQLite does not need to copy them.
+  check(sqlite3_bind_text(stmt, index, text.c_str(), static_cast<int>(text.size()), SQLITE_STATIC));
+}
+
+void SqliteKeyValueStore::execute(const std::string &sql) {
+  auto stmt = prepareCached(sql);
+  StatementReset reset(stmt);
+  for (auto rc = sqlite3_step(stmt); rc != SQLITE_DONE; rc = sqlite3_step(stmt)) {
+    if (rc != SQLITE_ROW)
+      throwLastError();
+  }
+}
+
+// Splits keys into chunks of at most SQLITE_LIMIT_VARIABLE_NUMBER and runs
+// "<prefix>(?,...)" for each of them. The variable count of every statement
+// is rounded up to a power of two, and unused variables stay NULL, so only a
+// handful of distinct statements end up in the cache.
+void SqliteKeyValueStore::forEachKeyChunk(
+    const std::vector<std::string> &keys,
+    const char *prefix,
+    const std::function<void(sqlite3_stmt *)> &onChunk) {
+  const int maxChunkSize = LargestPowerOfTwoAtMost((std::max)(m_variableLimit, 1));
+  const int keyCount = static_cast<int>(keys.size());
+
+  for (int offset = 0; offset < keyCount; offset += maxChunkSize) {
+    const int chunkSize = (std::min)(maxChunkSize, keyCount - offset);
+    auto stmt = prepareKeyList(prefix, SmallestPowerOfTwoAtLeast(chunkSize));
+    StatementReset reset(stmt);
+    for (int i = 0; i < chunkSize; i++) {
+      bindText(stmt, i + 1, keys[offset + i]);
+    }
+    onChunk(stmt);
+  }
+}
+
+std::vector<std::pair<std::string, std::string>> SqliteKeyValueStore::multiGet(const std::vector<std::string> &keys) {
+  std::vector<std::pair<std::string, std::string>> result;
+  result.reserve(keys.size());
+
+  forEachKeyChunk(keys, "SELECT key, value FROM AsyncLocalStorage WHERE key IN ", [&](sqlite3_stmt *stmt) {
+    for (auto rc = sqlite3_step(stmt); rc != SQLITE_DONE; rc = sqlite3_step(stmt)) {
+      if (rc != SQLITE_ROW)
+        throwLastError();
+
+      auto key = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+      auto keyLength = sqlite3_column_bytes(stmt, 0);
+      auto value = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 1));
+      auto valueLength = sqlite3_column_bytes(stmt, 1);
+      if (!key || !value)
+        throwLastError();
+
+      result.emplace_back(std::string(key, keyLength), std::string(value, valueLength));
+    }
+  });
+
+  return result;
+}
+
+void SqliteKeyValueStore::multiSet(const std::vector<std::pair<std::string, std::string>> &keyValuePairs) {
+  auto stmt = prepareCached("INSERT OR REPLACE INTO AsyncLocalStorage VALUES(?, ?)");
+  for (auto const &kvp : keyValuePairs) {
+    StatementReset reset(stmt);
+    bindText(stmt, 1, kvp.first);
+    bindText(stmt, 2, kvp.second);
+    if (sqlite3_step(stmt) != SQLITE_DONE)
+      throwLastError();
+  }
+}
+
+void SqliteKeyValueStore::multiRemove(const std::vector<std::string> &keys) {
+  forEachKeyChunk(keys, "DELETE FROM AsyncLocalStorage WHERE key IN ", [&](sqlite3_stmt *stmt) {
+    if (sqlite3_step(stmt) != SQLITE_DONE)
+      throwLastError();
+  });
+}
+
+void SqliteKeyValueStore::clear() {
+  execute("DELETE FROM AsyncLocalStorage");
+}
+
+std::vector<std::string> SqliteKeyValueStore::getAllKeys() {
+  std::vector<std::string> result;
+
+  auto stmt = prepareCached("SELECT key FROM AsyncLocalStorage");
+  StatementReset reset(stmt);
+  for (auto rc = sqlite3_step(stmt); rc != SQLITE_DONE; rc = sqlite3_step(stmt)) {
+    if (rc != SQLITE_ROW)
+      throwLastError();
+
+    auto key = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+    if (key)
+      result.emplace_back(key, sqlite3_column_bytes(stmt, 0));
+  }
+
+  return result;
+}
+
+void SqliteKeyValueStore::beginTransaction() {
+  execute("BEGIN TRANSACTION");
+}
+
+void SqliteKeyValueStore::commitTransaction() {
+  execute("COMMIT");
+}
+
+void SqliteKeyValueStore::rollbackTransaction() noexcept {
+  try {
+    execute("ROLLBACK");
+  } catch (const std::exception &) {
+    // SQLite may already have rolled back the transaction on its own.
+  }
+}
+
+void SqliteKeyValueStore::beginSavepoint() {
+  execute("SAVEPOINT task");
+}
+
+void SqliteKeyValueStore::releaseSavepoint() {
+  execute("RELEASE task");
+}
+
+void SqliteKeyValueStore::rollbackToSavepoint() noexcept {
+  try {
+    execute("ROLLBACK TO task");
+    execute("RELEASE task");
+  } catch (const std::exception &) {
+    // The enclosing transaction reports the failure when it is committed.
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#ifdef _WIN32
+#include <winsqlite/winsqlite3.h>
+#else
+#include <sqlite3.h>
+#endif
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+// SQL layer of AsyncStorageModuleWin32. It owns one SQLite connection and
+// caches the prepared statements it runs on it. It has no WinRT or folly
+// dependency so that it can be built and measured against stock SQLite.
+// All methods throw std::runtime_error with the SQLite error message on
+// failure. The class is not thread safe.
+class SqliteKeyValueStore {
+ public:
+  explicit SqliteKeyValueStore(const char *dbPath);
+  ~SqliteKeyValueStore();
+
+  SqliteKeyValueStore(const SqliteKeyValueStore &) = delete;
+  SqliteKeyValueStore &operator=(const SqliteKeyValueStore &) = delete;
+
+  std::vector<std::pair<std::string, std::string>> multiGet(const std::vector<std::string> &keys);
+  void multiSet(const std::vector<std::pair<std::string, std::string>> &keyValuePairs);
+  void multiRemove(const std::vector<std::string> &keys);
+  void clear();
+  std::vector<std::string> getAllKeys();
+
+  // A transaction spans a whole batch of tasks. Each task runs inside its own
+  // savepoint so that a failing task does not undo the others.
+  void beginTransaction();
+  void commitTransaction();
+  void rollbackTransaction() noexcept;
+  void beginSavepoint();
+  void releaseSavepoint();
+  void rollbackToSavepoint() noexcept;
+
+  // Finalizes the cached statements and closes the connection. It throws if
+  // the connection cannot be closed. The store must not be used afterwards.
+  void close();
+
+  // The number of prepared statements kept for reuse.
+  size_t cachedStatementCount() const noexcept {
+    return m_statements.size();
+  }
+
+ private:
+  using Statement = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
+
+  sqlite3 *m_db{nullptr};
+  int m_variableLimit{0};
+  std::unordered_map<std::string, Statement> m_statements;
+
+  [[noreturn]] void throwLastError() const;
+  void check(int sqliteResult) const;
+  sqlite3_stmt *prepareCached(const std::string &sql);
+  sqlite3_stmt *prepareKeyList(const char *prefix, int variableCount);
+  void bindText(sqlite3_stmt *stmt, int index, const std::string &text);
+  void execute(const std::string &sql);
+  void forEachKeyChunk(
+      const std::vector<std::string> &keys,
+      const char *prefix,
+      const std::function<void(sqlite3_stmt *)> &onChunk);
+};
+
+} // namespace react
+} // namespace facebook
@@ -15,6 +15,7 @@
 
 #include <fcntl.h>
 #include <io.h>
+#include <algorithm>
 
 #ifdef LIBLET_BUILD
 #include <oacr.h>
@@ -55,31 +56,50 @@ StorageFileIO::StorageFileIO(const WCHAR *storageFileName) {
   if (!CreateDirectoryW(strStorageFolderFullPath.c_str(), nullptr) && GetLastError() != ERROR_ALREADY_EXISTS)
     throwLastErrorMessage();
 
-    // The FILE_FLAG_WRITE_THROUGH can be specified to ensure any writes are
-    // written to the disk right away but it causes IO to be much slower (~10x).
+  m_storageFolderPath = strStorageFolderFullPath;
+  m_storageFilePath = strStorageFileFullPath;
+  m_replacementFilePath = strStorageFileFullPath + L".tmp";
+  m_snapshotFileName = storageFileName;
+
+  // A leftover replacement file means a compaction was interrupted before its
+  // rename. The storage file itself is still complete, so drop the temp file.
+  DeleteFileW(m_replacementFilePath.c_str());
+
+  openStorageFile();
+}
+
+HANDLE StorageFileIO::createFileHandle(const std::wstring &filePath, DWORD creationDisposition) {
+  // The FILE_FLAG_WRITE_THROUGH can be specified to ensure any writes are
+  // written to the disk right away but it causes IO to be much slower (~10x).
 #ifdef WINRT
   CREATEFILE2_EXTENDED_PARAMETERS extendedParams = {};
   extendedParams.dwSize = sizeof(CREATEFILE2_EXTENDED_PARAMETERS);
   extendedParams.dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
-  m_storageFileHandle = CreateFile2(
-      strStorageFileFullPath.c_str(),
+  HANDLE fileHandle = CreateFile2(
+      filePath.c_str(),
       GENERIC_READ | GENERIC_WRITE,
       FILE_SHARE_READ | FILE_SHARE_WRITE,
-      OPEN_ALWAYS,
+      creationDisposition,
       &extendedParams);
 #else
-  m_storageFileHandle = CreateFileW(
-      strStorageFileFullPath.c_str(),
+  HANDLE fileHandle = CreateFileW(
+      filePath.c_str(),
       GENERIC_READ | GENERIC_WRITE,
       FILE_SHARE_READ | FILE_SHARE_WRITE,
       nullptr,
-      OPEN_ALWAYS,
+      creationDisposition,
       FILE_ATTRIBUTE_NORMAL,
       nullptr);
 #endif
-  if (m_storageFileHandle == INVALID_HANDLE_VALUE)
+  if (fileHandle == INVALID_HANDLE_VALUE)
     throwLastErrorMessage();
 
+  return fileHandle;
+}
+
+void StorageFileIO::openStorageFile() {
+  m_storageFileHandle = createFileHandle(m_storageFilePath, OPEN_ALWAYS);
+
   int fdFileDescriptor = _open_osfhandle((intptr_t)m_storageFileHandle, _O_RDWR);
   if (fdFileDescriptor == -1)
     throwLastErrorMessage();
@@ -88,6 +108,10 @@ StorageFileIO::StorageFileIO(const WCHAR *storageFileName) {
       std::unique_ptr<FILE, std::function<void(FILE *)>>(_fdopen(fdFileDescriptor, "r+"), [](FILE *f) { fclose(f); });
   if (m_storageFile == nullptr)
     throwLastErrorMessage();
+
+  m_fileBufferInited = false;
+  m_fileBufferIdx = 0;
+  m_fileBufferSize = IOHelperBufferSize;
 }
 
 StorageFileIO::~StorageFileIO() {}
@@ -135,8 +159,12 @@ void StorageFileIO::clear() {
     throwLastErrorMessage();
 }
 
-// Append assumes the file seek pointer is at the end of the file.
+// Append always writes at the end of the file, even if the file was
+// previously read from.
 void StorageFileIO::append(const std::string &fileContent) {
+  if (fseek(m_storageFile.get(), 0, SEEK_END))
+    throwLastErrorMessage();
+
   fwrite(fileContent.c_str(), sizeof(char), fileContent.size(), m_storageFile.get());
 }
 
@@ -144,6 +172,133 @@ void StorageFileIO::flush() {
   fflush(m_storageFile.get());
 }
 
+// Flushes the CRT buffer and makes the written data durable on disk.
+void StorageFileIO::sync() {
+  flush();
+
+  if (!FlushFileBuffers(m_storageFileHandle))
+    throwLastErrorMessage();
+}
+
+void StorageFileIO::writeToHandle(HANDLE fileHandle, const std::string &fileContent) {
+  const char *data = fileContent.data();
+  size_t remaining = fileContent.size();
+  while (remaining > 0) {
+    DWORD bytesWritten = 0;
+    DWORD bytesToWrite = static_cast<DWORD>((std::min)(remaining, static_cast<size_t>(MAXDWORD)));
+    if (!WriteFile(fileHandle, data, bytesToWrite, &bytesWritten, nullptr))
+      throwLastErrorMessage();
+
+    data += bytesWritten;
+    remaining -= bytesWritten;
+  }
+}
+
+// Writes the complete new file content to the replacement file. This does not
+// touch the storage file and can run while other threads append to it.
+void StorageFileIO::writeReplacement(const std::string &fileContent) {
+  HANDLE replacementHandle = createFileHandle(m_replacementFilePath, CREATE_ALWAYS);
+  try {
+    writeToHandle(replacementHandle, fileContent);
+  } catch (...) {
+    CloseHandle(replacementHandle);
+    discardReplacement();
+    throw;
+  }
+  CloseHandle(replacementHandle);
+}
+
+// Appends the records written since writeReplacement to the replacement file,
+// makes it durable and renames it over the storage file. The caller must make
+// sure no other thread uses the storage file meanwhile.
+void StorageFileIO::commitReplacement(const std::string &trailingContent) {
+  HANDLE replacementHandle = createFileHandle(m_replacementFilePath, OPEN_EXISTING);
+  try {
+    if (SetFilePointer(replacementHandle, 0, nullptr, FILE_END) == INVALID_SET_FILE_POINTER)
+      throwLastErrorMessage();
+
+    writeToHandle(replacementHandle, trailingContent);
+
+    if (!FlushFileBuffers(replacementHandle))
+      throwLastErrorMessage();
+  } catch (...) {
+    CloseHandle(replacementHandle);
+    discardReplacement();
+    throw;
+  }
+  CloseHandle(replacementHandle);
+
+  // Closing the FILE also closes m_storageFileHandle.
+  m_storageFile.reset();
+  m_storageFileHandle = INVALID_HANDLE_VALUE;
+
+  BOOL renamed = MoveFileExW(
+      m_replacementFilePath.c_str(), m_storageFilePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+  DWORD renameError = renamed ? ERROR_SUCCESS : GetLastError();
+
+  openStorageFile();
+
+  if (!renamed) {
+    discardReplacement();
+    SetLastError(renameError);
+    throwLastErrorMessage();
+  }
+}
+
+void StorageFileIO::discardReplacement() noexcept {
+  DeleteFileW(m_replacementFilePath.c_str());
+}
+
+std::wstring StorageFileIO::snapshotFilePath(uint32_t generation) const {
+  return m_storageFolderPath + L"\\" + m_snapshotFileName + L"." + std::to_wstring(generation) + L".kvs";
+}
+
+// The snapshot file does not need to be written atomically: it only becomes
+// visible once the storage file referencing it has been committed.
+void StorageFileIO::writeSnapshotFile(uint32_t generation, const std::string &fileContent) {
+  const std::wstring filePath = snapshotFilePath(generation);
+  HANDLE snapshotHandle = createFileHandle(filePath, CREATE_ALWAYS);
+  try {
+    writeToHandle(snapshotHandle, fileContent);
+
+    if (!FlushFileBuffers(snapshotHandle))
+      throwLastErrorMessage();
+  } catch (...) {
+    CloseHandle(snapshotHandle);
+    DeleteFileW(filePath.c_str());
+    throw;
+  }
+  CloseHandle(snapshotHandle);
+}
+
+// Deletes snapshot files left behind by a compaction that did not commit, or
+// by a session that ended before it released an older snapshot.
+void StorageFileIO::deleteStaleSnapshotFiles(uint32_t currentGeneration) noexcept {
+  const std::wstring prefix = m_snapshotFileName + L".";
+  const std::wstring suffix = L".kvs";
+  const std::wstring pattern = m_storageFolderPath + L"\\" + prefix + L"*" + suffix;
+
+  WIN32_FIND_DATAW findData;
+  HANDLE findHandle = FindFirstFileExW(pattern.c_str(), FindExInfoBasic, &findData, FindExSearchNameMatch, nullptr, 0);
+  if (findHandle == INVALID_HANDLE_VALUE)
+    return;
+
+  do {
+    const std::wstring fileName = findData.cFileName;
+    if (fileName.size() <= prefix.size() + suffix.size())
+      continue;
+
+    const std::wstring generation = fileName.substr(prefix.size(), fileName.size() - prefix.size() - suffix.size());
+    if (generation.find_first_not_of(L"0123456789") != std::wstring::npos)
+      continue;
+
+    if (generation != std::to_wstring(currentGeneration))
+      DeleteFileW((m_storageFolderPath + L"\\" + fileName).c_str());
+  } while (FindNextFileW(findHandle, &findData));
+
+  FindClose(findHandle);
+}
+
 void StorageFileIO::throwLastErrorMessage() {
   char errorMessageBuffer[IOHelperBufferSize + 1] = {0};
   FormatMessageA(
@@ -12,20 +12,51 @@
 
 namespace facebook {
 namespace react {
+// Thrown when the storage file or a snapshot file has unexpected content.
+// Unlike I/O errors, which may go away in a later session, it makes
+// KeyValueStorage discard the stored data.
+class StorageCorruptionException : public std::exception {
+ public:
+  explicit StorageCorruptionException(const char *message) : std::exception(message) {}
+};
+
 class StorageFileIO {
  public:
   StorageFileIO(const WCHAR *storageFileName);
   virtual ~StorageFileIO();
 
   void clear();
-  void append(const std::string &fileContent);
+  virtual void append(const std::string &fileContent);
   void resetLine();
   bool getLine(std::string &line);
   void flush();
+  void sync();
+
+  // Crash-safe replacement of the storage file. The new content is written to
+  // a temp file next to the storage file, which is then renamed over it in
+  // commitReplacement. The storage file stays intact until the rename.
+  void writeReplacement(const std::string &fileContent);
+  void commitReplacement(const std::string &trailingContent);
+  void discardReplacement() noexcept;
+
+  // Binary snapshot files live next to the storage file and are numbered by
+  // generation. The storage file references the generation it builds upon.
+  std::wstring snapshotFilePath(uint32_t generation) const;
+  virtual void writeSnapshotFile(uint32_t generation, const std::string &fileContent);
+  void deleteStaleSnapshotFiles(uint32_t currentGeneration) noexcept;
 
   static void throwLastErrorMessage();
 
  private:
+  void openStorageFile();
+  HANDLE createFileHandle(const std::wstring &filePath, DWORD creationDisposition);
+  void writeToHandle(HANDLE fileHandle, const std::string &fileContent);
+
+ private:
+  std::wstring m_storageFolderPath;
+  std::wstring m_storageFilePath;
+  std::wstring m_replacementFilePath;
+  std::wstring m_snapshotFileName; // storage file name without extension
   HANDLE m_storageFileHandle;
   std::unique_ptr<FILE, std::function<void(FILE *)>> m_storageFile;
 
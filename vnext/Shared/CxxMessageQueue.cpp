@@ -3,10 +3,10 @@
 
 #include "CxxMessageQueue.h"
 
+#include <dispatchQueue/dispatchQueue.h>
 #include <folly/AtomicIntrusiveLinkedList.h>
 
 #include <mutex>
-#include <queue>
 #include <unordered_map>
 
 #include <glog/logging.h>
@@ -17,27 +17,16 @@ namespace react {
 using detail::BinarySemaphore;
 using detail::EventFlag;
 
-using clock = std::chrono::steady_clock;
-using time_point = clock::time_point;
-static_assert(std::is_same<time_point, EventFlag::time_point>::value, "");
-
 namespace {
-time_point now() {
-  return clock::now();
-}
 
 class Task {
  public:
   static Task *create(std::function<void()> &&func) {
-    return new Task{std::move(func), false, time_point()};
+    return new Task{std::move(func), false};
   }
 
   static Task *createSync(std::function<void()> &&func) {
-    return new Task{std::move(func), true, time_point()};
-  }
-
-  static Task *createDelayed(std::function<void()> &&func, time_point startTime) {
-    return new Task{std::move(func), false, startTime};
+    return new Task{std::move(func), true};
   }
 
   std::function<void()> func;
@@ -46,58 +35,13 @@ class Task {
   // the synchronous task might never resume. We use this flag to detect this
   // case and throw an error.
   bool sync;
-  time_point startTime;
 
   folly::AtomicIntrusiveLinkedListHook<Task> hook;
-
-  // Should this sort consider id also?
-  struct Compare {
-    bool operator()(const Task *a, const Task *b) {
-      return a->startTime > b->startTime;
-    }
-  };
-};
-
-class DelayedTaskQueue {
- public:
-  ~DelayedTaskQueue() {
-    while (!queue_.empty()) {
-      delete queue_.top();
-      queue_.pop();
-    }
-  }
-
-  void process() {
-    while (!queue_.empty()) {
-      Task *d = queue_.top();
-      if (now() < d->startTime) {
-        break;
-      }
-      auto owned = std::unique_ptr<Task>(queue_.top());
-      queue_.pop();
-      owned->func();
-    }
-  }
-
-  void push(Task *t) {
-    queue_.push(t);
-  }
-
-  bool empty() {
-    return queue_.empty();
-  }
-
-  time_point nextTime() {
-    return queue_.top()->startTime;
-  }
-
- private:
-  std::priority_queue<Task *, std::vector<Task *>, Task::Compare> queue_;
 };
 
 } // namespace
 
-class CxxMessageQueue::QueueRunner {
+class CxxMessageQueue::QueueRunner : public std::enable_shared_from_this<QueueRunner> {
  public:
   ~QueueRunner() {
     queue_.sweep([](Task *t) { delete t; });
@@ -109,7 +53,15 @@ class CxxMessageQueue::QueueRunner {
 
   void enqueueDelayed(std::function<void()> &&func, uint64_t delayMs) {
     if (delayMs) {
-      enqueueTask(Task::createDelayed(std::move(func), now() + std::chrono::milliseconds(delayMs)));
+      // The shared timer wheel keeps the delayed task and moves it to this queue when it is due.
+      // A runner destroyed before then drops the task.
+      Mso::DispatchQueue::ConcurrentQueue().PostDelayed(
+          std::chrono::milliseconds(delayMs),
+          [weakThis = weak_from_this(), func = std::move(func)]() mutable noexcept {
+            if (auto strongThis = weakThis.lock()) {
+              strongThis->enqueue(std::move(func));
+            }
+          });
     } else {
       enqueue(std::move(func));
     }
@@ -152,11 +104,7 @@ class CxxMessageQueue::QueueRunner {
     // matter reading stopped_.
     while (!stopped_.load(std::memory_order_relaxed)) {
       sweep();
-      if (delayed_.empty()) {
-        pending_.wait();
-      } else {
-        pending_.wait_until(delayed_.nextTime());
-      }
+      pending_.wait();
     }
     // This sweep is just to catch erroneous enqueueSync. That is, there could
     // be a task marked sync that another thread is waiting for, but we'll
@@ -165,12 +113,8 @@ class CxxMessageQueue::QueueRunner {
     finished_.set();
   }
 
-  // We are processing two queues, the posted tasks (queue_) and the delayed
-  // tasks (delayed_). Delayed tasks first go into posted tasks, and then are
-  // moved to the delayed queue if we pop them before the time they are
-  // scheduled for.
-  // As we pop things from queue_, before dealing with that thing, we run any
-  // delayed tasks whose scheduled time has arrived.
+  // Delayed tasks wait in the dispatch queue timer wheel and only reach queue_
+  // when they are due, so every task popped from queue_ is ready to run.
   void sweep() {
     queue_.sweep([this](Task *t) {
       std::unique_ptr<Task> owned(t);
@@ -181,14 +125,8 @@ class CxxMessageQueue::QueueRunner {
         return;
       }
 
-      delayed_.process();
-      if (t->startTime != time_point() && now() <= t->startTime) {
-        delayed_.push(owned.release());
-      } else {
-        t->func();
-      }
+      t->func();
     });
-    delayed_.process();
   }
 
   void bindToThisThread() {
@@ -214,7 +152,6 @@ class CxxMessageQueue::QueueRunner {
   folly::AtomicIntrusiveLinkedList<Task, &Task::hook> queue_;
 
   std::atomic_bool stopped_{false};
-  DelayedTaskQueue delayed_;
 
   BinarySemaphore pending_;
   EventFlag finished_;
@@ -110,6 +110,8 @@ void ChakraRuntime::Init() noexcept {
 /*virtual*/ ChakraRuntime::~ChakraRuntime() noexcept {
   m_undefinedValue = {};
   m_propertyId = {};
+  m_propertyIdFrontCache = {};
+  m_internedPropertyIds.clear();
   m_proxyConstructor = {};
   m_hostObjectProxyHandler = {};
 
@@ -304,13 +306,13 @@ facebook::jsi::Runtime::PointerValue *ChakraRuntime::clonePropNameID(
 }
 
 facebook::jsi::PropNameID ChakraRuntime::createPropNameIDFromAscii(const char *str, size_t length) {
-  const JsPropertyIdRef propertyId = GetPropertyIdFromName(std::string_view{str, length});
+  const JsPropertyIdRef propertyId = GetInternedPropertyId(std::string_view{str, length});
   return MakePointer<facebook::jsi::PropNameID>(propertyId);
 }
 
 facebook::jsi::PropNameID ChakraRuntime::createPropNameIDFromUtf8(const uint8_t *utf8, size_t length) {
   const JsPropertyIdRef propertyId =
-      GetPropertyIdFromName(std::string_view{reinterpret_cast<const char *>(utf8), length});
+      GetInternedPropertyId(std::string_view{reinterpret_cast<const char *>(utf8), length});
   return MakePointer<facebook::jsi::PropNameID>(propertyId);
 }
 
@@ -702,6 +704,33 @@ JsValueRef ChakraRuntime::ToJsValueRef(const facebook::jsi::Value &value) {
   }
 }
 
+JsPropertyIdRef ChakraRuntime::GetInternedPropertyId(std::string_view name) {
+  const size_t hash = std::hash<std::string_view>{}(name);
+  PropertyIdCacheEntry &cacheEntry = m_propertyIdFrontCache[hash % PropertyIdFrontCacheSize];
+  if (cacheEntry.PropertyId != JS_INVALID_REFERENCE && cacheEntry.Hash == hash && cacheEntry.Name == name) {
+    ++m_propertyIdCacheStats.FrontCacheHits;
+    return cacheEntry.PropertyId;
+  }
+
+  std::string key{name};
+  auto it = m_internedPropertyIds.find(key);
+  if (it != m_internedPropertyIds.end()) {
+    ++m_propertyIdCacheStats.TableHits;
+  } else {
+    ++m_propertyIdCacheStats.Misses;
+    const JsPropertyIdRef propertyId = GetPropertyIdFromName(name);
+    if (m_internedPropertyIds.size() >= MaxInternedPropertyIdCount) {
+      return propertyId;
+    }
+
+    it = m_internedPropertyIds.emplace(std::move(key), JsRefHolder{propertyId}).first;
+  }
+
+  // The unordered_map nodes are not moved on rehash, and the cached key view stays valid.
+  cacheEntry = PropertyIdCacheEntry{hash, it->first, it->second};
+  return it->second;
+}
+
 JsValueRef ChakraRuntime::CreateExternalFunction(
     JsPropertyIdRef name,
     int32_t paramCount,
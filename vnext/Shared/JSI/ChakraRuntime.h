@@ -13,6 +13,9 @@
 #include <array>
 #include <mutex>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace Microsoft::JSI {
 
@@ -23,6 +26,17 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
   void Init() noexcept;
   virtual ~ChakraRuntime() noexcept;
 
+  // Counters of the property id intern cache used by createPropNameIDFromAscii and createPropNameIDFromUtf8.
+  struct PropertyIdCacheStats final {
+    uint64_t FrontCacheHits{0};
+    uint64_t TableHits{0};
+    uint64_t Misses{0};
+  };
+
+  PropertyIdCacheStats const &GetPropertyIdCacheStats() const noexcept {
+    return m_propertyIdCacheStats;
+  }
+
 #pragma region Functions_inherited_from_Runtime
 
   facebook::jsi::Value evaluateJavaScript(
@@ -169,6 +183,9 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
   facebook::jsi::Value ToJsiValue(JsValueRef ref);
   JsValueRef ToJsValueRef(const facebook::jsi::Value &value);
 
+  // Returns the property id for the UTF-8 name from the intern cache.
+  JsPropertyIdRef GetInternedPropertyId(std::string_view name);
+
  private: //  ChakraApi::IExceptionThrower members
   [[noreturn]] void ThrowJsExceptionOverride(JsErrorCode errorCode, JsValueRef jsError) override;
   [[noreturn]] void ThrowNativeExceptionOverride(char const *errorMessage) override;
@@ -463,6 +480,24 @@ class ChakraRuntime : public facebook::jsi::Runtime, public ChakraApi, ChakraApi
     JsRefHolder writable;
   } m_propertyId;
 
+  // Interned property ids keyed by their UTF-8 names. The JsRefHolder keeps the property ids alive
+  // for the runtime lifetime. The number of entries is limited to avoid growing the table for the
+  // dynamic property names.
+  std::unordered_map<std::string, JsRefHolder> m_internedPropertyIds;
+  constexpr static size_t MaxInternedPropertyIdCount = 4096;
+
+  // Direct-mapped cache in front of the m_internedPropertyIds that avoids hashing into the table
+  // and allocating the std::string key. The Name refers to a key owned by the m_internedPropertyIds.
+  // The runtime is used from a single thread, and the cache does not need any locks.
+  struct PropertyIdCacheEntry final {
+    size_t Hash{0};
+    std::string_view Name;
+    JsPropertyIdRef PropertyId{JS_INVALID_REFERENCE};
+  };
+  constexpr static size_t PropertyIdFrontCacheSize = 64;
+  std::array<PropertyIdCacheEntry, PropertyIdFrontCacheSize> m_propertyIdFrontCache{};
+  PropertyIdCacheStats m_propertyIdCacheStats;
+
   JsRefHolder m_undefinedValue;
   JsRefHolder m_proxyConstructor;
   JsRefHolder m_hostObjectProxyHandler;
@@ -4,12 +4,12 @@
 #pragma once
 
 #include <AsyncStorage/AsyncStorageManager.h>
+#include <AsyncStorage/SqliteKeyValueStore.h>
 #include <cxxreact/CxxModule.h>
 #include <cxxreact/MessageQueueThread.h>
 #include <folly/dynamic.h>
 
 #include <winrt/Windows.Foundation.h>
-#include <winsqlite/winsqlite3.h>
 #include <memory>
 
 namespace facebook {
@@ -33,24 +33,30 @@ class AsyncStorageModuleWin32 : public facebook::xplat::module::CxxModule {
     DBTask(DBTask &&) = default;
     DBTask &operator=(const DBTask &) = delete;
     DBTask &operator=(DBTask &&) = default;
-    void operator()(sqlite3 *db);
+
+    // Runs the task inside the current transaction and returns the arguments
+    // for its callback. The callback is only invoked by Complete, once the
+    // transaction has been committed.
+    std::vector<folly::dynamic> operator()(SqliteKeyValueStore &store);
+    void Complete(std::vector<folly::dynamic> &&result);
+    bool IsWrite() const noexcept;
 
    private:
     Type m_type;
     folly::dynamic m_args;
     Callback m_callback;
 
-    void multiGet(sqlite3 *db);
-    void multiSet(sqlite3 *db);
-    void multiRemove(sqlite3 *db);
-    void clear(sqlite3 *db);
-    void getAllKeys(sqlite3 *db);
+    std::vector<folly::dynamic> multiGet(SqliteKeyValueStore &store);
+    std::vector<folly::dynamic> multiSet(SqliteKeyValueStore &store);
+    std::vector<folly::dynamic> multiRemove(SqliteKeyValueStore &store);
+    std::vector<folly::dynamic> clear(SqliteKeyValueStore &store);
+    std::vector<folly::dynamic> getAllKeys(SqliteKeyValueStore &store);
   };
   winrt::slim_mutex m_lock;
   winrt::slim_condition_variable m_cv;
   winrt::Windows::Foundation::IAsyncAction m_action{nullptr};
   std::vector<DBTask> m_tasks;
-  sqlite3 *m_db;
+  std::unique_ptr<SqliteKeyValueStore> m_store;
 
   // params - array<std::string> Keys , Callback(error, returnValue)
   void multiGet(folly::dynamic args, Callback jsCallback);